@@ -31,6 +31,17 @@ template <typename scalar_t>
 using blas2_param_t =
     std::tuple<std::string, index_t, index_t, scalar_t, scalar_t>;
 
+template <typename scalar_t>
+using symv_param_t = std::tuple<std::string, index_t, scalar_t, scalar_t>;
+
+template <typename scalar_t>
+using gemv_multi_param_t =
+    std::tuple<std::string, index_t, index_t, index_t, scalar_t, scalar_t>;
+
+template <typename scalar_t>
+using gemv_batched_param_t = std::tuple<std::string, index_t, index_t,
+                                        scalar_t, scalar_t, index_t, int>;
+
 template <typename scalar_t>
 using blas3_param_t = std::tuple<std::string, std::string, index_t, index_t,
                                  index_t, scalar_t, scalar_t>;
@@ -40,6 +51,9 @@ using gemm_batched_param_t =
     std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
                scalar_t, index_t, int>;
 
+using gemm_s8_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, index_t, int>;
+
 using reduction_param_t = std::tuple<index_t, index_t>;
 
 namespace blas_benchmark {
@@ -158,6 +172,39 @@ inline std::string batch_type_to_str(int batch_type) {
   return "";
 }
 
+inline int str_to_quantization_type(std::string str) {
+  // Remove any null character from str
+  str.erase(std::find(str.begin(), str.end(), '\0'), str.end());
+  if (str == "tensor") {
+    return 0;
+  } else if (str == "row") {
+    return 1;
+  } else if (str == "column") {
+    return 2;
+  } else {
+    throw std::runtime_error("Unrecognized quantization type: '" + str + "'");
+  }
+  return -1;
+}
+
+inline std::string quantization_type_to_str(int quantization_type) {
+  switch (quantization_type) {
+    case 0:
+      return "tensor";
+
+    case 1:
+      return "row";
+
+    case 2:
+      return "column";
+
+    default:
+      throw std::runtime_error("Unrecognized quantization type: " +
+                               std::to_string(quantization_type));
+  }
+  return "";
+}
+
 /**
  * @fn str_to_scalar
  * @brief Converts a string to a specific scalar type
@@ -242,6 +289,132 @@ static inline std::vector<blas2_param_t<scalar_t>> get_blas2_params(
   }
 }
 
+/**
+ * @fn get_symv_params
+ * @brief Returns a vector containing the symv benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<symv_param_t<scalar_t>> get_symv_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<symv_param_t<scalar_t>> symv_default;
+    constexpr index_t dmin = 64, dmax = 4096;
+    scalar_t alpha = 1;
+    scalar_t beta = 0;
+    for (std::string uplo : {"u", "l"}) {
+      for (index_t n = dmin; n <= dmax; n *= 2) {
+        symv_default.push_back(std::make_tuple(uplo, n, alpha, beta));
+      }
+    }
+    return symv_default;
+  } else {
+    return parse_csv_file<symv_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 4) {
+            throw std::runtime_error(
+                "invalid number of parameters (4 expected)");
+          }
+          try {
+            return std::make_tuple(v[0].c_str(), str_to_int<index_t>(v[1]),
+                                   str_to_scalar<scalar_t>(v[2]),
+                                   str_to_scalar<scalar_t>(v[3]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_gemv_multi_params
+ * @brief Returns a vector containing the parameters of the benchmark of the
+ * product of a matrix with several vectors, either read from a file according
+ * to the command-line args, or the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<gemv_multi_param_t<scalar_t>> get_gemv_multi_params(
+    Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<gemv_multi_param_t<scalar_t>> gemv_multi_default;
+    constexpr index_t dmin = 256, dmax = 4096;
+    scalar_t alpha = 1;
+    scalar_t beta = 0;
+    for (std::string t : {"n", "t"}) {
+      for (index_t d = dmin; d <= dmax; d *= 4) {
+        for (index_t k : {2, 4, 8, 16}) {
+          gemv_multi_default.push_back(
+              std::make_tuple(t, d, d, k, alpha, beta));
+        }
+      }
+    }
+    return gemv_multi_default;
+  } else {
+    return parse_csv_file<gemv_multi_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 6) {
+            throw std::runtime_error(
+                "invalid number of parameters (6 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0].c_str(), str_to_int<index_t>(v[1]),
+                str_to_int<index_t>(v[2]), str_to_int<index_t>(v[3]),
+                str_to_scalar<scalar_t>(v[4]), str_to_scalar<scalar_t>(v[5]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_gemv_batched_params
+ * @brief Returns a vector containing the gemv_batched benchmark parameters,
+ * either read from a file according to the command-line args, or the default
+ * ones.
+ */
+template <typename scalar_t>
+static inline std::vector<gemv_batched_param_t<scalar_t>>
+get_gemv_batched_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<gemv_batched_param_t<scalar_t>> gemv_batched_default;
+    constexpr index_t dmin = 16, dmax = 256;
+    scalar_t alpha = 1;
+    scalar_t beta = 0;
+    for (std::string t : {"n", "t"}) {
+      for (index_t d = dmin; d <= dmax; d *= 4) {
+        for (index_t batch_size : {16, 256}) {
+          for (int batch_type : {0, 1}) {
+            gemv_batched_default.push_back(
+                std::make_tuple(t, d, d, alpha, beta, batch_size, batch_type));
+          }
+        }
+      }
+    }
+    return gemv_batched_default;
+  } else {
+    return parse_csv_file<gemv_batched_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 7) {
+            throw std::runtime_error(
+                "invalid number of parameters (7 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0].c_str(), str_to_int<index_t>(v[1]),
+                str_to_int<index_t>(v[2]), str_to_scalar<scalar_t>(v[3]),
+                str_to_scalar<scalar_t>(v[4]), str_to_int<index_t>(v[5]),
+                str_to_batch_type(v[6]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
 /**
  * @fn get_blas3_params
  * @brief Returns a vector containing the blas 3 benchmark parameters, either
@@ -340,6 +513,48 @@ inline std::vector<gemm_batched_param_t<scalar_t>> get_gemm_batched_params(
   }
 }
 
+/**
+ * @fn get_gemm_s8_params
+ * @brief Returns a vector containing the parameters of the int8 GEMM
+ * benchmark, either read from a file according to the command-line args, or
+ * the default ones.
+ */
+inline std::vector<gemm_s8_param_t> get_gemm_s8_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<gemm_s8_param_t> gemm_s8_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    std::vector<std::string> dtranspose = {"n", "t"};
+    for (std::string& t1 : dtranspose) {
+      for (std::string& t2 : dtranspose) {
+        for (index_t d = dmin; d <= dmax; d *= 2) {
+          for (int quantization_type : {0, 1, 2}) {
+            gemm_s8_default.push_back(
+                std::make_tuple(t1, t2, d, d, d, quantization_type));
+          }
+        }
+      }
+    }
+    return gemm_s8_default;
+  } else {
+    return parse_csv_file<gemm_s8_param_t>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 6) {
+            throw std::runtime_error(
+                "invalid number of parameters (6 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0].c_str(), v[1].c_str(), str_to_int<index_t>(v[2]),
+                str_to_int<index_t>(v[3]), str_to_int<index_t>(v[4]),
+                str_to_quantization_type(v[5]));
+          } catch (...) {
+            std::throw_with_nested(std::runtime_error("invalid parameter"));
+          }
+        });
+  }
+}
+
 /**
  * @fn get_reduction_params
  * @brief Returns a vector containing the reduction benchmark parameters, either
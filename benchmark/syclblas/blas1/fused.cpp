@@ -0,0 +1,233 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename fused.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+/* Fused routines of the Krylov solvers, each compared with the sequence of
+ * BLAS 1 calls it replaces */
+enum class fused_routine_t { axpy_dot, axpy_nrm2, xpay, waxpby };
+
+const char* get_routine_name(fused_routine_t routine) {
+  switch (routine) {
+    case fused_routine_t::axpy_dot:
+      return "axpy_dot";
+    case fused_routine_t::axpy_nrm2:
+      return "axpy_nrm2";
+    case fused_routine_t::xpay:
+      return "xpay";
+    default:
+      return "waxpby";
+  }
+}
+
+template <typename scalar_t>
+std::string get_name(int size, fused_routine_t routine, bool fused) {
+  std::ostringstream str{};
+  str << "BM_Fused<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << size << "/" << get_routine_name(routine) << "/"
+      << (fused ? "fused" : "unfused");
+  return str.str();
+}
+
+/* Number of vector elements read or written by the routine */
+double get_vector_accesses(fused_routine_t routine, bool fused) {
+  switch (routine) {
+    case fused_routine_t::axpy_dot:
+      // fused: x, y, z read, y written; unfused: axpy then dot
+      return fused ? 4.0 : 5.0;
+    case fused_routine_t::axpy_nrm2:
+      // fused: x, y read, y written; unfused: axpy then nrm2
+      return fused ? 3.0 : 4.0;
+    case fused_routine_t::xpay:
+      // fused: x, y read, y written; unfused: scal then axpy
+      return fused ? 3.0 : 5.0;
+    default:
+      // fused: x, y read, w written; unfused: copy, scal then axpy
+      return fused ? 3.0 : 7.0;
+  }
+}
+
+template <typename scalar_t, typename container_t>
+std::vector<cl::sycl::event> launch(ExecutorType& ex, fused_routine_t routine,
+                                    bool fused, index_t size, scalar_t alpha,
+                                    scalar_t beta, container_t x,
+                                    container_t y, container_t z,
+                                    container_t rs) {
+  switch (routine) {
+    case fused_routine_t::axpy_dot:
+      if (fused) {
+        return _axpy_dot(ex, size, alpha, x, 1, y, 1, z, 1, rs);
+      }
+      return blas::concatenate_vectors(_axpy(ex, size, alpha, x, 1, y, 1),
+                                       _dot(ex, size, y, 1, z, 1, rs));
+    case fused_routine_t::axpy_nrm2:
+      if (fused) {
+        return _axpy_nrm2(ex, size, alpha, x, 1, y, 1, rs);
+      }
+      return blas::concatenate_vectors(_axpy(ex, size, alpha, x, 1, y, 1),
+                                       _nrm2(ex, size, y, 1, rs));
+    case fused_routine_t::xpay:
+      if (fused) {
+        return _xpay(ex, size, x, 1, alpha, y, 1);
+      }
+      return blas::concatenate_vectors(
+          _scal(ex, size, alpha, y, 1),
+          _axpy(ex, size, scalar_t{1}, x, 1, y, 1));
+    default:
+      // w is stored in z
+      if (fused) {
+        return _waxpby(ex, size, alpha, x, 1, beta, y, 1, z, 1);
+      }
+      return blas::concatenate_vectors(
+          blas::concatenate_vectors(_copy(ex, size, y, 1, z, 1),
+                                    _scal(ex, size, beta, z, 1)),
+          _axpy(ex, size, alpha, x, 1, z, 1));
+  }
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size,
+         fused_routine_t routine, bool fused, bool* success) {
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  state.counters["size"] = size_d;
+  state.counters["n_fl_ops"] =
+      (routine == fused_routine_t::axpy_dot) ? 4.0 * size_d : 3.0 * size_d;
+  state.counters["bytes_processed"] =
+      get_vector_accesses(routine, fused) * size_d * sizeof(scalar_t);
+
+  ExecutorType& ex = *executorPtr;
+
+  // Create data
+  std::vector<scalar_t> v1 = blas_benchmark::utils::random_data<scalar_t>(size);
+  std::vector<scalar_t> v2 = blas_benchmark::utils::random_data<scalar_t>(size);
+  std::vector<scalar_t> v3 = blas_benchmark::utils::random_data<scalar_t>(size);
+  scalar_t alpha = blas_benchmark::utils::random_scalar<scalar_t>();
+  scalar_t beta = blas_benchmark::utils::random_scalar<scalar_t>();
+  scalar_t res;
+
+  auto inx = blas::make_sycl_iterator_buffer<scalar_t>(v1, size);
+  auto iny = blas::make_sycl_iterator_buffer<scalar_t>(v2, size);
+  auto inz = blas::make_sycl_iterator_buffer<scalar_t>(v3, size);
+  auto inr = blas::make_sycl_iterator_buffer<scalar_t>(&res, 1);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results: the fused and
+  // unfused versions must produce the same vector and scalar
+  std::vector<scalar_t> out_ref = v2;
+  std::vector<scalar_t> out_temp = v2;
+  scalar_t res_ref = 0;
+  scalar_t res_temp = 0;
+  for (int version = 0; version < 2; version++) {
+    std::vector<scalar_t>& out = version ? out_temp : out_ref;
+    scalar_t& res_out = version ? res_temp : res_ref;
+    std::vector<scalar_t> y_temp = v2;
+    std::vector<scalar_t> z_temp = v3;
+    {
+      auto y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_temp, size);
+      auto z_gpu = blas::make_sycl_iterator_buffer<scalar_t>(z_temp, size);
+      auto r_gpu = blas::make_sycl_iterator_buffer<scalar_t>(&res_out, 1);
+      auto event = launch(ex, routine, version == 1, size, alpha, beta, inx,
+                          y_gpu, z_gpu, r_gpu);
+      ex.get_policy_handler().wait(event);
+    }
+    out = (routine == fused_routine_t::waxpby) ? z_temp : y_temp;
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(out_temp, out_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  } else if ((routine == fused_routine_t::axpy_dot ||
+              routine == fused_routine_t::axpy_nrm2) &&
+             !utils::almost_equal<scalar_t>(res_temp, res_ref)) {
+    err_stream << "Value mismatch: " << res_temp << "; expected " << res_ref;
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  // Number of kernels launched by one call
+  size_t num_kernels = 0;
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event =
+        launch(ex, routine, fused, size, alpha, beta, inx, iny, inz, inr);
+    num_kernels = event.size();
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  state.counters["kernels"] = static_cast<double>(num_kernels);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto blas1_params = blas_benchmark::utils::get_blas1_params(args);
+  const fused_routine_t routines[] = {
+      fused_routine_t::axpy_dot, fused_routine_t::axpy_nrm2,
+      fused_routine_t::xpay, fused_routine_t::waxpby};
+
+  for (auto size : blas1_params) {
+    for (auto routine : routines) {
+      for (bool fused : {false, true}) {
+        auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                             index_t size, fused_routine_t routine,
+                             bool fused, bool* success) {
+          run<scalar_t>(st, exPtr, size, routine, fused, success);
+        };
+        benchmark::RegisterBenchmark(
+            get_name<scalar_t>(size, routine, fused).c_str(), BM_lambda,
+            exPtr, size, routine, fused, success);
+      }
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
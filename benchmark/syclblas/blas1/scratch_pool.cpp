@@ -0,0 +1,119 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename scratch_pool.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(int size) {
+  std::ostringstream str{};
+  str << "BM_ScratchPool<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/";
+  str << size;
+  return str.str();
+}
+
+/* Runs _dot, which needs two scratch buffers per call, and reports how many
+ * device allocations the scratch pool makes per call. After the first call
+ * the pool reuses its blocks, so allocs_per_call is expected to be zero. */
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size,
+         bool* success) {
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  state.counters["size"] = size_d;
+  state.counters["n_fl_ops"] = 2 * size_d;
+  state.counters["bytes_processed"] = 2 * size_d * sizeof(scalar_t);
+
+  ExecutorType& ex = *executorPtr;
+
+  // Create data
+  std::vector<scalar_t> v1 = blas_benchmark::utils::random_data<scalar_t>(size);
+  std::vector<scalar_t> v2 = blas_benchmark::utils::random_data<scalar_t>(size);
+  scalar_t res;
+
+  auto inx = blas::make_sycl_iterator_buffer<scalar_t>(v1, size);
+  auto iny = blas::make_sycl_iterator_buffer<scalar_t>(v2, size);
+  auto inr = blas::make_sycl_iterator_buffer<scalar_t>(&res, 1);
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _dot(ex, size, inx, 1, iny, 1, inr);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  auto policy_handler = ex.get_policy_handler();
+  const double allocs_before_first_call =
+      static_cast<double>(policy_handler.get_scratch_allocation_count());
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  const double allocs_at_steady_state =
+      static_cast<double>(policy_handler.get_scratch_allocation_count());
+  state.counters["warmup_allocs"] =
+      allocs_at_steady_state - allocs_before_first_call;
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+
+  state.counters["allocs_per_call"] =
+      (static_cast<double>(policy_handler.get_scratch_allocation_count()) -
+       allocs_at_steady_state) /
+      state.iterations();
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto blas1_params = blas_benchmark::utils::get_blas1_params(args);
+
+  for (auto size : blas1_params) {
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                         index_t size, bool* success) {
+      run<scalar_t>(st, exPtr, size, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(size).c_str(), BM_lambda,
+                                 exPtr, size, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,209 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_batched.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+// Interleaves batch_size operands of operand_size elements stored one after
+// the other
+template <typename scalar_t>
+std::vector<scalar_t> interleave(const std::vector<scalar_t>& input,
+                                 index_t operand_size, index_t batch_size) {
+  std::vector<scalar_t> output(input.size());
+  for (index_t b = 0; b < batch_size; ++b) {
+    for (index_t e = 0; e < operand_size; ++e) {
+      output[e * batch_size + b] = input[b * operand_size + e];
+    }
+  }
+  return output;
+}
+
+template <typename scalar_t>
+std::string get_name(std::string t, int m, int n, int batch_size,
+                     int batch_type) {
+  std::ostringstream str{};
+  str << "BM_GemvBatched<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << t << "/" << m << "/" << n << "/" << batch_size << "/"
+      << blas_benchmark::utils::batch_type_to_str(batch_type);
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, int ti,
+         index_t m, index_t n, scalar_t alpha, scalar_t beta,
+         index_t batch_size, int batch_type_i, bool* success) {
+  // Standard test setup.
+  std::string ts = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(ti));
+  const char* t_str = ts.c_str();
+  auto batch_type = static_cast<blas::gemm_batch_type_t>(batch_type_i);
+
+  index_t xlen = t_str[0] == 'n' ? n : m;
+  index_t ylen = t_str[0] == 'n' ? m : n;
+  index_t lda = m;
+  index_t incX = 1;
+  index_t incY = 1;
+  // The operands of the batch are contiguous
+  index_t stride_a = m * n;
+  index_t stride_x = xlen;
+  index_t stride_y = ylen;
+
+  // The counters are double. We convert m, n and batch_size to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double xlen_d = static_cast<double>(xlen);
+  double ylen_d = static_cast<double>(ylen);
+  double batch_size_d = static_cast<double>(batch_size);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+  state.counters["batch_size"] = batch_size_d;
+
+  {
+    double nflops_AtimesX = 2.0 * m_d * n_d;
+    double nflops_timesAlpha = ylen_d;
+    double nflops_addBetaY = (beta != 0) ? 2 * ylen_d : 0;
+    state.counters["n_fl_ops"] =
+        (nflops_AtimesX + nflops_timesAlpha + nflops_addBetaY) * batch_size_d;
+  }
+  {
+    double mem_readA = m_d * n_d;
+    double mem_readX = xlen_d;
+    double mem_writeY = ylen_d;
+    double mem_readY = (beta != 0) ? ylen_d : 0;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readX + mem_writeY + mem_readY) * batch_size_d *
+        sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Input matrices and vectors
+  std::vector<scalar_t> a =
+      blas_benchmark::utils::random_data<scalar_t>(stride_a * batch_size);
+  std::vector<scalar_t> x =
+      blas_benchmark::utils::random_data<scalar_t>(stride_x * batch_size);
+  std::vector<scalar_t> y =
+      blas_benchmark::utils::const_data<scalar_t>(stride_y * batch_size, 0);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> y_ref = y;
+  for (index_t b = 0; b < batch_size; b++) {
+    reference_blas::gemv(t_str, m, n, alpha, a.data() + b * stride_a, lda,
+                         x.data() + b * stride_x, incX, beta,
+                         y_ref.data() + b * stride_y, incY);
+  }
+#endif
+  if (batch_type == blas::gemm_batch_type_t::interleaved) {
+    a = interleave(a, stride_a, batch_size);
+    x = interleave(x, stride_x, batch_size);
+#ifdef BLAS_VERIFY_BENCHMARK
+    y_ref = interleave(y_ref, stride_y, batch_size);
+#endif
+  }
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, a.size());
+  auto x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x, x.size());
+  auto y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y, y.size());
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  std::vector<scalar_t> y_temp = y;
+  {
+    auto y_temp_gpu =
+        blas::make_sycl_iterator_buffer<scalar_t>(y_temp, y_temp.size());
+    auto event = _gemv_batched(ex, *t_str, m, n, alpha, a_gpu, lda, stride_a,
+                               x_gpu, incX, stride_x, beta, y_temp_gpu, incY,
+                               stride_y, batch_size, batch_type);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(y_temp, y_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _gemv_batched(ex, *t_str, m, n, alpha, a_gpu, lda, stride_a,
+                               x_gpu, incX, stride_x, beta, y_gpu, incY,
+                               stride_y, batch_size, batch_type);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto gemv_params =
+      blas_benchmark::utils::get_gemv_batched_params<scalar_t>(args);
+
+  for (auto p : gemv_params) {
+    std::string ts;
+    index_t m, n, batch_size;
+    scalar_t alpha, beta;
+    int batch_type;
+    std::tie(ts, m, n, alpha, beta, batch_size, batch_type) = p;
+    int t = static_cast<int>(blas_benchmark::utils::to_transpose_enum(ts));
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, int t,
+                         index_t m, index_t n, scalar_t alpha, scalar_t beta,
+                         index_t batch_size, int batch_type, bool* success) {
+      run<scalar_t>(st, exPtr, t, m, n, alpha, beta, batch_size, batch_type,
+                    success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(ts, m, n, batch_size, batch_type).c_str(), BM_lambda,
+        exPtr, t, m, n, alpha, beta, batch_size, batch_type, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,233 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_multi.cpp
+ *
+ **************************************************************************/
+
+// The loop of GEMV and the tiled GEMM are compared with the product of the
+// matrix with all the vectors at once. The GEMM kernels are called through the
+// backend, _gemm itself dispatches the GEMMs of a few columns to _gemv_multi.
+#include "sycl_blas.hpp"
+#include "../utils.hpp"
+
+enum class gemv_multi_impl_t : int { multi = 0, gemv_loop = 1, gemm = 2 };
+
+inline std::string get_impl_name(gemv_multi_impl_t impl) {
+  switch (impl) {
+    case gemv_multi_impl_t::multi:
+      return "multi";
+    case gemv_multi_impl_t::gemv_loop:
+      return "gemv_loop";
+    default:
+      return "gemm";
+  }
+}
+
+template <typename scalar_t>
+std::string get_name(gemv_multi_impl_t impl, std::string t, int m, int n,
+                     int k) {
+  std::ostringstream str{};
+  str << "BM_GemvMulti<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << get_impl_name(impl) << "/" << t << "/" << m << "/" << n << "/"
+      << k;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr,
+         gemv_multi_impl_t impl, int ti, index_t m, index_t n, index_t k,
+         scalar_t alpha, scalar_t beta, bool* success) {
+  // Standard test setup.
+  std::string ts = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(ti));
+  const char* t_str = ts.c_str();
+  const bool trans = t_str[0] != 'n';
+
+  index_t xlen = trans ? m : n;
+  index_t ylen = trans ? n : m;
+  index_t lda = m;
+
+  // The counters are double. We convert the sizes to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double k_d = static_cast<double>(k);
+  double xlen_d = static_cast<double>(xlen);
+  double ylen_d = static_cast<double>(ylen);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+  state.counters["k"] = k_d;
+
+  {
+    double nflops_AtimesX = 2.0 * m_d * n_d * k_d;
+    double nflops_timesAlpha = ylen_d * k_d;
+    double nflops_addBetaY = (beta != 0) ? 2 * ylen_d * k_d : 0;
+    state.counters["n_fl_ops"] =
+        nflops_AtimesX + nflops_timesAlpha + nflops_addBetaY;
+  }
+  {
+    // The matrix only needs to be read once for all the vectors
+    double mem_readA = m_d * n_d;
+    double mem_readX = xlen_d * k_d;
+    double mem_writeY = ylen_d * k_d;
+    double mem_readY = (beta != 0) ? ylen_d * k_d : 0;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readX + mem_writeY + mem_readY) * sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Input matrix, input and output vectors stored by columns
+  std::vector<scalar_t> m_a =
+      blas_benchmark::utils::random_data<scalar_t>(m * n);
+  std::vector<scalar_t> m_x =
+      blas_benchmark::utils::random_data<scalar_t>(xlen * k);
+  std::vector<scalar_t> m_y =
+      blas_benchmark::utils::random_data<scalar_t>(ylen * k);
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_a, m * n);
+  auto m_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_x, xlen * k);
+  auto m_y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_y, ylen * k);
+
+  auto gemv_multi = [&](decltype(m_y_gpu) y) -> std::vector<cl::sycl::event> {
+    switch (impl) {
+      case gemv_multi_impl_t::multi:
+        return _gemv_multi(ex, *t_str, m, n, k, alpha, m_a_gpu, lda, m_x_gpu,
+                           xlen, beta, y, ylen);
+      case gemv_multi_impl_t::gemv_loop: {
+        std::vector<cl::sycl::event> events;
+        for (index_t j = 0; j < k; ++j) {
+          blas::append_vector(
+              events, _gemv(ex, *t_str, m, n, alpha, m_a_gpu, lda,
+                            m_x_gpu + j * xlen, 1, beta, y + j * ylen, 1));
+        }
+        return events;
+      }
+      default: {
+        // C (ylen x k) = op(A) (ylen x xlen) * X (xlen x k)
+        auto a = ex.get_policy_handler().get_buffer(m_a_gpu);
+        auto x = ex.get_policy_handler().get_buffer(m_x_gpu);
+        auto c = ex.get_policy_handler().get_buffer(y);
+        const index_t batch_size = 1;
+        const auto batch_type = blas::gemm_batch_type_t::strided;
+        if (beta == scalar_t{0}) {
+          return trans ? blas::gemm::backend::_gemm<true, false, true>(
+                             ex, ylen, k, xlen, alpha, a, lda, x, xlen, beta, c,
+                             ylen, batch_size, batch_type)
+                       : blas::gemm::backend::_gemm<false, false, true>(
+                             ex, ylen, k, xlen, alpha, a, lda, x, xlen, beta, c,
+                             ylen, batch_size, batch_type);
+        }
+        return trans ? blas::gemm::backend::_gemm<true, false, false>(
+                           ex, ylen, k, xlen, alpha, a, lda, x, xlen, beta, c,
+                           ylen, batch_size, batch_type)
+                     : blas::gemm::backend::_gemm<false, false, false>(
+                           ex, ylen, k, xlen, alpha, a, lda, x, xlen, beta, c,
+                           ylen, batch_size, batch_type);
+      }
+    }
+  };
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> m_y_ref = m_y;
+  for (index_t j = 0; j < k; ++j) {
+    reference_blas::gemv(t_str, m, n, alpha, m_a.data(), lda,
+                         m_x.data() + j * xlen, 1, beta,
+                         m_y_ref.data() + j * ylen, 1);
+  }
+  std::vector<scalar_t> m_y_temp = m_y;
+  {
+    auto m_y_temp_gpu =
+        blas::make_sycl_iterator_buffer<scalar_t>(m_y_temp, ylen * k);
+    auto event = gemv_multi(m_y_temp_gpu);
+    ex.get_policy_handler().wait();
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(m_y_temp, m_y_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = gemv_multi(m_y_gpu);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto gemv_multi_params =
+      blas_benchmark::utils::get_gemv_multi_params<scalar_t>(args);
+
+  for (auto p : gemv_multi_params) {
+    std::string ts;
+    index_t m, n, k;
+    scalar_t alpha, beta;
+    std::tie(ts, m, n, k, alpha, beta) = p;
+    int t = static_cast<int>(blas_benchmark::utils::to_transpose_enum(ts));
+
+    for (auto impl : {gemv_multi_impl_t::multi, gemv_multi_impl_t::gemv_loop,
+                      gemv_multi_impl_t::gemm}) {
+      auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                           gemv_multi_impl_t impl, int t, index_t m, index_t n,
+                           index_t k, scalar_t alpha, scalar_t beta,
+                           bool* success) {
+        run<scalar_t>(st, exPtr, impl, t, m, n, k, alpha, beta, success);
+      };
+      benchmark::RegisterBenchmark(
+          get_name<scalar_t>(impl, ts, m, n, k).c_str(), BM_lambda, exPtr,
+          impl, t, m, n, k, alpha, beta, success);
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,239 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_quantized.cpp
+ *
+ **************************************************************************/
+
+// The float GEMV is compared with the GEMVs reading the same matrix quantized
+// to int8 and int4 weights. The weights are packed once, outside the timings.
+#include "sycl_blas.hpp"
+#include "../utils.hpp"
+
+enum class gemv_weight_impl_t : int { float_weights = 0, int8 = 1, int4 = 2 };
+
+inline std::string get_impl_name(gemv_weight_impl_t impl) {
+  switch (impl) {
+    case gemv_weight_impl_t::float_weights:
+      return "float";
+    case gemv_weight_impl_t::int8:
+      return "int8";
+    default:
+      return "int4";
+  }
+}
+
+template <typename scalar_t>
+std::string get_name(gemv_weight_impl_t impl, std::string t, int m, int n) {
+  std::ostringstream str{};
+  str << "BM_GemvQuantized<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << get_impl_name(impl) << "/" << t << "/" << m << "/" << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr,
+         gemv_weight_impl_t impl, int ti, index_t m, index_t n,
+         scalar_t alpha, scalar_t beta, bool* success) {
+  // Standard test setup.
+  std::string ts = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(ti));
+  const char* t_str = ts.c_str();
+  const bool trans = t_str[0] != 'n';
+  const auto weight_type = (impl == gemv_weight_impl_t::int4)
+                               ? blas::gemv_weight_t::int4
+                               : blas::gemv_weight_t::int8;
+
+  index_t xlen = trans ? m : n;
+  index_t ylen = trans ? n : m;
+  index_t lda = m;
+  // Two int4 weights share a byte, their columns start on a byte
+  index_t ldq = (impl == gemv_weight_impl_t::int4) ? m + m % 2 : m;
+  index_t q_size = (impl == gemv_weight_impl_t::int4) ? ldq / 2 * n : ldq * n;
+
+  // The counters are double. We convert m and n to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double xlen_d = static_cast<double>(xlen);
+  double ylen_d = static_cast<double>(ylen);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+
+  {
+    // The weights are dequantized with one more multiplication
+    double nflops_AtimesX = 2.0 * m_d * n_d;
+    double nflops_dequantize =
+        (impl == gemv_weight_impl_t::float_weights) ? 0 : m_d * n_d;
+    double nflops_timesAlpha = ylen_d;
+    double nflops_addBetaY = (beta != 0) ? 2 * ylen_d : 0;
+    state.counters["n_fl_ops"] = nflops_AtimesX + nflops_dequantize +
+                                 nflops_timesAlpha + nflops_addBetaY;
+  }
+  {
+    // A quantized matrix is read as its weights and the scales of its rows
+    double mem_readA =
+        (impl == gemv_weight_impl_t::float_weights)
+            ? m_d * n_d * sizeof(scalar_t)
+            : static_cast<double>(q_size) + m_d * sizeof(scalar_t);
+    double mem_readX = xlen_d * sizeof(scalar_t);
+    double mem_writeY = ylen_d * sizeof(scalar_t);
+    double mem_readY = (beta != 0) ? ylen_d * sizeof(scalar_t) : 0;
+    state.counters["bytes_processed"] =
+        mem_readA + mem_readX + mem_writeY + mem_readY;
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  std::vector<scalar_t> m_a =
+      blas_benchmark::utils::random_data<scalar_t>(m * n);
+  std::vector<scalar_t> v_x =
+      blas_benchmark::utils::random_data<scalar_t>(xlen);
+  std::vector<scalar_t> v_y =
+      blas_benchmark::utils::random_data<scalar_t>(ylen);
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_a, m * n);
+  auto m_q_gpu = blas::make_sycl_iterator_buffer<int8_t>(q_size);
+  auto v_scale_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_x, xlen);
+  auto v_y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_y, ylen);
+
+  if (impl != gemv_weight_impl_t::float_weights) {
+    auto event = _gemv_quantize_weights(ex, m, n, m_a_gpu, lda, weight_type,
+                                        m_q_gpu, ldq, v_scale_gpu);
+    ex.get_policy_handler().wait(event);
+  }
+
+  auto gemv = [&](decltype(v_y_gpu) y) -> std::vector<cl::sycl::event> {
+    if (impl == gemv_weight_impl_t::float_weights) {
+      return _gemv(ex, *t_str, m, n, alpha, m_a_gpu, lda, v_x_gpu, 1, beta, y,
+                   1);
+    }
+    return _gemv_quantized(ex, *t_str, m, n, alpha, m_q_gpu, ldq, weight_type,
+                           v_scale_gpu, v_x_gpu, 1, beta, y, 1);
+  };
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results. The quantized
+  // products are checked against the product with the dequantized matrix.
+  std::vector<scalar_t> m_a_ref = m_a;
+  if (impl != gemv_weight_impl_t::float_weights) {
+    std::vector<int8_t> m_q(q_size);
+    std::vector<scalar_t> v_scale(m);
+    auto event =
+        ex.get_policy_handler().copy_to_host(m_q_gpu, m_q.data(), q_size);
+    ex.get_policy_handler().wait(event);
+    event = ex.get_policy_handler().copy_to_host(v_scale_gpu, v_scale.data(),
+                                                 m);
+    ex.get_policy_handler().wait(event);
+    for (index_t j = 0; j < n; ++j) {
+      for (index_t i = 0; i < m; ++i) {
+        int weight;
+        if (impl == gemv_weight_impl_t::int4) {
+          const int packed = m_q[(i + j * ldq) / 2];
+          weight = ((i % 2) ? packed : int(int8_t(packed << 4))) >> 4;
+        } else {
+          weight = m_q[i + j * ldq];
+        }
+        m_a_ref[i + j * lda] = v_scale[i] * static_cast<scalar_t>(weight);
+      }
+    }
+  }
+  std::vector<scalar_t> v_y_ref = v_y;
+  reference_blas::gemv(t_str, m, n, alpha, m_a_ref.data(), lda, v_x.data(), 1,
+                       beta, v_y_ref.data(), 1);
+  std::vector<scalar_t> v_y_temp = v_y;
+  {
+    auto v_y_temp_gpu =
+        blas::make_sycl_iterator_buffer<scalar_t>(v_y_temp, ylen);
+    auto event = gemv(v_y_temp_gpu);
+    ex.get_policy_handler().wait();
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(v_y_temp, v_y_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = gemv(v_y_gpu);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto gemv_params = blas_benchmark::utils::get_blas2_params<scalar_t>(args);
+
+  for (auto p : gemv_params) {
+    std::string ts;
+    index_t m, n;
+    scalar_t alpha, beta;
+    std::tie(ts, m, n, alpha, beta) = p;
+    int t = static_cast<int>(blas_benchmark::utils::to_transpose_enum(ts));
+
+    for (auto impl :
+         {gemv_weight_impl_t::float_weights, gemv_weight_impl_t::int8,
+          gemv_weight_impl_t::int4}) {
+      auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                           gemv_weight_impl_t impl, int t, index_t m,
+                           index_t n, scalar_t alpha, scalar_t beta,
+                           bool* success) {
+        run<scalar_t>(st, exPtr, impl, t, m, n, alpha, beta, success);
+      };
+      benchmark::RegisterBenchmark(get_name<scalar_t>(impl, ts, m, n).c_str(),
+                                   BM_lambda, exPtr, impl, t, m, n, alpha,
+                                   beta, success);
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  // The scales are float, whatever the data types of the build
+  BLAS_REGISTER_BENCHMARK_FLOAT(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,175 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename symv.cpp
+ *
+ **************************************************************************/
+
+// The two-pass implementation is not part of the library, it is compiled from
+// the sources to compare it with the blocked kernel used by _symv
+#include "sycl_blas.hpp"
+#include "../utils.hpp"
+
+enum class symv_impl_t : int { blocked = 0, two_pass = 1 };
+
+inline std::string get_impl_name(symv_impl_t impl) {
+  return impl == symv_impl_t::blocked ? "blocked" : "two_pass";
+}
+
+template <typename scalar_t>
+std::string get_name(symv_impl_t impl, std::string uplo, int n) {
+  std::ostringstream str{};
+  str << "BM_Symv<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << get_impl_name(impl) << "/" << uplo << "/" << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, symv_impl_t impl,
+         std::string uplo, index_t n, scalar_t alpha, scalar_t beta,
+         bool* success) {
+  const char* uplo_str = uplo.c_str();
+  index_t lda = n;
+  index_t incX = 1;
+  index_t incY = 1;
+
+  // The counters are double. We convert n to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  double n_d = static_cast<double>(n);
+
+  state.counters["n"] = n_d;
+
+  {
+    double nflops_AtimesX = 2.0 * n_d * n_d;
+    double nflops_timesAlpha = n_d;
+    double nflops_addBetaY = (beta != 0) ? 2 * n_d : 0;
+    state.counters["n_fl_ops"] =
+        nflops_AtimesX + nflops_timesAlpha + nflops_addBetaY;
+  }
+  {
+    // Only the stored triangle needs to be read, so that both implementations
+    // are compared against the same minimal traffic
+    double mem_readA = n_d * (n_d + 1) / 2;
+    double mem_readX = n_d;
+    double mem_writeY = n_d;
+    double mem_readY = (beta != 0) ? n_d : 0;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readX + mem_writeY + mem_readY) * sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  // Input matrix/vector, output vector.
+  std::vector<scalar_t> m_a =
+      blas_benchmark::utils::random_data<scalar_t>(lda * n);
+  std::vector<scalar_t> v_x = blas_benchmark::utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> v_y = blas_benchmark::utils::random_data<scalar_t>(n);
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_a, lda * n);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_x, n);
+  auto v_y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_y, n);
+
+  auto symv = [&](decltype(v_y_gpu) y) -> std::vector<cl::sycl::event> {
+    if (impl == symv_impl_t::blocked) {
+      return _symv(ex, *uplo_str, n, alpha, m_a_gpu, lda, v_x_gpu, incX, beta,
+                   y, incY);
+    } else {
+      return blas::internal::_symv_two_pass_impl(ex, *uplo_str, n, alpha,
+                                                 m_a_gpu, lda, v_x_gpu, incX,
+                                                 beta, y, incY);
+    }
+  };
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> v_y_ref = v_y;
+  reference_blas::symv(uplo_str, n, alpha, m_a.data(), lda, v_x.data(), incX,
+                       beta, v_y_ref.data(), incY);
+  std::vector<scalar_t> v_y_temp = v_y;
+  {
+    auto v_y_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_y_temp, n);
+    auto event = symv(v_y_temp_gpu);
+    ex.get_policy_handler().wait();
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(v_y_temp, v_y_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = symv(v_y_gpu);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto symv_params = blas_benchmark::utils::get_symv_params<scalar_t>(args);
+
+  for (auto p : symv_params) {
+    std::string uplo;
+    index_t n;
+    scalar_t alpha, beta;
+    std::tie(uplo, n, alpha, beta) = p;
+
+    for (auto impl : {symv_impl_t::blocked, symv_impl_t::two_pass}) {
+      auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                           symv_impl_t impl, std::string uplo, index_t n,
+                           scalar_t alpha, scalar_t beta, bool* success) {
+        run<scalar_t>(st, exPtr, impl, uplo, n, alpha, beta, success);
+      };
+      benchmark::RegisterBenchmark(get_name<scalar_t>(impl, uplo, n).c_str(),
+                                   BM_lambda, exPtr, impl, uplo, n, alpha, beta,
+                                   success);
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,233 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_ex.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+// The epilogues run for each set of parameters. The plain GEMM is the
+// baseline of the fused bias and activation, which should cost about the same.
+enum class epilogue_t : int { gemm = 0, bias_relu = 1, bias_gelu = 2 };
+
+inline std::string get_epilogue_name(epilogue_t epilogue) {
+  switch (epilogue) {
+    case epilogue_t::bias_relu:
+      return "bias_relu";
+    case epilogue_t::bias_gelu:
+      return "bias_gelu";
+    default:
+      return "gemm";
+  }
+}
+
+template <typename scalar_t>
+std::string get_name(std::string t1, std::string t2, int m, int k, int n,
+                     epilogue_t epilogue) {
+  std::ostringstream str{};
+  str << "BM_GemmEx<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << t1 << "/" << t2 << "/" << m << "/" << k << "/" << n << "/"
+      << get_epilogue_name(epilogue);
+  return str.str();
+}
+
+template <typename scalar_t, typename container_t>
+std::vector<cl::sycl::event> run_gemm(ExecutorType& ex, epilogue_t epilogue,
+                                      char t_a, char t_b, index_t m, index_t n,
+                                      index_t k, scalar_t alpha,
+                                      container_t a_gpu, index_t lda,
+                                      container_t b_gpu, index_t ldb,
+                                      scalar_t beta, container_t c_gpu,
+                                      index_t ldc, container_t bias_gpu) {
+  if (epilogue == epilogue_t::gemm) {
+    return _gemm(ex, t_a, t_b, m, n, k, alpha, a_gpu, lda, b_gpu, ldb, beta,
+                 c_gpu, ldc);
+  }
+  const auto activation = (epilogue == epilogue_t::bias_relu)
+                              ? blas::gemm_activation_t::relu
+                              : blas::gemm_activation_t::gelu;
+  return _gemm_ex(ex, t_a, t_b, m, n, k, alpha, a_gpu, lda, b_gpu, ldb, beta,
+                  c_gpu, ldc, blas::gemm_bias_t::row, bias_gpu, activation);
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, int t1, int t2,
+         index_t m, index_t k, index_t n, scalar_t alpha, scalar_t beta,
+         epilogue_t epilogue, bool* success) {
+  // Standard test setup.
+  std::string t1s = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(t1));
+  std::string t2s = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(t2));
+  const char* t_a = t1s.c_str();
+  const char* t_b = t2s.c_str();
+
+  index_t lda = t_a[0] == 'n' ? m : k;
+  index_t ldb = t_b[0] == 'n' ? k : n;
+  index_t ldc = m;
+
+  ExecutorType& ex = *executorPtr;
+
+  // Matrices and bias, one value per row of C
+  std::vector<scalar_t> a = blas_benchmark::utils::random_data<scalar_t>(m * k);
+  std::vector<scalar_t> b = blas_benchmark::utils::random_data<scalar_t>(k * n);
+  std::vector<scalar_t> c =
+      blas_benchmark::utils::const_data<scalar_t>(m * n, 0);
+  std::vector<scalar_t> bias = blas_benchmark::utils::random_data<scalar_t>(m);
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, m * k);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b, k * n);
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c, m * n);
+  auto bias_gpu = blas::make_sycl_iterator_buffer<scalar_t>(bias, m);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> c_ref = c;
+  reference_blas::gemm(t_a, t_b, m, n, k, alpha, a.data(), lda, b.data(), ldb,
+                       beta, c_ref.data(), ldc);
+  if (epilogue != epilogue_t::gemm) {
+    for (index_t j = 0; j < n; ++j) {
+      for (index_t i = 0; i < m; ++i) {
+        scalar_t& value = c_ref[i + j * ldc];
+        value += bias[i];
+        value = (epilogue == epilogue_t::bias_relu)
+                    ? std::max(value, scalar_t(0))
+                    : scalar_t(0.5) * value *
+                          (scalar_t(1) +
+                           std::tanh(scalar_t(0.7978845608028654) *
+                                     (value + scalar_t(0.044715) * value *
+                                                  value * value)));
+      }
+    }
+  }
+  std::vector<scalar_t> c_temp = c;
+  {
+    auto c_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_temp, m * n);
+    auto event = run_gemm(ex, epilogue, *t_a, *t_b, m, n, k, alpha, a_gpu,
+                          lda, b_gpu, ldb, beta, c_temp_gpu, ldc, bias_gpu);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<scalar_t>(c_temp, c_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = run_gemm(ex, epilogue, *t_a, *t_b, m, n, k, alpha, a_gpu,
+                          lda, b_gpu, ldb, beta, c_gpu, ldc, bias_gpu);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  {
+    // The counters are double. We convert m, n and k to double to avoid
+    // integer overflows for n_fl_ops and bytes_processed
+    double m_d = static_cast<double>(m);
+    double n_d = static_cast<double>(n);
+    double k_d = static_cast<double>(k);
+
+    state.counters["m"] = m_d;
+    state.counters["k"] = k_d;
+    state.counters["n"] = n_d;
+
+    // The epilogue only reads the bias on top of the GEMM, C is not read or
+    // written again
+    double mem_readA = m_d * k_d;
+    double mem_readB = k_d * n_d;
+    double mem_writeC = m_d * n_d;
+    double mem_readC = (beta != 0) ? m_d * n_d : 0;
+    double mem_readBias = (epilogue != epilogue_t::gemm) ? m_d : 0;
+    double total_mem = (mem_readA + mem_readB + mem_readC + mem_writeC +
+                        mem_readBias) *
+                       sizeof(scalar_t);
+    state.counters["bytes_processed"] = total_mem;
+    state.SetBytesProcessed(state.iterations() * total_mem);
+
+    double nflops_AtimesB = (2 * k_d - 1) * m_d * n_d;
+    double nflops_timesAlpha = m_d * n_d;
+    double nflops_addBetaC = (beta != 0) ? 2 * m_d * n_d : 0;
+    double nflops_addBias = (epilogue != epilogue_t::gemm) ? m_d * n_d : 0;
+    double nflops =
+        nflops_AtimesB + nflops_timesAlpha + nflops_addBetaC + nflops_addBias;
+    state.counters["n_fl_ops"] = nflops;
+    state.SetItemsProcessed(state.iterations() * nflops);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto gemm_params = blas_benchmark::utils::get_blas3_params<scalar_t>(args);
+
+  for (auto p : gemm_params) {
+    std::string t1s, t2s;
+    index_t m, n, k;
+    scalar_t alpha, beta;
+    std::tie(t1s, t2s, m, k, n, alpha, beta) = p;
+    int t1 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t1s));
+    int t2 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t2s));
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, int t1,
+                         int t2, index_t m, index_t k, index_t n,
+                         scalar_t alpha, scalar_t beta, epilogue_t epilogue,
+                         bool* success) {
+      run<scalar_t>(st, exPtr, t1, t2, m, k, n, alpha, beta, epilogue,
+                    success);
+    };
+    for (epilogue_t epilogue :
+         {epilogue_t::gemm, epilogue_t::bias_relu, epilogue_t::bias_gelu}) {
+      benchmark::RegisterBenchmark(
+          get_name<scalar_t>(t1s, t2s, m, k, n, epilogue).c_str(), BM_lambda,
+          exPtr, t1, t2, m, k, n, alpha, beta, epilogue, success)
+          ->UseRealTime();
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,246 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_s8.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t, typename output_t>
+std::string get_name(std::string t1, std::string t2, int m, int k, int n,
+                     int quantization_type) {
+  std::ostringstream str{};
+  str << "BM_GemmS8<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << t1 << "/" << t2 << "/" << m << "/" << k << "/" << n << "/"
+      << blas_benchmark::utils::quantization_type_to_str(quantization_type)
+      << "/" << (std::is_same<output_t, int8_t>::value ? "s8" : "f32");
+  return str.str();
+}
+
+template <typename scalar_t, typename output_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, int t1, int t2,
+         index_t m, index_t k, index_t n, int quantization_type,
+         bool* success) {
+  // Standard test setup.
+  std::string t1s = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(t1));
+  std::string t2s = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(t2));
+  const char* t_a = t1s.c_str();
+  const char* t_b = t2s.c_str();
+
+  index_t lda = t_a[0] == 'n' ? m : k;
+  index_t ldb = t_b[0] == 'n' ? k : n;
+  index_t ldc = m;
+
+  const auto quantization =
+      static_cast<blas::gemm_quantization_t>(quantization_type);
+  const index_t channels =
+      (quantization == blas::gemm_quantization_t::per_row)
+          ? m
+          : (quantization == blas::gemm_quantization_t::per_column) ? n : 1;
+
+  ExecutorType& ex = *executorPtr;
+
+  // Operands in the whole int8 range, and scales that bring the int32
+  // accumulators back to about the same range
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> int8_dis(-128, 127);
+  std::vector<int8_t> a(m * k);
+  std::vector<int8_t> b(k * n);
+  for (auto& e : a) {
+    e = static_cast<int8_t>(int8_dis(gen));
+  }
+  for (auto& e : b) {
+    e = static_cast<int8_t>(int8_dis(gen));
+  }
+  std::vector<scalar_t> scale =
+      blas_benchmark::utils::random_data<scalar_t>(channels);
+  for (auto& e : scale) {
+    e = (e + scalar_t(3)) * scalar_t(1e-4) / k;
+  }
+  std::vector<int32_t> zero_point(channels);
+  for (auto& e : zero_point) {
+    e = int8_dis(gen) / 4;
+  }
+  std::vector<output_t> c(m * n, output_t(0));
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<int8_t>(a, m * k);
+  auto b_gpu = blas::make_sycl_iterator_buffer<int8_t>(b, k * n);
+  auto c_gpu = blas::make_sycl_iterator_buffer<output_t>(c, m * n);
+  auto scale_gpu = blas::make_sycl_iterator_buffer<scalar_t>(scale, channels);
+  auto zero_point_gpu =
+      blas::make_sycl_iterator_buffer<int32_t>(zero_point, channels);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> c_ref(m * n);
+  for (index_t j = 0; j < n; ++j) {
+    for (index_t i = 0; i < m; ++i) {
+      int32_t acc = 0;
+      for (index_t l = 0; l < k; ++l) {
+        acc += int32_t(a[(t_a[0] == 'n') ? i + l * lda : l + i * lda]) *
+               int32_t(b[(t_b[0] == 'n') ? l + j * ldb : j + l * ldb]);
+      }
+      const index_t channel =
+          (quantization == blas::gemm_quantization_t::per_row)
+              ? i
+              : (quantization == blas::gemm_quantization_t::per_column) ? j
+                                                                        : 0;
+      scalar_t value = static_cast<scalar_t>(acc) * scale[channel] +
+                       static_cast<scalar_t>(zero_point[channel]);
+      if (std::is_same<output_t, int8_t>::value) {
+        value = std::min(std::max(std::nearbyint(value), scalar_t(-128)),
+                         scalar_t(127));
+      }
+      c_ref[i + j * ldc] = value;
+    }
+  }
+  std::vector<output_t> c_temp = c;
+  {
+    auto c_temp_gpu = blas::make_sycl_iterator_buffer<output_t>(c_temp, m * n);
+    auto event = _gemm_s8(ex, *t_a, *t_b, m, n, k, a_gpu, lda, b_gpu, ldb,
+                          c_temp_gpu, ldc, quantization, scale_gpu,
+                          zero_point_gpu);
+    ex.get_policy_handler().wait(event);
+  }
+
+  // A fused multiply-add on the device may round an int8 result the other
+  // way, the error of the float results is relative to their magnitude
+  for (index_t i = 0; i < m * n; ++i) {
+    const scalar_t error = std::abs(scalar_t(c_temp[i]) - c_ref[i]);
+    const scalar_t tolerance =
+        std::is_same<output_t, int8_t>::value
+            ? scalar_t(1)
+            : scalar_t(1e-3) + scalar_t(5e-3) * std::abs(c_ref[i]);
+    if (error > tolerance) {
+      std::ostringstream err_stream;
+      err_stream << "Value mismatch at index " << i << ": " << c_temp[i]
+                 << "; expected " << c_ref[i];
+      const std::string& err_str = err_stream.str();
+      state.SkipWithError(err_str.c_str());
+      *success = false;
+      break;
+    }
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _gemm_s8(ex, *t_a, *t_b, m, n, k, a_gpu, lda, b_gpu, ldb,
+                          c_gpu, ldc, quantization, scale_gpu, zero_point_gpu);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  {
+    // The counters are double. We convert m, n and k to double to avoid
+    // integer overflows for n_fl_ops and bytes_processed
+    double m_d = static_cast<double>(m);
+    double n_d = static_cast<double>(n);
+    double k_d = static_cast<double>(k);
+
+    state.counters["m"] = m_d;
+    state.counters["k"] = k_d;
+    state.counters["n"] = n_d;
+
+    // The operands are one byte each, C is written once and never read
+    double mem_readA = m_d * k_d * sizeof(int8_t);
+    double mem_readB = k_d * n_d * sizeof(int8_t);
+    double mem_writeC = m_d * n_d * sizeof(output_t);
+    double mem_readQuantization =
+        static_cast<double>(channels) * (sizeof(scalar_t) + sizeof(int32_t));
+    double total_mem =
+        mem_readA + mem_readB + mem_writeC + mem_readQuantization;
+    state.counters["bytes_processed"] = total_mem;
+    state.SetBytesProcessed(state.iterations() * total_mem);
+
+    // Integer multiply-adds, then a scale and a zero point per result
+    double nops_AtimesB = (2 * k_d - 1) * m_d * n_d;
+    double nops_requantize = 2 * m_d * n_d;
+    double nops = nops_AtimesB + nops_requantize;
+    state.counters["n_fl_ops"] = nops;
+    state.SetItemsProcessed(state.iterations() * nops);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+};
+
+template <typename scalar_t, typename output_t>
+void register_output(blas_benchmark::Args& args, ExecutorType* exPtr,
+                     bool* success) {
+  auto gemm_s8_params = blas_benchmark::utils::get_gemm_s8_params(args);
+
+  for (auto p : gemm_s8_params) {
+    std::string t1s, t2s;
+    index_t m, n, k;
+    int quantization_type;
+    std::tie(t1s, t2s, m, k, n, quantization_type) = p;
+    int t1 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t1s));
+    int t2 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t2s));
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, int t1,
+                         int t2, index_t m, index_t k, index_t n,
+                         int quantization_type, bool* success) {
+      run<scalar_t, output_t>(st, exPtr, t1, t2, m, k, n, quantization_type,
+                              success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t, output_t>(t1s, t2s, m, k, n, quantization_type)
+            .c_str(),
+        BM_lambda, exPtr, t1, t2, m, k, n, quantization_type, success)
+        ->UseRealTime();
+  }
+}
+
+// Every set of parameters runs with an int8 result, requantized for the next
+// layer, and with a float result
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  register_output<scalar_t, int8_t>(args, exPtr, success);
+  register_output<scalar_t, scalar_t>(args, exPtr, success);
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  // The scales are float, whatever the data types of the build
+  BLAS_REGISTER_BENCHMARK_FLOAT(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,178 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename host_executor.cpp
+ *
+ **************************************************************************/
+
+#include "sycl_blas.hpp"
+#include "../utils.hpp"
+
+using namespace blas;
+
+using HostExecutorType = Executor<PolicyHandler<host_policy>>;
+
+enum class routine_t { axpy, dot, gemm };
+
+const char* get_routine_name(routine_t routine) {
+  switch (routine) {
+    case routine_t::axpy:
+      return "axpy";
+    case routine_t::dot:
+      return "dot";
+    default:
+      return "gemm";
+  }
+}
+
+template <typename scalar_t>
+std::string get_name(routine_t routine, int size, bool on_host) {
+  std::ostringstream str{};
+  str << "BM_HostExecutor<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << get_routine_name(routine) << "/" << size << "/"
+      << (on_host ? "host" : "sycl");
+  return str.str();
+}
+
+/*
+ * Calls the routine with the buffers of the executor's policy. x, y and z
+ * are vectors of size elements, or square matrices of size * size elements
+ * for the GEMM.
+ */
+template <typename scalar_t, typename executor_t, typename container_t>
+typename executor_t::policy_t::event_t launch(executor_t& ex,
+                                              routine_t routine,
+                                              index_t size, container_t x,
+                                              container_t y, container_t z) {
+  switch (routine) {
+    case routine_t::axpy:
+      return _axpy(ex, size, scalar_t{2}, x, 1, y, 1);
+    case routine_t::dot:
+      return _dot(ex, size, x, 1, y, 1, z);
+    default:
+      return _gemm(ex, 'n', 'n', size, size, size, scalar_t{1}, x, size, y,
+                   size, scalar_t{0}, z, size);
+  }
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr,
+         HostExecutorType* hostExecutorPtr, routine_t routine, index_t size,
+         bool on_host, bool* success) {
+  const bool is_gemm = routine == routine_t::gemm;
+  const index_t num_elements = is_gemm ? size * size : size;
+
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  state.counters["size"] = size_d;
+  state.counters["n_fl_ops"] = is_gemm ? 2 * size_d * size_d * size_d
+                                       : 2 * size_d;
+  state.counters["bytes_processed"] =
+      (is_gemm ? 3 * size_d * size_d : 3 * size_d) * sizeof(scalar_t);
+
+  // Create data
+  std::vector<scalar_t> v1 =
+      blas_benchmark::utils::random_data<scalar_t>(num_elements);
+  std::vector<scalar_t> v2 =
+      blas_benchmark::utils::random_data<scalar_t>(num_elements);
+  std::vector<scalar_t> v3(is_gemm ? num_elements : 1);
+
+  // The host runs return no SYCL event, only their overall time is reported
+  std::function<std::vector<cl::sycl::event>()> blas_method_def;
+  if (on_host) {
+    HostExecutorType& ex = *hostExecutorPtr;
+    auto inx = make_host_iterator_buffer<scalar_t>(v1.data(), num_elements);
+    auto iny = make_host_iterator_buffer<scalar_t>(v2.data(), num_elements);
+    auto inz = make_host_iterator_buffer<scalar_t>(v3.data(), v3.size());
+    blas_method_def = [=, &ex]() -> std::vector<cl::sycl::event> {
+      launch<scalar_t>(ex, routine, size, inx, iny, inz);
+      return {};
+    };
+  } else {
+    ExecutorType& ex = *executorPtr;
+    auto inx = make_sycl_iterator_buffer<scalar_t>(v1, num_elements);
+    auto iny = make_sycl_iterator_buffer<scalar_t>(v2, num_elements);
+    auto inz = make_sycl_iterator_buffer<scalar_t>(v3, v3.size());
+    blas_method_def = [=, &ex]() -> std::vector<cl::sycl::event> {
+      auto event = launch<scalar_t>(ex, routine, size, inx, iny, inz);
+      ex.get_policy_handler().wait(event);
+      return event;
+    };
+  }
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  executorPtr->get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  // One pool using all the hardware threads, shared by the benchmarks
+  static HostExecutorType host_ex{HostQueue()};
+  HostExecutorType* hostExPtr = &host_ex;
+
+  auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                       HostExecutorType* hostExPtr, routine_t routine,
+                       index_t size, bool on_host, bool* success) {
+    run<scalar_t>(st, exPtr, hostExPtr, routine, size, on_host, success);
+  };
+
+  auto blas1_params = blas_benchmark::utils::get_blas1_params(args);
+  for (auto size : blas1_params) {
+    for (auto routine : {routine_t::axpy, routine_t::dot}) {
+      for (bool on_host : {true, false}) {
+        benchmark::RegisterBenchmark(
+            get_name<scalar_t>(routine, size, on_host).c_str(), BM_lambda,
+            exPtr, hostExPtr, routine, size, on_host, success);
+      }
+    }
+  }
+  for (index_t size = 64; size <= 1024; size *= 2) {
+    for (bool on_host : {true, false}) {
+      benchmark::RegisterBenchmark(
+          get_name<scalar_t>(routine_t::gemm, size, on_host).c_str(),
+          BM_lambda, exPtr, hostExPtr, routine_t::gemm, size, on_host,
+          success);
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,153 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename reduction_single_pass.cpp
+ *
+ **************************************************************************/
+
+#include "sycl_blas.hpp"
+#include "../utils.hpp"
+
+using namespace blas;
+
+const char* get_strategy_name(reduction_strategy_t strategy) {
+  return (strategy == reduction_strategy_t::single_pass) ? "single_pass"
+                                                         : "multi_pass";
+}
+
+template <typename scalar_t>
+std::string get_name(int size, reduction_strategy_t strategy) {
+  std::ostringstream str{};
+  str << "BM_ReductionStrategy<"
+      << blas_benchmark::utils::get_type_name<scalar_t>() << ">/" << size
+      << "/" << get_strategy_name(strategy);
+  return str.str();
+}
+
+template <typename executor_t, typename input_t, typename output_t>
+std::vector<cl::sycl::event> launch_reduction(executor_t& ex, index_t size,
+                                              input_t buffer_in,
+                                              output_t buffer_out,
+                                              reduction_strategy_t strategy) {
+  auto vx = make_vector_view(ex, buffer_in, 1, size);
+  auto rs = make_vector_view(ex, buffer_out, 1, 1);
+  const auto localSize = ex.get_policy_handler().get_work_group_size();
+  const auto nWG = 2 * localSize;
+  auto assignOp = make_AssignReduction<AddOperator>(rs, vx, localSize,
+                                                    localSize * nWG);
+  return ex.execute(assignOp, strategy);
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size,
+         reduction_strategy_t strategy, bool* success) {
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  state.counters["size"] = size_d;
+  state.counters["n_fl_ops"] = size_d;
+  state.counters["bytes_processed"] = size_d * sizeof(scalar_t);
+
+  ExecutorType& ex = *executorPtr;
+
+  // Create data
+  std::vector<scalar_t> v1 = blas_benchmark::utils::random_data<scalar_t>(size);
+  scalar_t res;
+
+  auto inx = blas::make_sycl_iterator_buffer<scalar_t>(v1, size);
+  auto inr = blas::make_sycl_iterator_buffer<scalar_t>(&res, 1);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  scalar_t vr_ref = 0;
+  for (index_t i = 0; i < size; i++) {
+    vr_ref += v1[i];
+  }
+  scalar_t vr_temp = 0;
+  {
+    auto vr_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(&vr_temp, 1);
+    auto event = launch_reduction(ex, size, inx, vr_temp_gpu, strategy);
+    ex.get_policy_handler().wait(event);
+  }
+
+  if (!utils::almost_equal<scalar_t>(vr_temp, vr_ref)) {
+    std::ostringstream err_stream;
+    err_stream << "Value mismatch: " << vr_temp << "; expected " << vr_ref;
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  // Number of kernels launched by one reduction
+  size_t num_kernels = 0;
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = launch_reduction(ex, size, inx, inr, strategy);
+    num_kernels = event.size();
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  state.counters["kernels"] = static_cast<double>(num_kernels);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  auto red_params = blas_benchmark::utils::get_blas1_params(args);
+  const reduction_strategy_t strategies[] = {
+      reduction_strategy_t::multi_pass, reduction_strategy_t::single_pass};
+
+  for (auto size : red_params) {
+    for (auto strategy : strategies) {
+      auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                           index_t size, reduction_strategy_t strategy,
+                           bool* success) {
+        run<scalar_t>(st, exPtr, size, strategy, success);
+      };
+      benchmark::RegisterBenchmark(get_name<scalar_t>(size, strategy).c_str(),
+                                   BM_lambda, exPtr, size, strategy, success);
+    }
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
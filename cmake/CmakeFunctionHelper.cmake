@@ -31,6 +31,8 @@ set(index_list "int" )
 #Each data type in a data list determines the container types.
 #The container type for SYCLbackend is BufferIterator<${data}, codeplay_policy>
 set(data_list "${BLAS_DATA_TYPES}")
+# half only enables the mixed precision GEMM configurations
+list(REMOVE_ITEM data_list "half")
 
 ## represent the list of bolean options
 set(boolean_list "true" "false")
@@ -67,6 +69,15 @@ function(set_target_compile_def in_target)
   if(${GEMM_VECTORIZATION_SUPPORT})
     target_compile_definitions(${in_target} PUBLIC GEMM_VECTORIZATION_SUPPORT=1)
   endif()
+  #setting single pass reduction support
+  if(${SINGLE_PASS_REDUCTION_SUPPORT})
+    target_compile_definitions(${in_target} PUBLIC SINGLE_PASS_REDUCTION_SUPPORT=1)
+  endif()
+  #setting the default gemm dispatch table
+  if(GEMM_DISPATCH_TABLE)
+    target_compile_definitions(${in_target} PUBLIC
+      SYCL_BLAS_DEFAULT_GEMM_DISPATCH_TABLE="${GEMM_DISPATCH_TABLE}")
+  endif()
 
 endfunction()
 
@@ -268,11 +279,14 @@ function(generate_blas_gemm_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
 set(gemm_sources "")
 
-# Generates a file for a new GEMM configuration
+# Generates a file for a new GEMM configuration reading A and B of type
+# input_data, writing C of type output_data and accumulating in data
 # Adds the file to gemm_sources
 # If the configuration is not supported by the current settings
 # (e.g. double type not enabled), it's ignored
-function(add_gemm_configuration
+function(add_gemm_mixed_configuration
+  input_data
+  output_data
   data
   wg_size
   double_buffer
@@ -296,6 +310,12 @@ function(add_gemm_configuration
     # Data type not enabled, skip configuration
     return()
   endif()
+  if((NOT ("${input_data}" STREQUAL "${data}") OR
+      NOT ("${output_data}" STREQUAL "${data}")) AND
+     NOT ("half" IN_LIST BLAS_DATA_TYPES))
+    # Mixed precision configurations are only built with half support
+    return()
+  endif()
   if(("${gemm_shape_type}" STREQUAL "tall_skinny") AND NOT GEMM_TALL_SKINNY_SUPPORT)
     # Tall/skinny configurations not enabled, skip
     return()
@@ -305,7 +325,8 @@ function(add_gemm_configuration
       foreach(is_beta_zero ${boolean_list})
         foreach(executor ${executor_list})
             foreach(index ${index_list})
-              set(file_name "${func}_${double_buffer}_${conflict_a}_"
+              set(file_name "${func}_${input_data}_${output_data}_"
+                            "${double_buffer}_${conflict_a}_"
                             "${conflict_b}_${trans_a}_${trans_b}_"
                             "${is_beta_zero}_${gemm_memory_type}_"
                             "${gemm_shape_type}_${gemm_vectorize_type}_"
@@ -347,6 +368,8 @@ function(add_gemm_configuration
                   ${gemm_vectorize_type}
                   ${vector_size}
                   ${batch_type}
+                  ${input_data}
+                  ${output_data}
                 MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
                 DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_gemm_launcher.py
                 WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
@@ -361,6 +384,40 @@ function(add_gemm_configuration
   endforeach(trans_a)
 endfunction()
 
+# Generates a file for a new GEMM configuration whose operands and result are
+# of type data, see add_gemm_mixed_configuration
+function(add_gemm_configuration
+  data
+  wg_size
+  double_buffer
+  conflict_a
+  conflict_b
+  cache_line_size
+  tir
+  tic
+  twr
+  twc
+  tlr
+  tlc
+  item_batch wg_batch
+  gemm_memory_type
+  gemm_shape_type
+  gemm_vectorize_type
+  vector_size
+  batch_type
+)
+  add_gemm_mixed_configuration(
+    "${data}" "${data}" "${data}" ${wg_size} ${double_buffer} ${conflict_a}
+    ${conflict_b} ${cache_line_size} ${tir} ${tic} ${twr} ${twc} ${tlr} ${tlc}
+    ${item_batch} ${wg_batch} ${gemm_memory_type} ${gemm_shape_type}
+    ${gemm_vectorize_type} ${vector_size} ${batch_type})
+  set(gemm_sources "${gemm_sources}" PARENT_SCOPE)
+endfunction()
+
+# The mixed precision configurations of each target read half operands,
+# accumulate in float and write a result of one of these types
+set(half_output_list "float" "cl::sycl::half")
+
 if(${TARGET} STREQUAL "INTEL_GPU")
   set(supported_types
     "float"
@@ -403,6 +460,11 @@ if(${TARGET} STREQUAL "INTEL_GPU")
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 4 4 "no_local" "standard" "full" 4 "interleaved")
   endforeach()
+  foreach(output_data ${half_output_list})
+    add_gemm_mixed_configuration(
+      "cl::sycl::half" "${output_data}" "float" 64 "true" "false" "false"
+      64 4 4 8 8 1 1 1 1 "local" "standard" "full" 4 "strided")
+  endforeach()
 elseif(${TARGET} STREQUAL "RCAR") # need investigation
   set(supported_types
     "float"
@@ -418,6 +480,11 @@ elseif(${TARGET} STREQUAL "RCAR") # need investigation
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 4 4 "no_local" "standard" "full" 4 "interleaved")
   endforeach()
+  foreach(output_data ${half_output_list})
+    add_gemm_mixed_configuration(
+      "cl::sycl::half" "${output_data}" "float" 32 "false" "false" "false"
+      128 4 8 8 4 1 1 1 1 "local" "standard" "full" 4 "strided")
+  endforeach()
 elseif(${TARGET} STREQUAL "ARM_GPU")
   set(supported_types
     "float"
@@ -436,6 +503,11 @@ elseif(${TARGET} STREQUAL "ARM_GPU")
       "${data}" 64 "false" "false" "false"
       64 2 2 4 4 1 1 4 4 "no_local" "standard" "full" 4 "interleaved")
   endforeach()
+  foreach(output_data ${half_output_list})
+    add_gemm_mixed_configuration(
+      "cl::sycl::half" "${output_data}" "float" 64 "false" "false" "false"
+      64 4 4 8 8 1 1 1 1 "no_local" "standard" "full" 4 "strided")
+  endforeach()
 elseif(${TARGET} STREQUAL "POWER_VR")
   set(supported_types
     "float"
@@ -460,6 +532,11 @@ elseif(${TARGET} STREQUAL "POWER_VR")
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 4 4 "no_local" "standard" "full" 4 "interleaved")
   endforeach()
+  foreach(output_data ${half_output_list})
+    add_gemm_mixed_configuration(
+      "cl::sycl::half" "${output_data}" "float" 64 "false" "false" "false"
+      32 4 4 8 8 1 1 1 1 "local" "standard" "full" 1 "strided")
+  endforeach()
 elseif(${TARGET} STREQUAL "AMD_GPU")  # need investigation
   set(supported_types
     "float"
@@ -498,6 +575,11 @@ elseif(${TARGET} STREQUAL "AMD_GPU")  # need investigation
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 4 4 "no_local" "standard" "full" 4 "interleaved")
   endforeach()
+  foreach(output_data ${half_output_list})
+    add_gemm_mixed_configuration(
+      "cl::sycl::half" "${output_data}" "float" 256 "false" "false" "false"
+      64 4 4 16 16 1 1 1 1 "local" "standard" "full" 2 "strided")
+  endforeach()
 else() # default cpu backend
   set(supported_types
     "float"
@@ -521,6 +603,17 @@ else() # default cpu backend
       "${data}" 64 "false" "false" "false"
       64 2 2 4 4 1 1 4 4 "no_local" "standard" "full" 4 "interleaved")
   endforeach()
+  foreach(output_data ${half_output_list})
+    if(NAIVE_GEMM)
+      add_gemm_mixed_configuration(
+        "cl::sycl::half" "${output_data}" "float" 64 "false" "false" "false"
+        64 8 8 8 8 1 1 1 1 "no_local" "naive" "none" 1 "strided")
+    else()
+      add_gemm_mixed_configuration(
+        "cl::sycl::half" "${output_data}" "float" 64 "false" "false" "false"
+        64 2 2 8 8 1 1 1 1 "no_local" "standard" "full" 2 "strided")
+    endif()
+  endforeach()
 endif()
 add_library(${func} OBJECT ${gemm_sources})
 set_target_compile_def(${func})
@@ -592,23 +685,43 @@ endfunction(generate_quantize)
 function (build_library LIB_NAME)
 add_library(${LIB_NAME}
                              $<TARGET_OBJECTS:sycl_policy>
+                             $<TARGET_OBJECTS:host_policy>
+                             $<TARGET_OBJECTS:gemm_dispatch_table>
+                             $<TARGET_OBJECTS:gemm_mixed>
+                             $<TARGET_OBJECTS:gemm_s8>
                              $<TARGET_OBJECTS:quantize>
                              $<TARGET_OBJECTS:axpy>
+                             $<TARGET_OBJECTS:axpy_batched>
+                             $<TARGET_OBJECTS:axpy_dot>
+                             $<TARGET_OBJECTS:axpy_nrm2>
                              $<TARGET_OBJECTS:asum>
                              $<TARGET_OBJECTS:asum_return>
+                             $<TARGET_OBJECTS:asum_future>
                              $<TARGET_OBJECTS:copy>
                              $<TARGET_OBJECTS:dot>
+                             $<TARGET_OBJECTS:dot_batched>
                              $<TARGET_OBJECTS:dot_return>
+                             $<TARGET_OBJECTS:dot_future>
                              $<TARGET_OBJECTS:iamax>
+                             $<TARGET_OBJECTS:iamax_batched>
                              $<TARGET_OBJECTS:iamax_return>
+                             $<TARGET_OBJECTS:iamax_future>
                              $<TARGET_OBJECTS:iamin>
                              $<TARGET_OBJECTS:iamin_return>
+                             $<TARGET_OBJECTS:iamin_future>
                              $<TARGET_OBJECTS:nrm2>
+                             $<TARGET_OBJECTS:nrm2_batched>
                              $<TARGET_OBJECTS:nrm2_return>
+                             $<TARGET_OBJECTS:nrm2_future>
                              $<TARGET_OBJECTS:rot>
                              $<TARGET_OBJECTS:scal>
                              $<TARGET_OBJECTS:swap>
+                             $<TARGET_OBJECTS:xpay>
+                             $<TARGET_OBJECTS:waxpby>
                              $<TARGET_OBJECTS:gemv>
+                             $<TARGET_OBJECTS:gemv_batched>
+                             $<TARGET_OBJECTS:gemv_multi>
+                             $<TARGET_OBJECTS:gemv_quantized>
                              $<TARGET_OBJECTS:ger>
                              $<TARGET_OBJECTS:symv>
                              $<TARGET_OBJECTS:syr>
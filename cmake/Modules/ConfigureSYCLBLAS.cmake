@@ -44,6 +44,12 @@ if("double" IN_LIST BLAS_DATA_TYPES)
   add_definitions(-DBLAS_DATA_TYPE_DOUBLE)
 endif()
 
+# half is only used by the mixed precision GEMM, which reads half operands and
+# accumulates in float, so no other operation is built for it
+if("half" IN_LIST BLAS_DATA_TYPES)
+  add_definitions(-DBLAS_DATA_TYPE_HALF)
+endif()
+
 # If the user has specified a specific workgroup size for tests, pass that on to the compiler
 if(WG_SIZE)
   add_definitions(-DWG_SIZE=${WG_SIZE})
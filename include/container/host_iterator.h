@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename host_iterator.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_HOST_ITERATOR_H
+#define SYCL_BLAS_HOST_ITERATOR_H
+
+#include "blas_meta.h"
+#include "container/blas_iterator.h"
+#include "policy/host_policy.h"
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace blas {
+
+/*!
+ * @brief BufferIterator over host memory, used by the host_policy.
+ *
+ * The memory is either owned by the buffer (make_host_iterator_buffer with a
+ * size) or borrowed from the user (with a pointer), in which case the user
+ * must keep it alive while the iterator is in use.
+ */
+template <typename element_t>
+class BufferIterator<element_t, host_policy> {
+ public:
+  using scalar_t = element_t;
+  using self_t = BufferIterator<scalar_t, host_policy>;
+  using buff_t = typename host_policy::template buffer_t<scalar_t, 1>;
+
+  BufferIterator() : offset_{0}, size_{0}, buffer_{} {}
+
+  BufferIterator(const buff_t& buff, std::ptrdiff_t size,
+                 std::ptrdiff_t offset = 0)
+      : offset_{offset}, size_{size}, buffer_{buff} {}
+
+  template <
+      typename other_scalar_t, typename U = element_t,
+      class = typename std::enable_if<
+          !std::is_const<other_scalar_t>::value ||
+          (std::is_const<other_scalar_t>::value && std::is_const<U>::value &&
+           !std::is_same<U, other_scalar_t>::value)>::type>
+  BufferIterator(const BufferIterator<other_scalar_t, host_policy>& other)
+      : offset_{other.get_offset()},
+        size_{other.get_size() + other.get_offset()},
+        buffer_{other.get_buffer()} {}
+
+  self_t& operator+=(std::ptrdiff_t offset) {
+    offset_ += offset;
+    return *this;
+  }
+
+  self_t operator+(std::ptrdiff_t offset) const {
+    return self_t(buffer_, size_, offset_ + offset);
+  }
+
+  self_t operator-(std::ptrdiff_t offset) const {
+    return self_t(buffer_, size_, offset_ - offset);
+  }
+
+  self_t& operator-=(std::ptrdiff_t offset) {
+    offset_ -= offset;
+    return *this;
+  }
+
+  // Prefix operator (Increment and return value)
+  self_t& operator++() {
+    ++offset_;
+    return *this;
+  }
+
+  // Postfix operator (Return value and increment)
+  self_t operator++(int i) {
+    self_t temp_iterator(*this);
+    offset_ += 1;
+    return temp_iterator;
+  }
+
+  /*!
+   * @brief Number of elements between the offset and the end of the buffer.
+   */
+  std::ptrdiff_t get_size() const { return size_ - offset_; }
+
+  std::ptrdiff_t get_offset() const { return offset_; }
+
+  buff_t get_buffer() const { return buffer_; }
+
+  void set_offset(std::ptrdiff_t offset) { offset_ = offset; }
+
+  /*!
+   * @brief Pointer to the element at the offset.
+   */
+  scalar_t* get_pointer() const { return buffer_.get() + offset_; }
+
+  scalar_t& operator*() = delete;
+
+  scalar_t* operator->() = delete;
+
+ private:
+  std::ptrdiff_t offset_;
+  std::ptrdiff_t size_;
+  buff_t buffer_;
+};
+
+/*!
+ * @brief Helper function to build a host BufferIterator owning its memory
+ * @tparam scalar_t the type of the elements
+ * @tparam index_t the type of the index
+ * @param size the number of elements
+ */
+template <typename scalar_t, typename index_t>
+inline BufferIterator<scalar_t, host_policy> make_host_iterator_buffer(
+    index_t size) {
+  using buff_t = typename host_policy::template buffer_t<scalar_t, 1>;
+  return BufferIterator<scalar_t, host_policy>{
+      buff_t{new scalar_t[size](), std::default_delete<scalar_t[]>()},
+      static_cast<std::ptrdiff_t>(size)};
+}
+
+/*!
+ * @brief Helper function to build a host BufferIterator over user memory,
+ * without copying it
+ * @tparam scalar_t the type of the elements
+ * @tparam index_t the type of the index
+ * @param data the host pointer to the data
+ * @param size the number of elements
+ */
+template <typename scalar_t, typename index_t>
+inline BufferIterator<scalar_t, host_policy> make_host_iterator_buffer(
+    scalar_t* data, index_t size) {
+  using buff_t = typename host_policy::template buffer_t<scalar_t, 1>;
+  return BufferIterator<scalar_t, host_policy>{
+      buff_t{data, [](scalar_t*) {}}, static_cast<std::ptrdiff_t>(size)};
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_HOST_ITERATOR_H
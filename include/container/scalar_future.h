@@ -0,0 +1,166 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename scalar_future.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SCALAR_FUTURE_H
+#define SYCL_BLAS_SCALAR_FUTURE_H
+
+#include "blas_meta.h"
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+template <typename scalar_t, typename index_t>
+struct IndexValueTuple;
+
+/*!
+ * @brief Host array receiving the results of the scalar-returning BLAS 1
+ * routines (_dot, _asum, _nrm2, _iamax and _iamin).
+ *
+ * Each routine called with a ResultArray copies its result to a new slot of
+ * the array and returns a ScalarFuture reading that slot. The storage is
+ * allocated once and keeps the same address for the lifetime of the array, so
+ * that it can stay registered with the device between calls. Several
+ * reductions can therefore be issued back to back and synchronized once.
+ *
+ * The array must outlive the futures reading it. reset() makes all the slots
+ * available again; the futures returned before must not be read afterwards.
+ */
+class ResultArray {
+ public:
+  /*!
+   * @brief Creates an array of capacity_bytes bytes.
+   */
+  explicit ResultArray(size_t capacity_bytes = 4096)
+      : storage_((capacity_bytes + sizeof(std::max_align_t) - 1) /
+                 sizeof(std::max_align_t)),
+        used_bytes_(0) {}
+
+  ResultArray(const ResultArray &) = delete;
+  ResultArray &operator=(const ResultArray &) = delete;
+
+  /*!
+   * @brief Returns a pointer to a new slot able to hold an element_t.
+   * Throws std::length_error when the array is full.
+   */
+  template <typename element_t>
+  element_t *allocate() {
+    const size_t alignment = alignof(element_t);
+    const size_t offset = (used_bytes_ + alignment - 1) / alignment * alignment;
+    if (offset + sizeof(element_t) > get_capacity()) {
+      throw std::length_error(
+          "The result array is full, call reset() once its results have been "
+          "read");
+    }
+    used_bytes_ = offset + sizeof(element_t);
+    return reinterpret_cast<element_t *>(
+        reinterpret_cast<unsigned char *>(storage_.data()) + offset);
+  }
+
+  /*!
+   * @brief Makes all the slots available again.
+   */
+  void reset() { used_bytes_ = 0; }
+
+  size_t get_capacity() const {
+    return storage_.size() * sizeof(std::max_align_t);
+  }
+
+  size_t get_used_bytes() const { return used_bytes_; }
+
+ private:
+  std::vector<std::max_align_t> storage_;
+  size_t used_bytes_;
+};
+
+/*!
+ * @brief Converts the content of a result slot to the value returned to the
+ * user. The index-value tuples of _iamax and _iamin return their index.
+ */
+template <typename stored_t>
+struct ScalarFutureValue {
+  using type = stored_t;
+  static type get(const stored_t &stored) { return stored; }
+};
+
+template <typename index_t, typename value_t>
+struct ScalarFutureValue<IndexValueTuple<index_t, value_t>> {
+  using type = index_t;
+  static type get(const IndexValueTuple<index_t, value_t> &stored) {
+    return stored.get_index();
+  }
+};
+
+/*!
+ * @brief Handle to a scalar result being copied to a ResultArray.
+ *
+ * Reading the value waits only for the copy of this result, not for the
+ * whole queue.
+ * @tparam executor_t the executor which submitted the computation
+ * @tparam stored_t the type of the content of the result slot
+ */
+template <typename executor_t, typename stored_t>
+class ScalarFuture {
+ public:
+  using policy_handler_t =
+      decltype(std::declval<executor_t &>().get_policy_handler());
+  using event_t = typename executor_t::policy_t::event_t;
+  using value_t = typename ScalarFutureValue<stored_t>::type;
+
+  ScalarFuture(policy_handler_t policy_handler, const stored_t *result,
+               event_t event)
+      : policy_handler_(policy_handler), result_(result), event_(event) {}
+
+  /*!
+   * @brief Waits for the copy of the result and returns it.
+   */
+  value_t get() {
+    policy_handler_.wait(event_);
+    return ScalarFutureValue<stored_t>::get(*result_);
+  }
+
+  /*!
+   * @brief Whether the result can be read without waiting.
+   */
+  bool is_ready() const {
+    return executor_t::policy_t::is_complete(event_);
+  }
+
+  /*!
+   * @brief The event of the copy, to be waited on along with other events.
+   */
+  const event_t &get_event() const { return event_; }
+
+ private:
+  policy_handler_t policy_handler_;
+  const stored_t *result_;
+  event_t event_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SCALAR_FUTURE_H
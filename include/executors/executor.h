@@ -49,6 +49,14 @@ class Executor {
       : policy_handler_(policy_handler_t(q)) {}
   inline policy_handler_t get_policy_handler() const { return policy_handler_; }
 
+  /*!
+   * @brief The profiler recording the kernels submitted by the executor, see
+   * KernelProfiler. Only available with the SYCL policy.
+   */
+  inline KernelProfiler &get_profiler() const {
+    return policy_handler_.get_profiler();
+  }
+
   template <typename expression_tree_t>
   typename policy_t::event_t execute(expression_tree_t tree);
 
@@ -71,15 +79,21 @@ class Executor {
   typename policy_t::event_t execute(
       AssignReduction<operator_t, lhs_t, rhs_t> t, local_memory_t scr);
 
+  template <typename operator_t, typename lhs_t, typename rhs_t>
+  typename policy_t::event_t execute(
+      AssignReduction<operator_t, lhs_t, rhs_t> t,
+      reduction_strategy_t strategy);
+
   template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
             bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
             typename element_t, bool is_beta_zero, int GemmMemoryType,
             int GemmAlgorithm, int GemmVectorization, int VectorSize,
-            int BatchType>
+            int BatchType, typename epilogue_t, typename prologue_t>
   typename policy_t::event_t execute(
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm, GemmVectorization, VectorSize, BatchType>
+           GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+           epilogue_t, prologue_t>
           gemm_tree);
 
   // Tall and skinny Gemm specialization
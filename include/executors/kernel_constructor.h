@@ -104,17 +104,19 @@ struct ExpressionTreeFunctor;
 @brief Static function for executing a tree in SYCL.
 @tparam int using_local_memory specifying whether shared memory is enabled.
 @tparam Tree Type of the tree.
-@param q_ SYCL queue.
+@param policy_handler Policy handler owning the SYCL queue, the kernel is
+recorded by its profiler when enabled.
 @param t Tree object.
 @param _localSize Local work group size.
 @param _globalSize Global work size.
 @param _shMem Size in elements of the shared memory (should be zero if
 using_local_memory == false).
 */
-template <int using_local_memory, typename queue_t, typename expression_tree_t>
-static cl::sycl::event execute_tree(queue_t q, expression_tree_t t,
-                                    size_t _localSize, size_t _globalSize,
-                                    size_t _shMem);
+template <int using_local_memory, typename policy_handler_t,
+          typename expression_tree_t>
+static cl::sycl::event execute_tree(policy_handler_t &policy_handler,
+                                    expression_tree_t t, size_t _localSize,
+                                    size_t _globalSize, size_t _shMem);
 
 }  // namespace blas
 
@@ -25,6 +25,8 @@
 #ifndef SYCL_BLAS_BLAS1_INTERFACE_H
 #define SYCL_BLAS_BLAS1_INTERFACE_H
 #include "blas_meta.h"
+#include "container/scalar_future.h"
+#include "policy/routine_scope.h"
 
 namespace blas {
 namespace internal {
@@ -171,6 +173,158 @@ typename executor_t::policy_t::event_t _rot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin);
 
+/**
+ * \brief AXPY_DOT updates y and returns its inner product with z, in a single
+ * pass over the vectors: \f$y = ax + y\f$, \f$rs = y \cdot z\f$.
+ * z must not alias y (use _axpy_nrm2 for the norm of y).
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _vz BufferIterator
+ * @param _incz Increment for the vector Z
+ * @param _rs BufferIterator receiving the inner product
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_dot(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy, container_2_t _vz,
+    increment_t _incz, container_3_t _rs);
+
+/**
+ * \brief AXPY_NRM2 updates y and returns its euclidian norm, in a single pass
+ * over the vectors: \f$y = ax + y\f$, \f$rs = \|y\|_2\f$.
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator receiving the norm
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy_nrm2(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs);
+
+/**
+ * \brief XPAY scales y and adds x to it: \f$y = x + ay\f$.
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _xpay(executor_t &ex, index_t _N,
+                                             container_0_t _vx,
+                                             increment_t _incx,
+                                             element_t _alpha,
+                                             container_1_t _vy,
+                                             increment_t _incy);
+
+/**
+ * \brief WAXPBY writes a linear combination of two vectors to a third one:
+ * \f$w = ax + by\f$.
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _beta scalar
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _vw BufferIterator
+ * @param _incw Increment for the vector W
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _waxpby(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, element_t _beta, container_1_t _vy, increment_t _incy,
+    container_2_t _vw, increment_t _incw);
+
+/**
+ * \brief AXPY on a batch of vectors, \f$y_b = ax_b + y_b\f$.
+ *
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vectors Y
+ * @param _stride_y Distance between two consecutive vectors Y
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stride_x, container_1_t _vy, increment_t _incy,
+    index_t _stride_y, index_t _batch_size);
+
+/**
+ * \brief Inner products of a batch of pairs of vectors.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vectors Y
+ * @param _stride_y Distance between two consecutive vectors Y
+ * @param _rs BufferIterator receiving one result per pair
+ * @param _batch_size Number of pairs of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stride_x, container_1_t _vy, increment_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size);
+
+/**
+ * \brief Euclidean norms of a batch of vectors.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size);
+
+/**
+ * \brief IAMAX on a batch of vectors.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one index/value tuple per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _iamax_batched(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    index_t _stride_x, ContainerI _rs, index_t _batch_size);
+
 /**
  * \brief Compute the inner product of two vectors with extended
     precision accumulation and result.
@@ -229,6 +383,81 @@ template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx, increment_t _incx);
+
+/**
+ * \brief Compute the inner product of two vectors with extended
+    precision accumulation, copying the result to a slot of a ResultArray.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vx BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_0_t>::type> _dot(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, ResultArray &_results);
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum, copying
+ * the result to a slot of a ResultArray.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t,
+             IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+       ResultArray &_results);
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum, copying
+ * the result to a slot of a ResultArray.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t,
+             IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+       ResultArray &_results);
+
+/**
+ * \brief ASUM Takes the sum of the absolute values, copying the result to a
+ * slot of a ResultArray.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_t>::type> _asum(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ResultArray &_results);
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector, copying the result to a
+ * slot of a ResultArray.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_t>::type> _nrm2(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ResultArray &_results);
 }  // namespace internal
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -236,6 +465,7 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _axpy(
     executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy) {
+  RoutineScope routine_scope("axpy");
   return internal::_axpy(ex, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
@@ -257,6 +487,7 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  RoutineScope routine_scope("copy");
   return internal::_copy(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -275,6 +506,7 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _dot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs) {
+  RoutineScope routine_scope("dot");
   return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy,
                         ex.get_policy_handler().get_buffer(_rs));
@@ -292,6 +524,7 @@ typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
+  RoutineScope routine_scope("asum");
   return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_rs));
 }
@@ -307,6 +540,7 @@ typename executor_t::policy_t::event_t _iamax(executor_t &ex, index_t _N,
                                               container_t _vx,
                                               increment_t _incx,
                                               ContainerI _rs) {
+  RoutineScope routine_scope("iamax");
   return internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx, ex.get_policy_handler().get_buffer(_rs));
 }
@@ -322,6 +556,7 @@ typename executor_t::policy_t::event_t _iamin(executor_t &ex, index_t _N,
                                               container_t _vx,
                                               increment_t _incx,
                                               ContainerI _rs) {
+  RoutineScope routine_scope("iamin");
   return internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx, ex.get_policy_handler().get_buffer(_rs));
 }
@@ -342,6 +577,7 @@ typename executor_t::policy_t::event_t _swap(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  RoutineScope routine_scope("swap");
   return internal::_swap(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -358,6 +594,7 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
                                              element_t _alpha,
                                              container_0_t _vx,
                                              increment_t _incx) {
+  RoutineScope routine_scope("scal");
   return internal::_scal(ex, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx);
 }
@@ -374,6 +611,7 @@ typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
+  RoutineScope routine_scope("nrm2");
   return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_rs));
 }
@@ -397,11 +635,216 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _rot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin) {
+  RoutineScope routine_scope("rot");
   return internal::_rot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy, _cos,
                         _sin);
 }
 
+/**
+ * \brief AXPY_DOT updates y and returns its inner product with z, in a single
+ * pass over the vectors: \f$y = ax + y\f$, \f$rs = y \cdot z\f$.
+ * z must not alias y (use _axpy_nrm2 for the norm of y).
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _vz BufferIterator
+ * @param _incz Increment for the vector Z
+ * @param _rs BufferIterator receiving the inner product
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_dot(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy, container_2_t _vz,
+    increment_t _incz, container_3_t _rs) {
+  RoutineScope routine_scope("axpy_dot");
+  return internal::_axpy_dot(ex, _N, _alpha,
+                             ex.get_policy_handler().get_buffer(_vx), _incx,
+                             ex.get_policy_handler().get_buffer(_vy), _incy,
+                             ex.get_policy_handler().get_buffer(_vz), _incz,
+                             ex.get_policy_handler().get_buffer(_rs));
+}
+
+/**
+ * \brief AXPY_NRM2 updates y and returns its euclidian norm, in a single pass
+ * over the vectors: \f$y = ax + y\f$, \f$rs = \|y\|_2\f$.
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator receiving the norm
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy_nrm2(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs) {
+  RoutineScope routine_scope("axpy_nrm2");
+  return internal::_axpy_nrm2(ex, _N, _alpha,
+                              ex.get_policy_handler().get_buffer(_vx), _incx,
+                              ex.get_policy_handler().get_buffer(_vy), _incy,
+                              ex.get_policy_handler().get_buffer(_rs));
+}
+
+/**
+ * \brief XPAY scales y and adds x to it: \f$y = x + ay\f$.
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _xpay(executor_t &ex, index_t _N,
+                                             container_0_t _vx,
+                                             increment_t _incx,
+                                             element_t _alpha,
+                                             container_1_t _vy,
+                                             increment_t _incy) {
+  RoutineScope routine_scope("xpay");
+  return internal::_xpay(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                         _incx, _alpha,
+                         ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/**
+ * \brief WAXPBY writes a linear combination of two vectors to a third one:
+ * \f$w = ax + by\f$.
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _beta scalar
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _vw BufferIterator
+ * @param _incw Increment for the vector W
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _waxpby(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, element_t _beta, container_1_t _vy, increment_t _incy,
+    container_2_t _vw, increment_t _incw) {
+  RoutineScope routine_scope("waxpby");
+  return internal::_waxpby(ex, _N, _alpha,
+                           ex.get_policy_handler().get_buffer(_vx), _incx,
+                           _beta, ex.get_policy_handler().get_buffer(_vy),
+                           _incy, ex.get_policy_handler().get_buffer(_vw),
+                           _incw);
+}
+
+/**
+ * \brief AXPY on a batch of vectors, \f$y_b = ax_b + y_b\f$, in a single
+ * kernel launch. The element k of the vector b of X is at
+ * _vx + b * _stride_x + k * _incx, and likewise for Y.
+ *
+ * @param ex Executor
+ * @param _alpha scalar
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vectors Y
+ * @param _stride_y Distance between two consecutive vectors Y
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stride_x, container_1_t _vy, increment_t _incy,
+    index_t _stride_y, index_t _batch_size) {
+  RoutineScope routine_scope("axpy_batched");
+  return internal::_axpy_batched(
+      ex, _N, _alpha, ex.get_policy_handler().get_buffer(_vx), _incx,
+      _stride_x, ex.get_policy_handler().get_buffer(_vy), _incy, _stride_y,
+      _batch_size);
+}
+
+/**
+ * \brief Inner products of a batch of pairs of vectors, in a single kernel
+ * launch where each work group reduces one pair.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vectors Y
+ * @param _stride_y Distance between two consecutive vectors Y
+ * @param _rs BufferIterator receiving one result per pair
+ * @param _batch_size Number of pairs of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stride_x, container_1_t _vy, increment_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size) {
+  RoutineScope routine_scope("dot_batched");
+  return internal::_dot_batched(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stride_x,
+      ex.get_policy_handler().get_buffer(_vy), _incy, _stride_y,
+      ex.get_policy_handler().get_buffer(_rs), _batch_size);
+}
+
+/**
+ * \brief Euclidean norms of a batch of vectors. The sums of squares are
+ * reduced in one launch, a second one takes their square roots.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size) {
+  RoutineScope routine_scope("nrm2_batched");
+  return internal::_nrm2_batched(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stride_x,
+      ex.get_policy_handler().get_buffer(_rs), _batch_size);
+}
+
+/**
+ * \brief IAMAX on a batch of vectors, in a single kernel launch. The index
+ * of each result is relative to the start of its vector.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one index/value tuple per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _iamax_batched(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    index_t _stride_x, ContainerI _rs, index_t _batch_size) {
+  RoutineScope routine_scope("iamax_batched");
+  return internal::_iamax_batched(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stride_x,
+      ex.get_policy_handler().get_buffer(_rs), _batch_size);
+}
+
 /**
  * \brief Compute the inner product of two vectors with extended
     precision accumulation and result.
@@ -419,6 +862,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  RoutineScope routine_scope("dot");
   return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -431,6 +875,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  RoutineScope routine_scope("iamax");
   return internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx);
 }
@@ -443,6 +888,7 @@ index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  RoutineScope routine_scope("iamin");
   return internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                           _incx);
 }
@@ -459,6 +905,7 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
+  RoutineScope routine_scope("asum");
   return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                          _incx);
 }
@@ -475,9 +922,106 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
+  RoutineScope routine_scope("nrm2");
   return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                          _incx);
 }
 
+/**
+ * \brief Compute the inner product of two vectors with extended
+    precision accumulation, copying the result to a slot of a ResultArray.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vx BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_0_t>::type> _dot(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, ResultArray &_results) {
+  RoutineScope routine_scope("dot");
+  return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+                        ex.get_policy_handler().get_buffer(_vy), _incy,
+                        _results);
+}
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum, copying
+ * the result to a slot of a ResultArray.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t,
+             IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+       ResultArray &_results) {
+  RoutineScope routine_scope("iamax");
+  return internal::_iamax(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                          _incx, _results);
+}
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum, copying
+ * the result to a slot of a ResultArray.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t,
+             IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+       ResultArray &_results) {
+  RoutineScope routine_scope("iamin");
+  return internal::_iamin(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                          _incx, _results);
+}
+
+/**
+ * \brief ASUM Takes the sum of the absolute values, copying the result to a
+ * slot of a ResultArray.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_t>::type> _asum(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ResultArray &_results) {
+  RoutineScope routine_scope("asum");
+  return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                         _incx, _results);
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector, copying the result to a
+ * slot of a ResultArray.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_t>::type> _nrm2(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ResultArray &_results) {
+  RoutineScope routine_scope("nrm2");
+  return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                         _incx, _results);
+}
+
 }  // end namespace blas
 #endif  // SYCL_BLAS_BLAS1_INTERFACE
@@ -25,6 +25,8 @@
 
 #ifndef SYCL_BLAS_BLAS2_INTERFACE_H
 #define SYCL_BLAS_BLAS2_INTERFACE_H
+#include "operations/blas3_trees.h"
+#include "policy/routine_scope.h"
 namespace blas {
 namespace internal {
 /*!
@@ -63,16 +65,135 @@ typename executor_t::policy_t::event_t _gemv(
     increment_t _incy  // The increment for elements in y (nonzero).
 );
 
+/*!
+ @brief Generalised matrix vector product of a rectangular non-symmetric matrix
+ with several vectors.
+
+ Computes y_j = alpha*op(A)*x_j + beta*y_j for the num_vectors columns x_j of X
+ and y_j of Y, reading A once for all of them rather than once per vector.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_multi(
+    executor_t& ex,        // executor_t (sycl, parallel, serial, etc)
+    char _trans,           // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,            // The size of dimension M of the matrix (rows)
+    index_t _N,            // The size of dimension N of the matrix (columns)
+    index_t _num_vectors,  // The number of vectors, columns of X and Y
+    element_t _alpha,      // Scalar parameter Alpha
+    container_0_t _mA,     // An array (LDA,N), with the first m*n elements
+    index_t _lda,          // Specifies the first dimension of a, max(1, m)
+    container_1_t _mX,     // An array (LDX,num_vectors) holding the vectors x
+    index_t _ldx,          // Specifies the first dimension of X
+    element_t _beta,       // Scalar parameter Beta
+    container_2_t _mY,     // An array (LDY,num_vectors) holding the vectors y
+    index_t _ldy           // Specifies the first dimension of Y
+);
+
+/*!
+ @brief Batched generalised matrix vector product, computing
+ y_b = alpha*op(A_b)*x_b + beta*y_b for every b of the batch.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_batched(
+    executor_t& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, index_t _stride_a, container_1_t _vx,
+    increment_t _incx, index_t _stride_x, element_t _beta, container_2_t _vy,
+    increment_t _incy, index_t _stride_y, index_t _batch_size,
+    gemm_batch_type_t _batch_type);
+
+/*!
+ @brief Generalised matrix vector product with a weight-only quantized matrix,
+ y = alpha*op(A)*x + beta*y with A(i, j) = scale[i] * q(i, j), dequantized as
+ the kernels load it.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename increment_t,
+          typename container_3_t>
+typename executor_t::policy_t::event_t _gemv_quantized(
+    executor_t& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _ldq, gemv_weight_t _weight_type,
+    container_1_t _scale, container_2_t _vx, increment_t _incx,
+    element_t _beta, container_3_t _vy, increment_t _incy);
+
+/*!
+ @brief Packs a float matrix into the weights and row scales read by
+ _gemv_quantized.
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_quantize_weights(
+    executor_t& ex, index_t _M, index_t _N, container_0_t _mA, index_t _lda,
+    gemv_weight_t _weight_type, container_1_t _mQ, index_t _ldq,
+    container_2_t _scale);
+
+/*!
+ * @brief Prototype for the internal implementation of the batched GEMV
+ * operation. See documentation in the blas2_interface.hpp file for details.
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gemv_batched_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, index_t _stride_a, container_t1 _vx, increment_t _incx,
+    index_t _stride_x, element_t _beta, container_t2 _vy, increment_t _incy,
+    index_t _stride_y, index_t _batch_size, gemm_batch_type_t _batch_type);
+
+/*!
+ * @brief Prototype for the internal implementation of the GEMV operation on
+ * several vectors. See documentation in the blas2_interface.hpp file for
+ * details.
+ */
+template <uint32_t local_range, transpose_type trn, transpose_type trn_x,
+          typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_impl(
+    Executor& ex, index_t _M, index_t _N, index_t _num_vectors,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _mX,
+    index_t _ldx, element_t _beta, container_t2 _mY, index_t _ldy);
+
 /*!
  * @brief Prototype for the internal implementation of the GEMV operation. See
  * documentation in the blas2_interface.hpp file for details.
  */
 template <uint32_t local_range, uint32_t cache_line_size,
           gemv_memory_t memory_type, transpose_type trn, typename Executor,
-          typename index_t, typename element_t, typename container_t0,
+          typename index_t, typename scalar_t, typename container_t0,
           typename container_t1, typename increment_t, typename container_t2>
 typename Executor::policy_t::event_t _gemv_impl(
-    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    Executor& ex, index_t _M, index_t _N, scalar_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, scalar_t _beta,
+    container_t2 _vy, increment_t _incy);
+
+/*!
+ * @brief Prototype for the internal implementation of the GEMV operation with
+ * a quantized matrix. See documentation in the blas2_interface.hpp file for
+ * details.
+ */
+template <uint32_t local_range, uint32_t cache_line_size,
+          gemv_memory_t memory_type, transpose_type trn, int bits,
+          typename Executor, typename index_t, typename scalar_t,
+          typename container_t0, typename container_t1,
+          typename container_t2, typename increment_t, typename container_t3>
+typename Executor::policy_t::event_t _gemv_quantized_impl(
+    Executor& ex, index_t _M, index_t _N, scalar_t _alpha, container_t0 _mA,
+    index_t _ldq, container_t1 _scale, container_t2 _vx, increment_t _incx,
+    scalar_t _beta, container_t3 _vy, increment_t _incy);
+
+/*!
+ * @brief Prototype for the internal implementation of the SYMV operation. See
+ * documentation in the blas2_interface.hpp file for details.
+ */
+template <int tile_size, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _symv_impl(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy);
 
@@ -250,12 +371,168 @@ typename executor_t::policy_t::event_t inline _gemv(
     // finished, y is overwritten with the updated vector.
     increment_t _incy  // The increment for elements in y (nonzero).
 ) {
+  RoutineScope routine_scope("gemv");
   return internal::_gemv(ex, _trans, _M, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_mA), _lda,
                          ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
 
+/*!
+ @brief Batched generalised matrix vector product.
+
+ Computes, in a single kernel launch:
+
+ y_b = alpha*op(A_b)*x_b + beta*y_b, for 0 <= b < batch_size
+
+ With gemm_batch_type_t::strided, A_b, x_b and y_b start at b times their
+ respective strides. With gemm_batch_type_t::interleaved, the element e of
+ every operand of the batch is stored at e*batch_size + b, the strides are
+ then ignored.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_batched(
+    executor_t& ex,       // executor_t (sycl, parallel, serial, etc)
+    char _trans,          // The transposition of the matrices ('n', 't', 'c')
+    index_t _M,           // The number of rows of each matrix
+    index_t _N,           // The number of columns of each matrix
+    element_t _alpha,     // Scalar parameter Alpha
+    container_0_t _mA,    // The batch of matrices
+    index_t _lda,         // Specifies the first dimension of each matrix
+    index_t _stride_a,    // The distance between two consecutive matrices
+    container_1_t _vx,    // The batch of vectors x
+    increment_t _incx,    // The increment for elements in x (nonzero)
+    index_t _stride_x,    // The distance between two consecutive vectors x
+    element_t _beta,      // Scalar parameter Beta
+    container_2_t _vy,    // The batch of vectors y
+    increment_t _incy,    // The increment for elements in y (nonzero)
+    index_t _stride_y,    // The distance between two consecutive vectors y
+    index_t _batch_size,  // The number of products
+    gemm_batch_type_t _batch_type = gemm_batch_type_t::strided) {
+  RoutineScope routine_scope("gemv_batched");
+  return internal::_gemv_batched(
+      ex, _trans, _M, _N, _alpha, ex.get_policy_handler().get_buffer(_mA),
+      _lda, _stride_a, ex.get_policy_handler().get_buffer(_vx), _incx,
+      _stride_x, _beta, ex.get_policy_handler().get_buffer(_vy), _incy,
+      _stride_y, _batch_size, _batch_type);
+}
+
+/*!
+ @brief Generalised matrix vector product of a rectangular non-symmetric matrix
+ with several vectors.
+
+ Applies the same matrix to the num_vectors columns of X, i.e. computing:
+
+ y_j = alpha*op(A)*x_j + beta*y_j
+
+ The matrix is read once for up to 16 vectors, whereas as many calls to _gemv
+ would read it once per vector.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_multi(
+    executor_t& ex,        // executor_t (sycl, parallel, serial, etc)
+    char _trans,           // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,            // The size of dimension M of the matrix (rows)
+    index_t _N,            // The size of dimension N of the matrix (columns)
+    index_t _num_vectors,  // The number of vectors, columns of X and Y
+    element_t _alpha,      // Scalar parameter Alpha
+    container_0_t _mA,     // An array (LDA,N), with the first m*n elements
+    index_t _lda,          // Specifies the first dimension of a, max(1, m)
+    container_1_t _mX,     // An array (LDX,num_vectors), the vectors x have n
+                           // elements when trans = 'n' and m otherwise
+    index_t _ldx,          // Specifies the first dimension of X
+    element_t _beta,       // Scalar parameter Beta
+    container_2_t _mY,     // An array (LDY,num_vectors), the vectors y have m
+                           // elements when trans = 'n' and n otherwise
+    index_t _ldy           // Specifies the first dimension of Y
+) {
+  RoutineScope routine_scope("gemv_multi");
+  return internal::_gemv_multi(
+      ex, _trans, _M, _N, _num_vectors, _alpha,
+      ex.get_policy_handler().get_buffer(_mA), _lda,
+      ex.get_policy_handler().get_buffer(_mX), _ldx, _beta,
+      ex.get_policy_handler().get_buffer(_mY), _ldy);
+}
+
+/*!
+ @brief Generalised matrix vector product with a weight-only quantized matrix.
+
+ Batch-1 inference is bound by reading the matrix, which takes 4 or 8 times
+ less memory quantized than in float. The kernels compute:
+
+ y = alpha*op(A)*x + beta*y, where A(i, j) = scale[i] * q(i, j)
+
+ The weights q are stored by column, as int8_t values or as int4 values
+ packed two per byte, the rows 2k and 2k+1 of a column sharing a byte. They
+ are produced by _gemv_quantize_weights.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename increment_t,
+          typename container_3_t>
+typename executor_t::policy_t::event_t inline _gemv_quantized(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // The int8_t weights, _ldq*N bytes with int8
+                        // weights and _ldq*N/2 with int4 weights
+    index_t _ldq,       // The first dimension of the weights, at least m
+                        // and even with int4 weights
+    gemv_weight_t _weight_type,  // gemv_weight_t::int8 or int4
+    container_1_t _scale,        // The m scales of the rows of the matrix
+    container_2_t _vx,  // The vector x, n elements when trans = 'n' and m
+                        // otherwise
+    increment_t _incx,  // The increment for elements in x (nonzero)
+    element_t _beta,    // Scalar parameter Beta
+    container_3_t _vy,  // The vector y, m elements when trans = 'n' and n
+                        // otherwise
+    increment_t _incy   // The increment for elements in y (nonzero)
+) {
+  RoutineScope routine_scope("gemv_quantized");
+  return internal::_gemv_quantized(
+      ex, _trans, _M, _N, _alpha, ex.get_policy_handler().get_buffer(_mA),
+      _ldq, _weight_type, ex.get_policy_handler().get_buffer(_scale),
+      ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+      ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/*!
+ @brief Quantizes a float matrix for _gemv_quantized, once before the
+ products.
+
+ The scale of each row is its largest magnitude divided by the largest
+ weight, 127 for int8 and 7 for int4, and the elements of the row are divided
+ by the scale and rounded to the nearest weight. A row of zeros gets a zero
+ scale.
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_quantize_weights(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    container_0_t _mA,  // The float matrix, an array (LDA,N)
+    index_t _lda,       // Specifies the first dimension of a, max(1, m)
+    gemv_weight_t _weight_type,  // gemv_weight_t::int8 or int4
+    container_1_t _mQ,           // The int8_t weights written, see
+                                 // _gemv_quantized for their size
+    index_t _ldq,  // The first dimension of the weights, at least m and even
+                   // with int4 weights
+    container_2_t _scale  // The m scales of the rows written
+) {
+  RoutineScope routine_scope("gemv_quantize_weights");
+  return internal::_gemv_quantize_weights(
+      ex, _M, _N, ex.get_policy_handler().get_buffer(_mA), _lda, _weight_type,
+      ex.get_policy_handler().get_buffer(_mQ), _ldq,
+      ex.get_policy_handler().get_buffer(_scale));
+}
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -281,6 +558,7 @@ typename executor_t::policy_t::event_t inline _trmv(
     container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), output vector X
     increment_t _incx   // !=0 The increment for the elements of X
 ) {
+  RoutineScope routine_scope("trmv");
   return internal::_trmv(ex, _Uplo, _trans, _Diag, _N,
                          ex.get_policy_handler().get_buffer(_mA), _lda,
                          ex.get_policy_handler().get_buffer(_vx), _incx);
@@ -316,6 +594,7 @@ typename executor_t::policy_t::event_t inline _symv(
     container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
     increment_t _incy   // !=0 The increment for the elements of Y
 ) {
+  RoutineScope routine_scope("symv");
   return internal::_symv(ex, _Uplo, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_mA), _lda,
                          ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
@@ -351,6 +630,7 @@ typename executor_t::policy_t::event_t inline _ger(
     container_2_t _mA,  // (_lda, n) array containing A, the output
     index_t _lda        // >max(1, m), Leading dimension of A
 ) {
+  RoutineScope routine_scope("ger");
   return internal::_ger(ex, _M, _N, _alpha,
                         ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy,
@@ -382,6 +662,7 @@ typename executor_t::policy_t::event_t inline _syr(
     container_1_t _mA,  // (_lda, _N) The output matrix
     index_t _lda        // >max(1, _N) The first dimension of _mA
 ) {
+  RoutineScope routine_scope("syr");
   return internal::_syr(ex, _Uplo, _N, _alpha,
                         ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_mA), _lda);
@@ -416,6 +697,7 @@ typename executor_t::policy_t::event_t inline _syr2(
     container_2_t _mA,  // (_lda, _N) The output matrix
     index_t _lda        // >max(1, _N) The first dimension of _mA
 ) {
+  RoutineScope routine_scope("syr2");
   return internal::_syr2(ex, _Uplo, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy,
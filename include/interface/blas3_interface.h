@@ -27,6 +27,8 @@
 #define SYCL_BLAS_BLAS3_INTERFACE_H
 
 #include "operations/blas3_trees.h"
+#include "policy/routine_scope.h"
+#include <vector>
 
 namespace blas {
 namespace internal {
@@ -48,6 +50,21 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc);
 
+/*!
+ * @brief GEMM with alpha and beta read from device memory, so that they can
+ * be produced by previous kernels without synchronizing with the host. As
+ * with host scalars, C is not read when beta is zero.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename policy_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, BufferIterator<element_t, policy_t> _alpha, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb,
+    BufferIterator<element_t, policy_t> _beta, container_2_t _C,
+    index_t _ldc);
+
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm_batched(
@@ -56,6 +73,118 @@ typename executor_t::policy_t::event_t _gemm_batched(
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, index_t batch_size,
     gemm_batch_type_t batch_type = gemm_batch_type_t::strided);
+
+/*!
+ * @brief Strided batched GEMM, where consecutive matrices of A, B and C are
+ * _stridea, _strideb and _stridec elements apart. A stride of 0 for A or B
+ * broadcasts a single matrix to the whole batch.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_strided_batched(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    index_t batch_size);
+
+/*!
+ * @brief Grouped GEMM, computing the problems p of a group of GEMMs of
+ * different sizes in a single kernel. Problem p multiplies the matrix of
+ * _M[p] by _K[p] elements starting at _offseta[p] in a_ with the one of _K[p]
+ * by _N[p] elements starting at _offsetb[p] in b_, into the matrix of _M[p]
+ * by _N[p] elements starting at _offsetc[p] in _C.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped(
+    executor_t& ex, char _TransA, char _TransB, const std::vector<index_t>& _M,
+    const std::vector<index_t>& _N, const std::vector<index_t>& _K,
+    element_t _alpha, container_0_t a_, const std::vector<index_t>& _lda,
+    const std::vector<index_t>& _offseta, container_1_t b_,
+    const std::vector<index_t>& _ldb, const std::vector<index_t>& _offsetb,
+    element_t _beta, container_2_t _C, const std::vector<index_t>& _ldc,
+    const std::vector<index_t>& _offsetc);
+
+/*!
+ * @brief GEMM with stream-K scheduling, where a fixed number of work groups
+ * share the multiply-accumulate iterations of the product evenly instead of
+ * each computing whole blocks of C.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_stream_k(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc);
+
+/*!
+ * @brief GEMM followed by an epilogue fused in the GEMM kernel:
+ * C = activation(alpha * op(A) * op(B) + beta * C + bias), where bias holds
+ * one value per row of C for gemm_bias_t::row and one per column for
+ * gemm_bias_t::column (it is not read for gemm_bias_t::none).
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_ex(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, gemm_bias_t bias_type, container_3_t bias,
+    gemm_activation_t activation);
+
+/*!
+ * @brief GEMM of operands scaled as they are loaded by the GEMM kernel:
+ * C = alpha * (op(A) .* scale_a) * (op(B) .* scale_b) + beta * C, where the
+ * scales of an operand hold one value per row of op(X) for gemm_scale_t::row
+ * and one per column for gemm_scale_t::column (gemm_scale_t::none leaves the
+ * operand as it is and does not read its scales).
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_scaled(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    gemm_scale_t scale_a_type, container_3_t scale_a, container_1_t b_,
+    index_t _ldb, gemm_scale_t scale_b_type, container_3_t scale_b,
+    element_t _beta, container_2_t _C, index_t _ldc);
+
+/*!
+ * @brief GEMM whose operands, accumulator and result have separate types:
+ * A and B are read in the type of container_0_t and container_1_t, the
+ * products are accumulated in element_t, the type of alpha and beta, and C is
+ * read and written in the type of container_2_t. It is compiled for half
+ * operands accumulated in float with a float or a half C, when half is in
+ * BLAS_DATA_TYPES.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_mixed(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc);
+
+/*!
+ * @brief Quantized GEMM of int8 A and B, whose products are accumulated in
+ * int32 and requantized to the type of C, int8 or float:
+ * C = scale * op(A) * op(B) + zero_point, rounded and saturated for an int8 C.
+ * The float scales and int32 zero points hold one value for
+ * gemm_quantization_t::per_tensor, one per row of C for per_row and one per
+ * column for per_column. A and B are symmetrically quantized, without zero
+ * points of their own.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_s8(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    container_2_t _C, index_t _ldc, gemm_quantization_t quantization_type,
+    container_3_t scale, container_4_t zero_point);
 }  // namespace internal
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -67,6 +196,7 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _lda, container_1_t b_,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc) {
+  RoutineScope routine_scope("gemm");
   return internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha,
                          ex.get_policy_handler().get_buffer(a_), _lda,
                          ex.get_policy_handler().get_buffer(b_), _ldb, _beta,
@@ -81,11 +211,131 @@ typename executor_t::policy_t::event_t _gemm_batched(
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, index_t batch_size,
     gemm_batch_type_t batch_type = gemm_batch_type_t::strided) {
+  RoutineScope routine_scope("gemm_batched");
   return internal::_gemm_batched(ex, _TransA, _TransB, _M, _N, _K, _alpha,
                                  ex.get_policy_handler().get_buffer(a_), _lda,
                                  ex.get_policy_handler().get_buffer(b_), _ldb,
                                  _beta, ex.get_policy_handler().get_buffer(_C),
                                  _ldc, batch_size, batch_type);
 }
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_strided_batched(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    index_t batch_size) {
+  RoutineScope routine_scope("gemm_strided_batched");
+  return internal::_gemm_strided_batched(
+      ex, _TransA, _TransB, _M, _N, _K, _alpha,
+      ex.get_policy_handler().get_buffer(a_), _lda, _stridea,
+      ex.get_policy_handler().get_buffer(b_), _ldb, _strideb, _beta,
+      ex.get_policy_handler().get_buffer(_C), _ldc, _stridec, batch_size);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped(
+    executor_t& ex, char _TransA, char _TransB, const std::vector<index_t>& _M,
+    const std::vector<index_t>& _N, const std::vector<index_t>& _K,
+    element_t _alpha, container_0_t a_, const std::vector<index_t>& _lda,
+    const std::vector<index_t>& _offseta, container_1_t b_,
+    const std::vector<index_t>& _ldb, const std::vector<index_t>& _offsetb,
+    element_t _beta, container_2_t _C, const std::vector<index_t>& _ldc,
+    const std::vector<index_t>& _offsetc) {
+  RoutineScope routine_scope("gemm_grouped");
+  return internal::_gemm_grouped(
+      ex, _TransA, _TransB, _M, _N, _K, _alpha,
+      ex.get_policy_handler().get_buffer(a_), _lda, _offseta,
+      ex.get_policy_handler().get_buffer(b_), _ldb, _offsetb, _beta,
+      ex.get_policy_handler().get_buffer(_C), _ldc, _offsetc);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_stream_k(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  RoutineScope routine_scope("gemm_stream_k");
+  return internal::_gemm_stream_k(ex, _TransA, _TransB, _M, _N, _K, _alpha,
+                                  ex.get_policy_handler().get_buffer(a_), _lda,
+                                  ex.get_policy_handler().get_buffer(b_), _ldb,
+                                  _beta, ex.get_policy_handler().get_buffer(_C),
+                                  _ldc);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_ex(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, gemm_bias_t bias_type, container_3_t bias,
+    gemm_activation_t activation = gemm_activation_t::none) {
+  RoutineScope routine_scope("gemm_ex");
+  return internal::_gemm_ex(ex, _TransA, _TransB, _M, _N, _K, _alpha,
+                            ex.get_policy_handler().get_buffer(a_), _lda,
+                            ex.get_policy_handler().get_buffer(b_), _ldb,
+                            _beta, ex.get_policy_handler().get_buffer(_C),
+                            _ldc, bias_type,
+                            ex.get_policy_handler().get_buffer(bias),
+                            activation);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_scaled(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    gemm_scale_t scale_a_type, container_3_t scale_a, container_1_t b_,
+    index_t _ldb, gemm_scale_t scale_b_type, container_3_t scale_b,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  RoutineScope routine_scope("gemm_scaled");
+  return internal::_gemm_scaled(
+      ex, _TransA, _TransB, _M, _N, _K, _alpha,
+      ex.get_policy_handler().get_buffer(a_), _lda, scale_a_type,
+      ex.get_policy_handler().get_buffer(scale_a),
+      ex.get_policy_handler().get_buffer(b_), _ldb, scale_b_type,
+      ex.get_policy_handler().get_buffer(scale_b), _beta,
+      ex.get_policy_handler().get_buffer(_C), _ldc);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_mixed(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  RoutineScope routine_scope("gemm_mixed");
+  return internal::_gemm_mixed(ex, _TransA, _TransB, _M, _N, _K, _alpha,
+                               ex.get_policy_handler().get_buffer(a_), _lda,
+                               ex.get_policy_handler().get_buffer(b_), _ldb,
+                               _beta, ex.get_policy_handler().get_buffer(_C),
+                               _ldc);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_s8(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    container_2_t _C, index_t _ldc, gemm_quantization_t quantization_type,
+    container_3_t scale, container_4_t zero_point) {
+  RoutineScope routine_scope("gemm_s8");
+  return internal::_gemm_s8(
+      ex, _TransA, _TransB, _M, _N, _K, ex.get_policy_handler().get_buffer(a_),
+      _lda, ex.get_policy_handler().get_buffer(b_), _ldb,
+      ex.get_policy_handler().get_buffer(_C), _ldc, quantization_type,
+      ex.get_policy_handler().get_buffer(scale),
+      ex.get_policy_handler().get_buffer(zero_point));
+}
 }  // namespace blas
 #endif  // SYCL_BLAS_BLAS3_INTERFACE
@@ -0,0 +1,268 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_dispatch_table.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GEMM_DISPATCH_TABLE_H
+#define SYCL_BLAS_BLAS3_GEMM_DISPATCH_TABLE_H
+
+#include "operations/blas3_trees.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Returns the name identifying a GEMM configuration in a dispatch
+ * table, e.g. "local_standard_full_vs4_cl64_db1_nca0_ncb0_t4x4_wg8x8". The
+ * auto-tuner prints the same name for the configurations it measures.
+ */
+std::string get_gemm_config_name(gemm_memory_t memory,
+                                 gemm_algorithm_t algorithm,
+                                 gemm_vectorization_t vectorization,
+                                 int vector_size, int cl_size,
+                                 bool double_buffer, bool nbc_a, bool nbc_b,
+                                 int item_rows, int item_cols, int wg_rows,
+                                 int wg_cols);
+
+/*!
+ * @brief Row of a GEMM dispatch table. A GEMM matches the row when it runs
+ * on the device, has the same transposes and its sizes are not larger than
+ * the maximum sizes of the row. Empty strings and negative sizes match
+ * anything.
+ */
+struct GemmDispatchRule {
+  std::string device;
+  std::string trans_a;
+  std::string trans_b;
+  int64_t max_m;
+  int64_t max_n;
+  int64_t max_k;
+  int64_t max_batch_size;
+  std::string config;
+};
+
+/*!
+ * @brief Maps the shape of a GEMM to the name of the configuration running
+ * it, in place of the thresholds of the backend selected with TARGET.
+ *
+ * A table is a text file with one rule per line:
+ *
+ *     device trans_a trans_b max_m max_n max_k max_batch_size config
+ *
+ * where device is a device type name (e.g. intel_gpu, see
+ * codeplay_policy::get_device_type_name), the transposes are n or t and '*'
+ * matches anything. Lines starting with '#' are comments. The first matching
+ * rule is used, so the rules should go from the smallest to the largest
+ * sizes. Rules naming a configuration which was not compiled in the library
+ * are skipped and the GEMM falls back to the backend thresholds.
+ *
+ * The default table is read from the file named by the
+ * SYCL_BLAS_GEMM_DISPATCH_TABLE environment variable or, when it is not set,
+ * from the GEMM_DISPATCH_TABLE file given to CMake.
+ *
+ * The table is looked up by every GEMM, and changed rarely: the lookups read
+ * an immutable snapshot of the rules without locking, and return at once
+ * when the table is empty.
+ */
+class GemmDispatchTable {
+ public:
+  static constexpr const char* env_var = "SYCL_BLAS_GEMM_DISPATCH_TABLE";
+
+  GemmDispatchTable();
+
+  /*!
+   * @brief The table used by the GEMM routines, loaded on first use with
+   * load_default.
+   */
+  static GemmDispatchTable& get_default();
+
+  /*!
+   * @brief Replaces the rules with the default table file, see
+   * SYCL_BLAS_GEMM_DISPATCH_TABLE. A file which cannot be read or parsed is
+   * reported on std::cerr and the table is left empty.
+   */
+  void load_default();
+
+  /*!
+   * @brief Appends the rules of a table. Throws std::invalid_argument on a
+   * malformed line.
+   */
+  void load(std::istream& input);
+
+  /*!
+   * @brief Appends the rules of a table file. Throws std::runtime_error if
+   * the file cannot be read.
+   */
+  void load_file(const std::string& path);
+
+  void add_rule(const GemmDispatchRule& rule);
+
+  void clear();
+
+  size_t size() const;
+
+  bool empty() const { return size() == 0; }
+
+  /*!
+   * @brief Returns the configuration of the first matching rule, or an empty
+   * string.
+   */
+  std::string find(const std::string& device, bool trans_a, bool trans_b,
+                   int64_t m, int64_t n, int64_t k, int64_t batch_size) const;
+
+ private:
+  using rules_t = std::vector<GemmDispatchRule>;
+
+  /* Publishes a new snapshot of the rules. mutex_ must be held */
+  void set_rules(std::shared_ptr<const rules_t> rules);
+
+  /* Serializes the changes of the rules, the lookups do not take it */
+  std::mutex mutex_;
+  std::shared_ptr<const rules_t> rules_;
+  std::atomic<size_t> size_;
+};
+
+/*!
+ * @brief Picks the configuration of the GEMM shapes which no rule of the
+ * dispatch table covers by timing the compiled configurations.
+ *
+ * The first call of a new shape runs with the backend thresholds and queues
+ * the timing of the candidates on a background thread, on temporary operands
+ * of the same size and on a queue of their own. The fastest candidate is
+ * then used by the following calls of the shape. The timings of two shapes
+ * start at least get_min_interval() apart, so that a stream of new shapes
+ * does not keep the device busy. The timing is disabled by default and
+ * enabled by setting the SYCL_BLAS_GEMM_ONLINE_TUNING environment variable to
+ * 1, or with set_enabled.
+ */
+class GemmOnlineTuner {
+ public:
+  static constexpr const char* env_var = "SYCL_BLAS_GEMM_ONLINE_TUNING";
+
+  using interval_t = std::chrono::milliseconds;
+
+  static constexpr interval_t default_min_interval = interval_t(1000);
+
+  /*!
+   * @brief Times the candidates of a shape, returns the fastest one or an
+   * empty string.
+   */
+  using task_t = std::function<std::string()>;
+
+  GemmOnlineTuner() = default;
+
+  GemmOnlineTuner(const GemmOnlineTuner&) = delete;
+  GemmOnlineTuner& operator=(const GemmOnlineTuner&) = delete;
+
+  /*!
+   * @brief Waits for the shape being timed, the queued ones are dropped.
+   */
+  ~GemmOnlineTuner();
+
+  /*!
+   * @brief The tuner used by the GEMM routines.
+   */
+  static GemmOnlineTuner& get_default();
+
+  /*!
+   * @brief Key of a GEMM shape in the cache of the tuner.
+   */
+  static std::string get_key(const std::string& device, bool trans_a,
+                             bool trans_b, int64_t m, int64_t n, int64_t k,
+                             int64_t batch_size, size_t element_size);
+
+  void set_enabled(bool enabled);
+
+  bool is_enabled() const;
+
+  void set_min_interval(interval_t min_interval);
+
+  interval_t get_min_interval() const;
+
+  /*!
+   * @brief Returns, without locking, whether the tuner is enabled or knows
+   * the configuration of some shapes. The GEMM routines do not build the key
+   * of their shape otherwise.
+   */
+  bool is_active() const { return active_; }
+
+  /*!
+   * @brief Returns the configuration chosen for the shape, or an empty string
+   * if it is not known yet. When the shape is new, it is reserved and
+   * must_tune is set: the caller must then submit the task timing it.
+   */
+  std::string find(const std::string& key, bool& must_tune);
+
+  /*!
+   * @brief Queues the task timing the candidates of a reserved shape.
+   */
+  void submit(const std::string& key, task_t task);
+
+  /*!
+   * @brief Blocks until all the queued shapes have been timed.
+   */
+  void wait();
+
+  /*!
+   * @brief Forgets the shapes timed so far, after waiting for the queued
+   * ones.
+   */
+  void clear();
+
+ private:
+  void run();
+
+  /* Updates active_. mutex_ must be held */
+  void update_active();
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  bool enabled_ = false;
+  std::atomic<bool> active_{false};
+  bool stop_ = false;
+  interval_t min_interval_ = default_min_interval;
+  // Start of the last timing
+  std::chrono::steady_clock::time_point last_start_;
+  size_t running_ = 0;
+  // Chosen configuration of the shapes, empty while they are being timed
+  std::unordered_map<std::string, std::string> configs_;
+  std::deque<std::pair<std::string, task_t>> tasks_;
+  std::thread worker_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMM_DISPATCH_TABLE_H
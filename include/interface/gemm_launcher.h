@@ -42,10 +42,24 @@ template <int WgSize, bool DoubleBuffer, bool ConflictA, bool ConflictB,
 struct Gemm_Launcher {
   template <typename executor_t, typename container_0_t, typename container_1_t,
             typename container_2_t, typename element_t, typename index_t>
+  static typename executor_t::policy_t::event_t _select_gemm(
+      executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+      container_0_t a_, index_t _lda, index_t _stridea, container_1_t b_,
+      index_t _ldb, index_t _strideb, element_t _beta, container_2_t _C,
+      index_t _ldc, index_t _stridec, index_t batch_size);
+
+  /*!
+   * @brief Launches a single GEMM applying the given epilogue to C and the
+   * given prologue to A and B, see GemmEpilogue and GemmPrologue
+   */
+  template <typename executor_t, typename container_0_t, typename container_1_t,
+            typename container_2_t, typename element_t, typename index_t,
+            typename epilogue_t, typename prologue_t>
   static typename executor_t::policy_t::event_t _select_gemm(
       executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
       container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
-      element_t _beta, container_2_t _C, index_t _ldc, index_t batch_size);
+      element_t _beta, container_2_t _C, index_t _ldc, epilogue_t epilogue,
+      prologue_t prologue);
 };
 
 }  // namespace blas
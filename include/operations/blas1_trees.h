@@ -44,6 +44,7 @@ struct Join {
 
   Join(lhs_t &_l, rhs_t _r);
   index_t get_size() const;
+  bool valid_thread(index_t i) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -61,6 +62,7 @@ struct Assign {
   rhs_t rhs_;
   Assign(lhs_t &_l, rhs_t _r);
   index_t get_size() const;
+  bool valid_thread(index_t i) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -81,6 +83,7 @@ struct DoubleAssign {
   rhs_2_t rhs_2_;
   DoubleAssign(lhs_1_t &_l1, lhs_2_t &_l2, rhs_1_t _r1, rhs_2_t _r2);
   index_t get_size() const;
+  bool valid_thread(index_t i) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -100,6 +103,7 @@ struct ScalarOp {
   rhs_t rhs_;
   ScalarOp(scalar_t _scl, rhs_t &_r);
   index_t get_size() const;
+  bool valid_thread(index_t i) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -107,6 +111,30 @@ struct ScalarOp {
   void adjust_access_displacement();
 };
 
+/*! DeviceScalar.
+ * @brief Leaf reading a scalar which lives in device memory (e.g. the result
+ * of a previous reduction). Used as the scalar of a ScalarOp, the value is
+ * only read inside the kernel so no host synchronization is required.
+ */
+template <typename view_t>
+struct DeviceScalar {
+  using index_t = typename view_t::index_t;
+  using value_t = typename view_t::value_t;
+  view_t view_;
+  DeviceScalar(view_t &_v);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename view_t>
+inline DeviceScalar<view_t> make_device_scalar(view_t &view_) {
+  return DeviceScalar<view_t>(view_);
+}
+
 /*! UnaryOp.
  * Implements a Unary Operation ( operator_t(z), e.g. z++), with z a vector.
  */
@@ -117,6 +145,7 @@ struct UnaryOp {
   rhs_t rhs_;
   UnaryOp(rhs_t &_r);
   index_t get_size() const;
+  bool valid_thread(index_t i) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -135,6 +164,7 @@ struct BinaryOp {
   rhs_t rhs_;
   BinaryOp(lhs_t &_l, rhs_t &_r);
   index_t get_size() const;
+  bool valid_thread(index_t i) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -152,6 +182,7 @@ struct TupleOp {
   rhs_t rhs_;
   TupleOp(rhs_t &_r);
   index_t get_size() const;
+  bool valid_thread(index_t i) const;
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -190,6 +221,118 @@ inline AssignReduction<operator_t, lhs_t, rhs_t> make_AssignReduction(
       lhs_, rhs_, local_num_thread_, global_num_thread_);
 }
 
+/*! AssignReductionSinglePass.
+ * @brief Implements the reduction operation for assignments (in the form y
+ * = x) with y a scalar and x a subexpression tree, in a single kernel launch.
+ * Each work group writes its partial result to partials_ and takes a ticket
+ * from the atomic counter sync_[0], publishing it to its threads through
+ * sync_[1 + group id]. Each work group clears its ticket slot once read, and
+ * the work group taking the last ticket reduces the partial results into
+ * lhs_ and resets the counter, so that the block is left zeroed.
+ * The number of work groups must not be larger than the work group size.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t>
+struct AssignReductionSinglePass {
+  using value_t = typename ResolveReturnType<operator_t, rhs_t>::type::value_t;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  lhs_t partials_;  // one partial result per work group
+  sync_t sync_;     // counter followed by one ticket per work group
+  index_t sync_offset_;
+  index_t local_num_thread_;   // block  size
+  index_t global_num_thread_;  // grid  size
+  AssignReductionSinglePass(lhs_t &_l, rhs_t &_r, lhs_t &_partials,
+                            sync_t &_sync, index_t _syncOffset, index_t _blqS,
+                            index_t _grdS);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t,
+          typename index_t>
+inline AssignReductionSinglePass<operator_t, lhs_t, rhs_t, sync_t>
+make_AssignReductionSinglePass(lhs_t &lhs_, rhs_t &rhs_, lhs_t &partials_,
+                               sync_t &sync_, index_t sync_offset_,
+                               index_t local_num_thread_,
+                               index_t global_num_thread_) {
+  return AssignReductionSinglePass<operator_t, lhs_t, rhs_t, sync_t>(
+      lhs_, rhs_, partials_, sync_, sync_offset_, local_num_thread_,
+      global_num_thread_);
+}
+
+/*! VectorBatch.
+ * @brief Presents the batch_size vectors of vector_size elements held by
+ * vector_ as a single vector of batch_size * vector_size elements, so that the
+ * element-wise trees can combine whole batches. The element k of the vector b
+ * is at b * stride_ + k * inc_ of vector_, which is read as a raw pointer.
+ */
+template <typename vector_t>
+struct VectorBatch {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  vector_t vector_;
+  index_t vector_size_;
+  index_t inc_;
+  index_t stride_;
+  index_t batch_size_;
+  VectorBatch(vector_t &_vector, index_t _vector_size, index_t _inc,
+              index_t _stride, index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(index_t i) const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t &eval(index_t i);
+  value_t &eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename vector_t, typename index_t>
+inline VectorBatch<vector_t> make_vector_batch(vector_t &vector_,
+                                               index_t vector_size_,
+                                               index_t inc_, index_t stride_,
+                                               index_t batch_size_) {
+  return VectorBatch<vector_t>(vector_, vector_size_, inc_, stride_,
+                               batch_size_);
+}
+
+/*! AssignBatchedReduction.
+ * @brief Reduces each of the consecutive blocks of vector_size_ elements of
+ * rhs_, typically trees of VectorBatch, into the matching element of lhs_.
+ * One work group reduces one block, so that the whole batch is reduced by a
+ * single kernel of lhs_.get_size() work groups. The indices of the
+ * IndexValueTuple results are relative to their block.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t>
+struct AssignBatchedReduction {
+  using value_t = typename ResolveReturnType<operator_t, rhs_t>::type::value_t;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  index_t vector_size_;
+  AssignBatchedReduction(lhs_t &_l, rhs_t &_r, index_t _vector_size);
+  index_t get_size() const;
+  bool valid_thread(index_t i) const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <typename sharedT>
+  value_t eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename index_t>
+inline AssignBatchedReduction<operator_t, lhs_t, rhs_t>
+make_AssignBatchedReduction(lhs_t &lhs_, rhs_t &rhs_, index_t vector_size_) {
+  return AssignBatchedReduction<operator_t, lhs_t, rhs_t>(lhs_, rhs_,
+                                                          vector_size_);
+}
+
 /*!
 @brief Template function for constructing operation nodes based on input
 template and function arguments. Non-specialized case for N reference operands.
@@ -33,6 +33,36 @@ namespace blas {
  */
 enum class gemv_memory_t : int { local = 0, no_local = 1 };
 
+/*!
+ * @brief Storage of the weights of a quantized GEMV: int8 values, or int4
+ * values packed two per byte.
+ */
+enum class gemv_weight_t : int { int8 = 0, int4 = 1 };
+
+/*!
+ * @brief Enumerates the blocks of a square grid of num_blocks x num_blocks
+ * blocks which touch one triangle of a matrix, so that the kernels working on
+ * a triangle only launch the work groups which have something to do.
+ *
+ * The blocks (row <= col) of the upper triangle are numbered column by
+ * column, id = col * (col + 1) / 2 + row, and the blocks (row >= col) of the
+ * lower triangle row by row, id = row * (row + 1) / 2 + col.
+ */
+struct TriangularBlocks {
+  /*!
+   * @brief Number of blocks of one triangle, diagonal included.
+   */
+  template <typename index_t>
+  static index_t get_num_blocks(index_t num_blocks);
+
+  /*!
+   * @brief Finds the block of the triangle with the given id.
+   * @tparam is_upper whether the upper or the lower triangle is enumerated
+   */
+  template <bool is_upper, typename index_t>
+  static void get_block(index_t id, index_t &block_row, index_t &block_col);
+};
+
 /*!
  * @brief Gemv is a templated class whose instantiations provide different
  * implementations of the the GEMV kernel function.
@@ -79,10 +109,27 @@ struct Gemv {
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 
+  /*!
+   * @brief Computes the whole dot product of the row nc_dim_index of op(A)
+   * with x, without local memory.
+   */
+  value_t compute_row(index_t nc_dim_index);
+
+  /*!
+   * @brief Computes the dot products of the local_range rows of the block
+   * nc_group_id of op(A) with the block c_group_id of local_range elements of
+   * x. It contains barriers, so every work item of the group must call it.
+   * The work items whose row is out of bounds get 0.
+   */
+  template <typename local_memory_t>
+  value_t compute_block(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem,
+                        index_t nc_group_id, index_t c_group_id);
+
  private:
   template <typename ScratchPointerType>
   void extract_input_block(ScratchPointerType scratch, const index_t &local_id,
-                           const index_t &group_id, const index_t &lda,
+                           const index_t &nc_group_id,
+                           const index_t &c_group_id, const index_t &lda,
                            index_t mat_tile_id);
 };
 
@@ -103,6 +150,311 @@ make_Gemv(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
                                                 wgs_per_nc_, wgs_per_c_);
 }
 
+/*!
+ * @brief GemvSinglePass computes y = alpha * op(A) * x + beta * y in a single
+ * kernel, from the dot products of a Gemv tree.
+ *
+ * Each work group computes local_range elements of y over c_blocks_per_wg_
+ * blocks of local_range elements of x. When a work group covers the whole
+ * of x, alpha and beta are applied directly. Otherwise the work groups write
+ * their partial dot products to the lhs_ of the Gemv tree and take a ticket
+ * from the counter of their block of rows, sync_[sync_offset_ + block]. The
+ * work group taking the last ticket adds up the partial dot products,
+ * applies alpha and beta and resets the counter for the next call.
+ *
+ * @tparam is_beta_zero  whether y is only written, as BLAS requires for beta
+ *                       equal to zero. A device beta is compared with zero
+ *                       in the kernel to the same effect
+ * @param gemv_  the Gemv tree computing the dot products, its lhs_ holds the
+ *               partial dot products when x is split across work groups
+ * @param lhs_   the vector y
+ */
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+struct GemvSinglePass {
+  using value_t = typename gemv_t::value_t;
+  using index_t = typename gemv_t::index_t;
+  gemv_t gemv_;
+  lhs_t lhs_;
+  alpha_t alpha_;
+  beta_t beta_;
+  sync_t sync_;
+  index_t sync_offset_;
+  index_t c_blocks_per_wg_;
+
+  GemvSinglePass(gemv_t &_gemv, lhs_t &_l, alpha_t _alpha, beta_t _beta,
+                 sync_t &_sync, index_t _sync_offset,
+                 index_t _c_blocks_per_wg);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  void write_result(index_t i, value_t dot_product);
+};
+
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t, sync_t>
+make_GemvSinglePass(gemv_t &gemv_, lhs_t &lhs_, alpha_t alpha_, beta_t beta_,
+                    sync_t &sync_, typename gemv_t::index_t sync_offset_,
+                    typename gemv_t::index_t c_blocks_per_wg_) {
+  return GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t, sync_t>(
+      gemv_, lhs_, alpha_, beta_, sync_, sync_offset_, c_blocks_per_wg_);
+}
+
+/*!
+ * @brief QuantizedMatrix is a column-major matrix operand of Gemv whose
+ * weights are quantized symmetrically per row, A(i, j) = scale[i] * q(i, j).
+ * Gemv dequantizes the weights as it loads them, so that only the quantized
+ * matrix is read from global memory.
+ *
+ * With 8 bits, q(i, j) is the byte i + j * ld_ of weights_. With 4 bits, the
+ * rows 2k and 2k + 1 of a column share a byte, in its low and high nibbles:
+ * ld_ is even and a column takes ld_ / 2 bytes.
+ *
+ * @tparam bits  the number of bits of a weight, 8 or 4
+ * @param weights_  the int8_t buffer of the packed weights
+ * @param scales_  the buffer of the scales of the rows
+ */
+template <int bits, typename weights_t, typename scales_t>
+struct QuantizedMatrix {
+  using value_t = typename std::remove_cv<typename scales_t::value_t>::type;
+  using index_t = typename scales_t::index_t;
+
+  weights_t weights_;
+  scales_t scales_;
+  index_t rows_;
+  index_t cols_;
+  index_t ld_;
+
+  QuantizedMatrix(weights_t &_weights, scales_t &_scales, index_t _rows,
+                  index_t _cols, index_t _ld);
+  index_t get_size() const;
+  index_t get_size_row() const;
+  index_t get_size_col() const;
+  index_t getSizeL() const;
+
+  /*!
+   * @brief Dequantized element at the position index = i + j * ld_. Its row
+   * i is given by the caller, which already knows it, to find the scale.
+   */
+  value_t eval(index_t index, index_t row);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <int bits, typename weights_t, typename scales_t, typename index_t>
+QuantizedMatrix<bits, weights_t, scales_t> make_quantized_matrix(
+    weights_t &weights_, scales_t &scales_, index_t rows_, index_t cols_,
+    index_t ld_) {
+  return QuantizedMatrix<bits, weights_t, scales_t>(weights_, scales_, rows_,
+                                                    cols_, ld_);
+}
+
+/*!
+ * @brief GemvQuantizeWeights packs a float matrix into the layout of a
+ * QuantizedMatrix. Each work item quantizes the 8 / bits rows sharing the
+ * bytes of a column: the scale of a row is its largest magnitude divided by
+ * the largest weight, 127 or 7, and the weights are rounded to the nearest.
+ * Rows of zeros get a zero scale.
+ *
+ * @tparam bits  the number of bits of a weight, 8 or 4
+ * @param matrix_  the float matrix, column-major
+ * @param weights_  the int8_t buffer receiving the packed weights
+ * @param scales_  the buffer receiving the scales of the rows
+ * @param ld_  the leading dimension of the quantized matrix, in weights
+ */
+template <int bits, typename matrix_t, typename weights_t, typename scales_t>
+struct GemvQuantizeWeights {
+  using value_t = typename std::remove_cv<typename scales_t::value_t>::type;
+  using index_t = typename scales_t::index_t;
+  static constexpr int rows_per_byte = 8 / bits;
+
+  matrix_t matrix_;
+  weights_t weights_;
+  scales_t scales_;
+  index_t ld_;
+
+  GemvQuantizeWeights(matrix_t &_matrix, weights_t &_weights,
+                      scales_t &_scales, index_t _ld);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <int bits, typename matrix_t, typename weights_t, typename scales_t,
+          typename index_t>
+GemvQuantizeWeights<bits, matrix_t, weights_t, scales_t>
+make_gemv_quantize_weights(matrix_t &matrix_, weights_t &weights_,
+                           scales_t &scales_, index_t ld_) {
+  return GemvQuantizeWeights<bits, matrix_t, weights_t, scales_t>(
+      matrix_, weights_, scales_, ld_);
+}
+
+/*!
+ * @brief GemvMulti computes Y = alpha * op(A) * X + beta * Y for a few
+ * vectors at once, the columns of X and Y, reading op(A) a single time.
+ *
+ * Without transposition each work item computes one row of Y and keeps the
+ * max_vectors dot products of its row in registers. The work group stages
+ * blocks of local_range rows of X in local memory, so that the work items
+ * only read A from global memory, one coalesced column at a time.
+ *
+ * When A is transposed the rows of op(A) are the columns of A, which are
+ * contiguous: each work group computes one row of Y, its work items going
+ * through the row together and the max_vectors partial dot products of each
+ * work item being reduced in local memory.
+ *
+ * @tparam local_range  the number of work items of a work group
+ * @tparam max_vectors  the number of dot products each work item keeps in
+ *                      registers, at least the number of columns of Y
+ * @tparam is_transposed  whether op(A) is the transpose of A
+ * @tparam is_beta_zero  whether Y is only written
+ * @param lhs_  the matrix Y, one column per vector
+ * @param matrix_  the matrix A, column-major
+ * @param rhs_  the matrix X, one column per vector
+ */
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+struct GemvMulti {
+  using value_t = typename std::remove_cv<typename rhs_t::value_t>::type;
+  using index_t = typename rhs_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  rhs_t rhs_;
+  alpha_t alpha_;
+  beta_t beta_;
+
+  GemvMulti(lhs_t &_l, matrix_t &_matrix, rhs_t &_r, alpha_t _alpha,
+            beta_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+
+  /*!
+   * @brief Number of work groups needed for the nc_dim rows of Y.
+   */
+  static index_t get_num_work_groups(index_t nc_dim);
+
+  /*!
+   * @brief Number of elements of local memory used by a work group, a block
+   * of X or the partial dot products of the work items.
+   */
+  static constexpr index_t get_local_memory_size() {
+    return local_range * max_vectors;
+  }
+
+ private:
+  void write_result(index_t row, index_t col, value_t dot_product);
+};
+
+/*!
+ * @brief Constructs a GemvMulti tree, see GemvMulti for the parameters.
+ */
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t, beta_t>
+make_GemvMulti(lhs_t &lhs_, matrix_t &matrix_, rhs_t &rhs_, alpha_t alpha_,
+               beta_t beta_) {
+  return GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero,
+                   lhs_t, matrix_t, rhs_t, alpha_t, beta_t>(
+      lhs_, matrix_, rhs_, alpha_, beta_);
+}
+
+/*!
+ * @brief GemvBatched computes y_b = alpha * op(A_b) * x_b + beta * y_b for
+ * batch_size_ independent GEMVs in a single kernel, each work item computing
+ * one element of one y_b.
+ *
+ * With the strided batch type the matrices and vectors of the batch are
+ * stride_a_, stride_x_ and stride_y_ elements apart. With the interleaved
+ * batch type, as in the interleaved GEMM, the batch is the fastest moving
+ * dimension: element e of the b-th operand is at e * batch_size_ + b and the
+ * strides are not used. The work items of a work group then go through
+ * consecutive elements of the batch, which makes every access contiguous
+ * whether A is transposed or not.
+ *
+ * @tparam is_transposed  whether op(A_b) is the transpose of A_b
+ * @tparam is_beta_zero  whether the vectors y_b are only written
+ * @tparam batch_type  a gemm_batch_type_t, the layout of the batch
+ * @param lhs_  the buffer of the vectors y_b
+ * @param matrix_  the buffer of the matrices A_b, column-major
+ * @param vector_  the buffer of the vectors x_b
+ */
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+struct GemvBatched {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  alpha_t alpha_;
+  beta_t beta_;
+  index_t m_;
+  index_t n_;
+  index_t lda_;
+  index_t stride_a_;
+  index_t inc_x_;
+  index_t stride_x_;
+  index_t inc_y_;
+  index_t stride_y_;
+  index_t batch_size_;
+
+  GemvBatched(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, alpha_t _alpha,
+              beta_t _beta, index_t _m, index_t _n, index_t _lda,
+              index_t _stride_a, index_t _inc_x, index_t _stride_x,
+              index_t _inc_y, index_t _stride_y, index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  /*!
+   * @brief Position in its buffer of the element at the given offset from the
+   * start of the operand of the batch number batch.
+   */
+  index_t get_position(index_t batch, index_t offset, index_t stride) const;
+};
+
+/*!
+ * @brief Constructs a GemvBatched tree, see GemvBatched for the parameters.
+ */
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t, typename index_t>
+GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t,
+            vector_t, alpha_t, beta_t>
+make_GemvBatched(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+                 alpha_t alpha_, beta_t beta_, index_t m_, index_t n_,
+                 index_t lda_, index_t stride_a_, index_t inc_x_,
+                 index_t stride_x_, index_t inc_y_, index_t stride_y_,
+                 index_t batch_size_) {
+  return GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t,
+                     vector_t, alpha_t, beta_t>(
+      lhs_, matrix_, vector_, alpha_, beta_, m_, n_, lda_, stride_a_, inc_x_,
+      stride_x_, inc_y_, stride_y_, batch_size_);
+}
+
 template <typename rhs_t>
 struct SumMatrixColumns {
   using value_t = typename rhs_t::value_t;
@@ -148,6 +500,12 @@ struct GemvCol {
   index_t nWG_row_;
   index_t nWG_col_;
   index_t local_memory_size_;
+  /*!
+   * When a triangle is ignored, only the nWG_row_ * (nWG_row_ + 1) / 2 blocks
+   * of the other one are launched (see TriangularBlocks) and nWG_col_ must be
+   * equal to nWG_row_.
+   */
+  static constexpr bool is_triangular = !Lower || !Upper;
 
   GemvCol(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, index_t &_nWG_row,
           index_t &_nWG_col, index_t &_shrMemSize);
@@ -227,6 +585,69 @@ make_Gemv_Row(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
                            local_memory_size_);
 }
 
+/*!
+ * @brief Symmetric matrix vector product reading each stored tile of the
+ * matrix once.
+ *
+ * The stored triangle is cut in tile_size x tile_size tiles and each work
+ * group loads one of them in local memory. An off-diagonal tile A_ij is used
+ * both for the rows of block i (as A_ij) and for the rows of block j (as
+ * A_ji), a diagonal tile is mirrored in local memory. The partial sums are
+ * written to lhs_, a N x num_blocks column-major matrix in which each row
+ * receives exactly one partial sum per block of columns, so that summing the
+ * columns of lhs_ gives A * x without atomics.
+ *
+ * @tparam tile_size  the dimension of the tiles, also the number of work items
+ *                    of a work group
+ * @tparam is_upper  whether the upper or the lower triangle is stored
+ * @param lhs_  the N x num_blocks matrix of partial sums
+ * @param matrix_  the symmetric matrix, column-major
+ * @param vector_  the input vector x
+ */
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+struct Symv {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  index_t num_blocks_;
+
+  Symv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+
+  /*!
+   * @brief Number of work groups needed, one per tile of the stored triangle.
+   */
+  static index_t get_num_work_groups(index_t n);
+
+  /*!
+   * @brief Number of elements of local memory used by a work group: the
+   * padded tile and the two blocks of x it is multiplied with.
+   */
+  static constexpr index_t get_local_memory_size() {
+    return tile_size * (tile_size + 1) + 2 * tile_size;
+  }
+};
+
+/*!
+ * @brief Constructs a Symv tree, see Symv for the parameters.
+ */
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t> make_Symv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_) {
+  return Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>(lhs_, matrix_,
+                                                              vector_);
+}
+
 /**** GER BY ROWS M ROWS x N BLOCK USING PROPERLY THE SHARED MEMORY ****/
 // template <typename lhs_t,typename rhs_1_t,typename rhs_2_t>
 template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
@@ -279,6 +700,11 @@ struct GerCol {
   index_t nWG_col_;
   index_t local_memory_size_;
   value_t scalar_;
+  /*!
+   * Same as GemvCol::is_triangular, the work groups are enumerated on the
+   * blocks of the updated triangle only.
+   */
+  static constexpr bool is_triangular = !Lower || !Upper;
 
   GerCol(lhs_t &_l, value_t _scl, rhs_1_t &_r1, rhs_2_t &_r2, index_t &_nWG_row,
          index_t &_nWG_col, index_t &_shrMemSize);
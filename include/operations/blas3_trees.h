@@ -58,6 +58,45 @@ enum class gemm_vectorization_t : int { none = 0, partial = 1, full = 2 };
  */
 enum class gemm_batch_type_t : int { strided = 0, interleaved = 1 };
 
+/*!
+ * @brief Indicates how the bias of a GEMM epilogue is broadcast over C.
+ * none: no bias is added.
+ * row: the bias vector holds one value per row of C.
+ * column: the bias vector holds one value per column of C.
+ */
+enum class gemm_bias_t : int { none = 0, row = 1, column = 2 };
+
+/*!
+ * @brief Indicates the activation applied last by a GEMM epilogue.
+ * none: the result is left as it is.
+ * relu: max(x, 0).
+ * gelu: the tanh approximation of the Gaussian error linear unit.
+ */
+enum class gemm_activation_t : int { none = 0, relu = 1, gelu = 2 };
+
+/*!
+ * @brief Indicates how the scales of a GEMM prologue are broadcast over an
+ * operand op(X) of the GEMM.
+ * none: the operand is not scaled.
+ * row: the scale vector holds one value per row of op(X).
+ * column: the scale vector holds one value per column of op(X).
+ */
+enum class gemm_scale_t : int { none = 0, row = 1, column = 2 };
+
+/*!
+ * @brief Indicates how the scales and zero points of a requantizing GEMM
+ * epilogue are broadcast over C.
+ * per_tensor: one scale and one zero point for all of C.
+ * per_row: one scale and one zero point per row of C.
+ * per_column: one scale and one zero point per column of C, which are the
+ * output channels when B holds the weights of a layer.
+ */
+enum class gemm_quantization_t : int {
+  per_tensor = 0,
+  per_row = 1,
+  per_column = 2
+};
+
 /*!
  * @brief The Tile structure determines the tiling configuration of a gemm
  *        implementation.
@@ -125,6 +164,161 @@ struct Tile {
   static std::string get_type_string() noexcept;
 };
 
+/*!
+ * @brief The epilogue of a GEMM which fuses nothing, the elements of
+ * alpha * op(A) * op(B) + beta * C are stored as they are.
+ */
+struct GemmNoEpilogue {
+  static constexpr bool is_identity = true;
+  template <typename value_t, typename index_t>
+  value_t eval(value_t value, index_t row, index_t col) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief GemmEpilogue is applied by the GEMM kernels to the elements of C
+ * while they are in registers, right before they are stored:
+ *   C(i, j) = operator_t(alpha * op(A) * op(B)(i, j) + beta * C(i, j) + bias)
+ * where bias is bias_[i] for gemm_bias_t::row, bias_[j] for
+ * gemm_bias_t::column and 0 for gemm_bias_t::none.
+ * @tparam operator_t a unary operator of blas_operators.hpp (activation)
+ * @tparam bias_t the vector view of the bias
+ */
+template <typename operator_t, typename bias_t>
+struct GemmEpilogue {
+  using value_t = typename bias_t::value_t;
+  static constexpr bool is_identity = false;
+  bias_t bias_;
+  gemm_bias_t bias_type_;
+  GemmEpilogue(bias_t bias, gemm_bias_t bias_type);
+  template <typename index_t>
+  value_t eval(value_t value, index_t row, index_t col) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <typename operator_t, typename bias_t>
+inline GemmEpilogue<operator_t, bias_t> make_gemm_epilogue(
+    bias_t bias, gemm_bias_t bias_type) {
+  return GemmEpilogue<operator_t, bias_t>(bias, bias_type);
+}
+
+/*!
+ * @brief GemmRequantize is the epilogue of a GEMM accumulating integers. It
+ * converts the accumulators to the output type of the GEMM:
+ *   C(i, j) = saturate(round(scale * acc(i, j)) + zero_point)
+ * when C holds integers, and C(i, j) = scale * acc(i, j) + zero_point when it
+ * holds floating point values. The scale and the zero point are the ones of
+ * the row or the column of the element, or the first ones for
+ * gemm_quantization_t::per_tensor.
+ * @tparam output_value_t the type of the elements of C
+ * @tparam scale_t the vector view of the scales
+ * @tparam zero_point_t the vector view of the zero points
+ */
+template <typename output_value_t, typename scale_t, typename zero_point_t>
+struct GemmRequantize {
+  using value_t = typename scale_t::value_t;
+  static constexpr bool is_identity = false;
+  scale_t scale_;
+  zero_point_t zero_point_;
+  gemm_quantization_t quantization_type_;
+  GemmRequantize(scale_t scale, zero_point_t zero_point,
+                 gemm_quantization_t quantization_type);
+  template <typename acc_t, typename index_t>
+  value_t eval(acc_t value, index_t row, index_t col) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <typename output_value_t, typename scale_t, typename zero_point_t>
+inline GemmRequantize<output_value_t, scale_t, zero_point_t>
+make_gemm_requantize(scale_t scale, zero_point_t zero_point,
+                     gemm_quantization_t quantization_type) {
+  return GemmRequantize<output_value_t, scale_t, zero_point_t>(
+      scale, zero_point, quantization_type);
+}
+
+/*!
+ * @brief GemmDeviceScalars is the epilogue of a GEMM whose alpha and beta
+ * are read from device memory. The kernel computes op(A) * op(B) without
+ * reading C and the epilogue applies the scalars:
+ *   C(i, j) = alpha * op(A) * op(B)(i, j) + beta * C(i, j)
+ * where C is not read when beta is zero, as the host-scalar GEMM does.
+ * @tparam scalar_t the DeviceScalar of alpha and beta
+ * @tparam output_t the matrix view of C
+ */
+template <typename scalar_t, typename output_t>
+struct GemmDeviceScalars {
+  using value_t = typename output_t::value_t;
+  static constexpr bool is_identity = false;
+  scalar_t alpha_;
+  scalar_t beta_;
+  output_t c_;
+  GemmDeviceScalars(scalar_t alpha, scalar_t beta, output_t c);
+  template <typename index_t>
+  value_t eval(value_t value, index_t row, index_t col) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <typename scalar_t, typename output_t>
+inline GemmDeviceScalars<scalar_t, output_t> make_gemm_device_scalars(
+    scalar_t alpha, scalar_t beta, output_t c) {
+  return GemmDeviceScalars<scalar_t, output_t>(alpha, beta, c);
+}
+
+/*!
+ * @brief The prologue of a GEMM which transforms nothing, the elements of A
+ * and B are multiplied as they are loaded.
+ */
+struct GemmNoPrologue {
+  static constexpr bool is_identity = true;
+  template <typename value_t, typename index_t>
+  value_t eval_a(value_t value, index_t row, index_t col) noexcept;
+  template <typename value_t, typename index_t>
+  value_t eval_b(value_t value, index_t row, index_t col) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief GemmPrologue is applied by the GEMM kernels to the elements of A and
+ * B as they are loaded from global memory, before they are copied to local
+ * memory or multiplied, so that the transformed operands are never stored:
+ *   op(A)(i, l) = operator_t(op(A)(i, l)) * scale_a
+ *   op(B)(l, j) = operator_t(op(B)(l, j)) * scale_b
+ * where the scale of an operand is taken from its vector at the row or the
+ * column of the element, or is 1 for gemm_scale_t::none.
+ * @tparam operator_t a unary operator of blas_operators.hpp
+ * @tparam scale_t the vector view of the scales
+ */
+template <typename operator_t, typename scale_t>
+struct GemmPrologue {
+  using value_t = typename scale_t::value_t;
+  static constexpr bool is_identity = false;
+  scale_t scale_a_;
+  scale_t scale_b_;
+  gemm_scale_t scale_a_type_;
+  gemm_scale_t scale_b_type_;
+  GemmPrologue(scale_t scale_a, gemm_scale_t scale_a_type, scale_t scale_b,
+               gemm_scale_t scale_b_type);
+  template <typename index_t>
+  value_t eval_a(value_t value, index_t row, index_t col) noexcept;
+  template <typename index_t>
+  value_t eval_b(value_t value, index_t row, index_t col) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <typename operator_t, typename scale_t>
+inline GemmPrologue<operator_t, scale_t> make_gemm_prologue(
+    scale_t scale_a, gemm_scale_t scale_a_type, scale_t scale_b,
+    gemm_scale_t scale_b_type) {
+  return GemmPrologue<operator_t, scale_t>(scale_a, scale_a_type, scale_b,
+                                           scale_b_type);
+}
+
 /*!
  * @brief GemmFactory is a template class whose instantiations provide
  *        different implementations of the GEMM device function. It also support
@@ -155,7 +349,12 @@ struct Tile {
  *                   level tiles to use, see Tile
  * @tparam TransA  iff true, matrix A will be transposed on the fly
  * @tparam TransB  iff true, matrix B will be transposed on the fly
- * @tparam element_t  type of matrix elements
+ * @tparam element_t  type of alpha and beta, which the products are
+ *                    accumulated in. A and B (input_t) and C (output_t) may
+ *                    be stored in another type, such as half operands
+ *                    accumulated in float or int8 operands accumulated in
+ *                    int32, in the naive, local and no_local full
+ *                    vectorization kernels.
  * @param a_ the lhs_t matrix
  * @param b_ the rhs_t matrix
  * @param c_ the output matrix
@@ -168,12 +367,23 @@ struct Tile {
  * @param ldb the leading dimension of the matrix b_
  * @param ldc the leading dimension of the matrix _C
  * @param batch_size_ the number batches of matrices of a_ b_ _C
+ * @param stride_a_ the distance between two consecutive matrices of a_
+ * @param stride_b_ the distance between two consecutive matrices of b_
+ * @param stride_c_ the distance between two consecutive matrices of _C
+ * (a stride of 0 for a_ or b_ reuses the same matrix in every batch; the
+ * interleaved batch type ignores the strides)
+ * @param epilogue_ applied to each element of C before it is stored, see
+ * GemmEpilogue and GemmRequantize (only the naive, local and no_local full
+ * vectorization kernels take an epilogue other than GemmNoEpilogue)
+ * @param prologue_ applied to each element of A and B as it is loaded, see
+ * GemmPrologue (the same kernels as the epilogue support it)
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t = GemmNoEpilogue,
+          typename prologue_t = GemmNoPrologue>
 class Gemm {
  public:
   using value_t = element_t;
@@ -194,6 +404,11 @@ class Gemm {
   index_t ldb_;
   index_t ldc_;
   index_t batch_size_;
+  index_t stride_a_;
+  index_t stride_b_;
+  index_t stride_c_;
+  epilogue_t epilogue_;
+  prologue_t prologue_;
 
   // Reject GEMM configurations which do not have a partial specialization and
   // thus would default to the naive implementation. If GemmAlgorithm is set to
@@ -208,7 +423,9 @@ class Gemm {
                 "Invalid GEMM configuration options, this would cause the "
                 "naive implementation to be selected");
   Gemm(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
-       index_t batch_size);
+       index_t batch_size, index_t stride_a, index_t stride_b,
+       index_t stride_c, epilogue_t epilogue = epilogue_t(),
+       prologue_t prologue = prologue_t());
   static std::string get_type_string() noexcept;
   index_t get_workgroup_cluster() const noexcept;
   index_t get_num_workgroup_cluster(index_t compute_units) const noexcept;
@@ -242,11 +459,291 @@ inline Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
             TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
             GemmAlgorithm, GemmVectorization, VectorSize, BatchType>
 make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
-          element_t alpha, element_t beta, index_t batch_size) {
+          element_t alpha, element_t beta, index_t batch_size,
+          index_t stride_a, index_t stride_b, index_t stride_c) {
   return Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
               TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
               GemmAlgorithm, GemmVectorization, VectorSize, BatchType>(
-      buffer_a, buffer_b, buffer_c, alpha, beta, batch_size);
+      buffer_a, buffer_b, buffer_c, alpha, beta, batch_size, stride_a,
+      stride_b, stride_c);
+}
+
+/*!
+ * @brief Constructs a GEMM applying the given epilogue to C.
+ */
+template <bool DoubleBuffer, bool ConflictA, bool ConflictB, int ClSize,
+          typename TileType, bool TransA, bool TransB, int GemmMemoryType,
+          int GemmAlgorithm, int GemmVectorization, bool is_beta_zero,
+          int VectorSize, int BatchType, typename input_t, typename output_t,
+          typename element_t, typename index_t, typename epilogue_t>
+inline Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
+            TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
+            GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+            epilogue_t>
+make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
+          element_t alpha, element_t beta, index_t batch_size,
+          index_t stride_a, index_t stride_b, index_t stride_c,
+          epilogue_t epilogue) {
+  return Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
+              TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
+              GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+              epilogue_t>(buffer_a, buffer_b, buffer_c, alpha, beta,
+                          batch_size, stride_a, stride_b, stride_c, epilogue);
+}
+
+/*!
+ * @brief Constructs a GEMM applying the given prologue to A and B and the
+ * given epilogue to C.
+ */
+template <bool DoubleBuffer, bool ConflictA, bool ConflictB, int ClSize,
+          typename TileType, bool TransA, bool TransB, int GemmMemoryType,
+          int GemmAlgorithm, int GemmVectorization, bool is_beta_zero,
+          int VectorSize, int BatchType, typename input_t, typename output_t,
+          typename element_t, typename index_t, typename epilogue_t,
+          typename prologue_t>
+inline Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
+            TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
+            GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+            epilogue_t, prologue_t>
+make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
+          element_t alpha, element_t beta, index_t batch_size,
+          index_t stride_a, index_t stride_b, index_t stride_c,
+          epilogue_t epilogue, prologue_t prologue) {
+  return Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
+              TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
+              GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+              epilogue_t, prologue_t>(buffer_a, buffer_b, buffer_c, alpha,
+                                      beta, batch_size, stride_a, stride_b,
+                                      stride_c, epilogue, prologue);
+}
+
+/*!
+ * @brief GemmGrouped computes C_p = alpha * op(A_p) * op(B_p) + beta * C_p for
+ * a group of GEMM problems of different sizes in a single kernel.
+ *
+ * Each work group computes one block of block_rows by block_cols elements of
+ * the C_p of one problem with Gemm::compute_block, so the problems go through
+ * the K loop of gemm_t, with or without local memory. The matrices of gemm_t
+ * view the whole buffers, a problem being given by its sizes, leading
+ * dimensions and offsets into them. The blocks of a problem go down the
+ * columns of its C_p first.
+ *
+ * The problems are read from desc_, which holds the index of the first work
+ * group of every problem followed by one more entry for the total number of
+ * work groups, then the num_problem_fields values of every problem laid out
+ * as in problem_field_t. A work group finds its problem with a binary search
+ * of the first part.
+ *
+ * @tparam gemm_t  the Gemm computing the blocks, whose transpositions, beta
+ *                 and tile are those of every problem
+ * @param gemm_  the Gemm over the buffers of the matrices A_p, B_p and C_p
+ * @param desc_  the description of the problems
+ * @param group_count_  the number of problems
+ * @param num_work_groups_  the number of work groups of the kernel
+ */
+template <typename gemm_t, typename desc_t>
+struct GemmGrouped {
+  using value_t = typename gemm_t::value_t;
+  using index_t = typename gemm_t::index_t;
+  static constexpr index_t block_rows = gemm_t::block_rows;
+  static constexpr index_t block_cols = gemm_t::block_cols;
+  static constexpr index_t wg_size = gemm_t::wg_rows * gemm_t::wg_cols;
+  static constexpr index_t local_memory_size = gemm_t::local_memory_size;
+
+  /*!
+   * @brief Position of the values of a problem in its part of desc_.
+   */
+  enum problem_field_t : int {
+    field_m = 0,
+    field_n = 1,
+    field_k = 2,
+    field_lda = 3,
+    field_ldb = 4,
+    field_ldc = 5,
+    field_offset_a = 6,
+    field_offset_b = 7,
+    field_offset_c = 8,
+    num_problem_fields = 9
+  };
+
+  gemm_t gemm_;
+  desc_t desc_;
+  index_t group_count_;
+  index_t num_work_groups_;
+
+  GemmGrouped(gemm_t gemm, desc_t desc, index_t group_count,
+              index_t num_work_groups);
+  /*!
+   * @brief The number of work groups covering a C_p of m rows and n columns.
+   */
+  static index_t get_num_work_groups(index_t m, index_t n) noexcept;
+  index_t get_size() const;
+  bool valid_thread(const cl::sycl::nd_item<1>& ndItem) const;
+  template <typename local_memory_t>
+  void eval(local_memory_t scratch, const cl::sycl::nd_item<1>& id) noexcept;
+  void eval(cl::sycl::nd_item<1> id) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+
+ private:
+  /*!
+   * @brief The problem computed by the work group wg_id.
+   */
+  index_t get_problem(index_t wg_id) noexcept;
+  /*!
+   * @brief Computes the block of the work group, scratch being the local
+   * memory of gemm_t when it uses any and empty otherwise.
+   */
+  template <typename... scratch_t>
+  void compute_block(const cl::sycl::nd_item<1>& id,
+                     scratch_t... scratch) noexcept;
+};
+
+/*!
+ * @brief Constructs a GemmGrouped tree, see GemmGrouped for the parameters.
+ */
+template <typename gemm_t, typename desc_t, typename index_t>
+inline GemmGrouped<gemm_t, desc_t> make_gemm_grouped(gemm_t gemm, desc_t desc,
+                                                     index_t group_count,
+                                                     index_t num_work_groups) {
+  return GemmGrouped<gemm_t, desc_t>(gemm, desc, group_count,
+                                     num_work_groups);
+}
+
+/*!
+ * @brief GemmStreamK computes C = alpha * op(A) * op(B) + beta * C with a
+ * fixed number of work groups sharing the multiply-accumulate iterations of
+ * the whole GEMM evenly, rather than each computing whole blocks of C.
+ *
+ * The iterations are numbered block by block, K of them for each block of
+ * block_rows by block_cols elements of C, and work group w computes the
+ * iterations [w * share_, (w + 1) * share_). Every range of iterations of a
+ * block is computed with Gemm::compute_block, as the GEMM of the block by the
+ * K range, so stream-K runs the same K loop as GemmGrouped and _gemm.
+ *
+ * A block whose iterations are all computed by one work group is written to C
+ * by gemm_. Otherwise every work group computing part of it stores its partial
+ * sums in the workspace through partial_gemm_, in slot 0 when the block holds
+ * its first iteration and slot 1 otherwise, and GemmStreamKFixup adds them up
+ * into C.
+ *
+ * @tparam gemm_t  the Gemm computing the blocks written to C
+ * @tparam partial_gemm_t  the Gemm computing the partial sums, with the
+ *                         configuration of gemm_t, beta zero and an alpha of
+ *                         one
+ * @param gemm_  the Gemm over the buffers of A, B and C, column-major
+ * @param partial_gemm_  the Gemm over the buffers of A, B and the workspace,
+ *                       which holds two slots of block_rows * block_cols
+ *                       elements for each work group
+ * @param share_  the number of iterations of each work group
+ * @param num_work_groups_  the number of work groups of the kernel
+ */
+template <typename gemm_t, typename partial_gemm_t>
+struct GemmStreamK {
+  using value_t = typename gemm_t::value_t;
+  using index_t = typename gemm_t::index_t;
+  static constexpr bool trans_a = gemm_t::trans_a;
+  static constexpr bool trans_b = gemm_t::trans_b;
+  static constexpr index_t block_rows = gemm_t::block_rows;
+  static constexpr index_t block_cols = gemm_t::block_cols;
+  static constexpr index_t wg_size = gemm_t::wg_rows * gemm_t::wg_cols;
+  static constexpr index_t local_memory_size = gemm_t::local_memory_size;
+
+  gemm_t gemm_;
+  partial_gemm_t partial_gemm_;
+  index_t m_;
+  index_t n_;
+  index_t k_;
+  index_t lda_;
+  index_t ldb_;
+  index_t ldc_;
+  index_t share_;
+  index_t num_work_groups_;
+
+  GemmStreamK(gemm_t gemm, partial_gemm_t partial_gemm, index_t m, index_t n,
+              index_t k, index_t lda, index_t ldb, index_t ldc, index_t share,
+              index_t num_work_groups);
+  /*!
+   * @brief The number of blocks of C.
+   */
+  static index_t get_num_blocks(index_t m, index_t n) noexcept;
+  index_t get_size() const;
+  bool valid_thread(const cl::sycl::nd_item<1>& ndItem) const;
+  template <typename local_memory_t>
+  void eval(local_memory_t scratch, const cl::sycl::nd_item<1>& id) noexcept;
+  void eval(cl::sycl::nd_item<1> id) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+
+ private:
+  /*!
+   * @brief Computes the iterations of the work group, scratch being the local
+   * memory of the Gemms when they use any and empty otherwise.
+   */
+  template <typename... scratch_t>
+  void compute_iterations(const cl::sycl::nd_item<1>& id,
+                          scratch_t... scratch) noexcept;
+};
+
+/*!
+ * @brief Constructs a GemmStreamK tree, see GemmStreamK for the parameters.
+ */
+template <typename gemm_t, typename partial_gemm_t, typename index_t>
+inline GemmStreamK<gemm_t, partial_gemm_t> make_gemm_stream_k(
+    gemm_t gemm, partial_gemm_t partial_gemm, index_t m, index_t n, index_t k,
+    index_t lda, index_t ldb, index_t ldc, index_t share,
+    index_t num_work_groups) {
+  return GemmStreamK<gemm_t, partial_gemm_t>(gemm, partial_gemm, m, n, k, lda,
+                                             ldb, ldc, share, num_work_groups);
+}
+
+/*!
+ * @brief GemmStreamKFixup completes the blocks of C which GemmStreamK split
+ * between several work groups, each work item adding up the partial sums of
+ * one element of C from the workspace and applying alpha and beta. The items
+ * of the other blocks do nothing.
+ */
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t>
+struct GemmStreamKFixup {
+  using value_t = element_t;
+  using index_t = typename std::make_signed<typename output_t::index_t>::type;
+  static constexpr index_t block_rows =
+      tile_type::item_rows * tile_type::wg_rows;
+  static constexpr index_t block_cols =
+      tile_type::item_cols * tile_type::wg_cols;
+
+  output_t c_;
+  output_t workspace_;
+  element_t alpha_;
+  element_t beta_;
+  index_t m_;
+  index_t n_;
+  index_t k_;
+  index_t ldc_;
+  index_t share_;
+
+  GemmStreamKFixup(output_t C, output_t workspace, element_t alpha,
+                   element_t beta, index_t m, index_t n, index_t k,
+                   index_t ldc, index_t share);
+  index_t get_size() const;
+  bool valid_thread(const cl::sycl::nd_item<1>& ndItem) const;
+  void eval(cl::sycl::nd_item<1> id) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Constructs a GemmStreamKFixup tree, see GemmStreamKFixup.
+ */
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t, typename index_t>
+inline GemmStreamKFixup<is_beta_zero, tile_type, output_t, element_t>
+make_gemm_stream_k_fixup(output_t buffer_c, output_t workspace,
+                         element_t alpha, element_t beta, index_t m, index_t n,
+                         index_t k, index_t ldc, index_t share) {
+  return GemmStreamKFixup<is_beta_zero, tile_type, output_t, element_t>(
+      buffer_c, workspace, alpha, beta, m, n, k, ldc, share);
 }
 
 }  // namespace blas
@@ -44,6 +44,51 @@ template <typename rhs_t>
 struct ResolveReturnType<CollapseIndexTupleOperator, rhs_t> {
   using type = typename rhs_t::value_t;
 };
+
+// The strategy used to reduce a vector to a single value.
+// multi_pass: one kernel per reduction step, the partial results of a step
+// being reduced by the next one.
+// single_pass: one kernel, the last work group to finish reduces the partial
+// results of all the others.
+enum class reduction_strategy_t : int { multi_pass = 0, single_pass = 1 };
+
+// A template for selecting the reduction strategy of a blas operator
+template <typename operator_t>
+struct ReductionStrategy {
+  static constexpr reduction_strategy_t value =
+      reduction_strategy_t::multi_pass;
+};
+
+#ifdef SINGLE_PASS_REDUCTION_SUPPORT
+struct AddOperator;
+struct AbsoluteAddOperator;
+struct IMaxOperator;
+struct IMinOperator;
+
+template <>
+struct ReductionStrategy<AddOperator> {
+  static constexpr reduction_strategy_t value =
+      reduction_strategy_t::single_pass;
+};
+
+template <>
+struct ReductionStrategy<AbsoluteAddOperator> {
+  static constexpr reduction_strategy_t value =
+      reduction_strategy_t::single_pass;
+};
+
+template <>
+struct ReductionStrategy<IMaxOperator> {
+  static constexpr reduction_strategy_t value =
+      reduction_strategy_t::single_pass;
+};
+
+template <>
+struct ReductionStrategy<IMinOperator> {
+  static constexpr reduction_strategy_t value =
+      reduction_strategy_t::single_pass;
+};
+#endif  // SINGLE_PASS_REDUCTION_SUPPORT
 }  // namespace blas
 
 #endif
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename host_policy.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_HOST_POLICY_H
+#define SYCL_BLAS_HOST_POLICY_H
+
+#include "blas_meta.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Pool of threads evaluating the expression trees on the host.
+ *
+ * The queue is a handle: copies share the same threads, which are joined when
+ * the last copy is destroyed. Work is submitted as a range of chunks which
+ * the calling thread and the workers take from a shared counter, so that a
+ * thread finishing early takes over the remaining chunks of the others.
+ */
+class HostQueue {
+ public:
+  /*!
+   * @brief Creates a pool of num_threads threads, the calling thread
+   * included. 0 uses the number of hardware threads.
+   */
+  explicit HostQueue(size_t num_threads = 0);
+
+  /*!
+   * @brief Calls chunk_fn(c) for every c in [0, num_chunks) and returns once
+   * all the calls have completed. Calls from different threads to the same
+   * queue are serialized. If a call throws, the chunks not yet started are
+   * skipped and the exception is rethrown here, in the calling thread, once
+   * the workers are done.
+   */
+  void parallel_for(size_t num_chunks,
+                    const std::function<void(size_t)> &chunk_fn);
+
+  size_t get_num_threads() const;
+
+ private:
+  class Pool;
+  std::shared_ptr<Pool> pool_;
+};
+
+/*!
+ * @brief Event of a host computation. Trees are evaluated when they are
+ * submitted, so the events are always complete; they exist to keep the same
+ * interface as the SYCL backend.
+ */
+struct HostEvent {};
+
+struct host_policy {
+  template <typename scalar_t, int dim = 1>
+  using buffer_t = std::shared_ptr<scalar_t>;
+  template <typename scalar_t, int acc_md_t = 0>
+  using default_accessor_t = scalar_t *;
+  using queue_t = HostQueue;
+  using event_t = std::vector<HostEvent>;
+
+  enum class device_type : int { host };
+
+  /*!
+   * @brief Number of bytes of the ranges of indices evaluated by a thread at
+   * once, chosen to fit the operands of a tree in the L1 cache.
+   */
+  static constexpr size_t chunk_bytes = 16 * 1024;
+
+  static inline bool is_complete(const event_t &) { return true; }
+
+  static inline const char *get_device_type_name(device_type) {
+    return "host";
+  }
+
+  /*!
+   * @brief Second queue with threads of its own, for work which must neither
+   * wait for the work submitted to q nor delay it.
+   */
+  static inline queue_t make_side_queue(const queue_t &q) {
+    return queue_t(q.get_num_threads());
+  }
+
+  static inline size_t get_num_compute_units(const queue_t &q_) {
+    return q_.get_num_threads();
+  }
+
+  /*!
+   * @brief A thread evaluates the indices of a chunk one after the other, as
+   * a single work item would, so the host has work groups of one work item.
+   * The sizes the routines derive from it only size SYCL kernels, which the
+   * host executor evaluates in chunks whatever their work group size.
+   */
+  static inline size_t get_work_group_size(const queue_t &) { return 1; }
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_HOST_POLICY_H
@@ -0,0 +1,157 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename host_policy_handler.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_HOST_POLICY_HANDLER_H
+#define SYCL_BLAS_HOST_POLICY_HANDLER_H
+
+#include "blas_meta.h"
+#include "container/host_iterator.h"
+#include "policy/default_policy_handler.h"
+#include "policy/host_policy.h"
+#include <algorithm>
+#include <cstring>
+
+namespace blas {
+
+/*!
+ * @brief Temporary host buffer, see ScratchBuffer. The memory is freed when
+ * the last iterator referencing it is destroyed.
+ */
+template <typename element_t>
+class HostScratchBuffer {
+ public:
+  using iterator_t = BufferIterator<element_t, host_policy>;
+
+  explicit HostScratchBuffer(iterator_t iterator) : iterator_(iterator) {}
+
+  inline iterator_t get_iterator() const { return iterator_; }
+
+ private:
+  iterator_t iterator_;
+};
+
+/*!
+ * @brief PolicyHandler evaluating the trees with a pool of host threads.
+ * The memory is plain host memory, so the copies are memcpy and the
+ * "device" pointers are host pointers.
+ */
+template <>
+class PolicyHandler<host_policy> {
+ public:
+  using policy_t = host_policy;
+
+  explicit PolicyHandler(host_policy::queue_t q) : q_(q) {}
+
+  template <typename element_t>
+  inline BufferIterator<element_t, policy_t> get_buffer(
+      BufferIterator<element_t, policy_t> buff) const {
+    return buff;
+  }
+
+  template <typename element_t>
+  inline ptrdiff_t get_offset(BufferIterator<element_t, policy_t> buff) const {
+    return buff.get_offset();
+  }
+
+  /*  @brief Copying the data to the buffer
+      @tparam element_t is the type of the data
+      @param src is the host pointer we want to copy from.
+      @param dst is the BufferIterator we want to copy to.
+      @param size is the number of elements to be copied
+  */
+  template <typename element_t>
+  inline typename policy_t::event_t copy_to_device(
+      const element_t *src, BufferIterator<element_t, policy_t> dst,
+      size_t size) {
+    std::copy(src, src + size, dst.get_pointer());
+    return {};
+  }
+
+  /*  @brief Copying the data from the buffer
+      @tparam element_t is the type of the data
+      @param src is the BufferIterator we want to copy from.
+      @param dst is the host pointer we want to copy to.
+      @param size is the number of elements to be copied
+  */
+  template <typename element_t>
+  inline typename policy_t::event_t copy_to_host(
+      BufferIterator<element_t, policy_t> src, element_t *dst, size_t size) {
+    std::copy(src.get_pointer(), src.get_pointer() + size, dst);
+    return {};
+  }
+
+  /*  @brief Allocating a temporary buffer
+      @tparam element_t is the type of the data
+      @param num_elements is the number of elements required
+  */
+  template <typename element_t>
+  inline HostScratchBuffer<element_t> acquire_scratch(size_t num_elements) {
+    return HostScratchBuffer<element_t>(
+        make_host_iterator_buffer<element_t>(num_elements));
+  }
+
+  template <typename element_t>
+  inline HostScratchBuffer<element_t> acquire_zeroed_scratch(
+      size_t num_elements) {
+    return acquire_scratch<element_t>(num_elements);
+  }
+
+  template <typename element_t>
+  inline void release_scratch(HostScratchBuffer<element_t>,
+                              const typename policy_t::event_t &) {}
+
+  template <typename object_t>
+  inline void keep_alive(object_t, const typename policy_t::event_t &) {}
+
+  inline const policy_t::device_type get_device_type() const {
+    return policy_t::device_type::host;
+  }
+
+  inline bool has_local_memory() const { return false; }
+
+  typename policy_t::queue_t get_queue() const { return q_; }
+
+  inline size_t get_work_group_size() const {
+    return policy_t::get_work_group_size(q_);
+  }
+
+  inline size_t get_num_compute_units() const {
+    return policy_t::get_num_compute_units(q_);
+  }
+
+  /*  @brief The trees are evaluated when they are submitted, so there is
+      nothing to wait for
+  */
+  inline void wait() {}
+
+  template <typename... event_t>
+  inline void wait(event_t...) {}
+
+ private:
+  typename policy_t::queue_t q_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_HOST_POLICY_HANDLER_H
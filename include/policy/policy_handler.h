@@ -25,3 +25,5 @@
 #include "policy/default_policy_handler.h"
 
 #include "policy/sycl_policy_handler.h"
+
+#include "policy/host_policy_handler.h"
@@ -0,0 +1,59 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename routine_scope.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_ROUTINE_SCOPE_H
+#define SYCL_BLAS_ROUTINE_SCOPE_H
+
+namespace blas {
+
+/*!
+ * @brief Names the routine of the kernels submitted by the calling thread
+ * while it is alive, e.g. "gemm" for the kernels of _gemm. The interface
+ * entry points open one, and KernelProfiler aggregates the kernels by this
+ * name. A scope opened inside another one keeps the outer name, so that the
+ * kernels of a routine calling another routine are counted with it.
+ */
+class RoutineScope {
+ public:
+  explicit RoutineScope(const char *routine);
+
+  ~RoutineScope();
+
+  RoutineScope(const RoutineScope &) = delete;
+
+  RoutineScope &operator=(const RoutineScope &) = delete;
+
+  /*!
+   * @brief Returns the name of the outermost scope of the calling thread, or
+   * nullptr outside of any scope.
+   */
+  static const char *get_current();
+
+ private:
+  const char *previous_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_ROUTINE_SCOPE_H
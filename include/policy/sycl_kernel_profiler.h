@@ -0,0 +1,200 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_kernel_profiler.h
+ *
+ **************************************************************************/
+
+
+#ifndef SYCL_BLAS_SYCL_KERNEL_PROFILER_H
+#define SYCL_BLAS_SYCL_KERNEL_PROFILER_H
+
+#include "policy/routine_scope.h"
+#include "policy/sycl_policy.h"
+#include <CL/sycl.hpp>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Kernel submitted while the profiler was enabled.
+ */
+struct KernelRecord {
+  /* Type of the expression tree, see KernelName */
+  std::string kernel;
+  /* Routine which submitted the kernel, see RoutineScope, else the root of
+   * the tree type, e.g. Gemm or AssignReduction */
+  std::string routine;
+  size_t global_size;
+  size_t local_size;
+  size_t local_memory_bytes;
+  /* Profiling timestamps of the command in nanoseconds, zero when the queue
+   * was not created with the enable_profiling property */
+  uint64_t submit_ns;
+  uint64_t start_ns;
+  uint64_t end_ns;
+};
+
+/*!
+ * @brief Aggregate of the kernels of a routine. The times are the durations
+ * of the kernels on the device, between their start and end timestamps.
+ */
+struct RoutineStats {
+  size_t num_kernels = 0;
+  size_t num_work_items = 0;
+  uint64_t total_ns = 0;
+  uint64_t min_ns = 0;
+  uint64_t max_ns = 0;
+};
+
+/*!
+ * @brief Returns the readable form of a mangled type name.
+ */
+std::string demangle_type_name(const char *name);
+
+/*!
+ * @brief Name of a tree in the profiles: its get_type_string() when it has
+ * one (e.g. Gemm), else its type name.
+ */
+template <typename expression_tree_t>
+class KernelName {
+  template <typename tree_t>
+  static std::string make(int, decltype(tree_t::get_type_string()) * = 0) {
+    return tree_t::get_type_string();
+  }
+
+  template <typename tree_t>
+  static std::string make(long) {
+    return demangle_type_name(typeid(tree_t).name());
+  }
+
+ public:
+  static const std::string &get() {
+    static const std::string name = make<expression_tree_t>(0);
+    return name;
+  }
+};
+
+/*!
+ * @brief Records the kernels submitted by execute_tree, with their nd_range,
+ * local memory and profiling timestamps, and aggregates them per routine.
+ *
+ * The profiler is owned by the PolicyHandler and disabled by default. It is
+ * enabled with set_enabled or by setting the SYCL_BLAS_PROFILING environment
+ * variable to 1. The timestamps are only available when the queue was
+ * created with the cl::sycl::property::queue::enable_profiling property.
+ *
+ * The kernels are timed when the records are read, which waits for their
+ * completion. Only the last max_records records are kept, the aggregates
+ * cover all the kernels since the last clear. At most max_records kernels
+ * wait to be timed, the oldest ones being dropped beyond that.
+ */
+class KernelProfiler {
+ public:
+  using event_t = cl::sycl::event;
+
+  static constexpr const char *env_var = "SYCL_BLAS_PROFILING";
+
+  static constexpr size_t default_max_records = 1 << 16;
+
+  explicit KernelProfiler(bool has_timestamps);
+
+  void set_enabled(bool enabled) { enabled_ = enabled; }
+
+  bool is_enabled() const { return enabled_; }
+
+  bool has_timestamps() const { return has_timestamps_; }
+
+  void set_max_records(size_t max_records);
+
+  /*!
+   * @brief Records a kernel. Called by execute_tree when enabled, from the
+   * thread submitting the kernel.
+   */
+  void record(const std::string &kernel, size_t global_size,
+              size_t local_size, size_t local_memory_bytes, event_t event);
+
+  /*!
+   * @brief Returns the number of kernels dropped before being timed since the
+   * last clear.
+   */
+  size_t get_num_dropped();
+
+  /*!
+   * @brief Returns the kept records, oldest first.
+   */
+  std::vector<KernelRecord> get_records();
+
+  /*!
+   * @brief Returns the aggregates, by routine.
+   */
+  std::map<std::string, RoutineStats> get_routine_stats();
+
+  /*!
+   * @brief Writes the kept records as CSV, with a header line.
+   */
+  void write_csv(std::ostream &output);
+
+  /*!
+   * @brief Writes the aggregates as CSV, with a header line.
+   */
+  void write_routine_stats_csv(std::ostream &output);
+
+  /*!
+   * @brief Drops the records and the aggregates.
+   */
+  void clear();
+
+ private:
+  /* Reads the timestamps of a completed kernel */
+  void time(KernelRecord &record, event_t &event) const;
+
+  /* Adds a timed kernel to the records and the aggregates. mutex_ must be
+   * held */
+  void add(KernelRecord &&record);
+
+  /* Times the pending kernels which have completed. mutex_ must be held */
+  void collect_completed();
+
+  /* Waits for the pending kernels and times them. mutex_ must not be held */
+  void collect();
+
+  std::atomic<bool> enabled_;
+  const bool has_timestamps_;
+  std::mutex mutex_;
+  size_t max_records_;
+  size_t num_dropped_;
+  std::deque<std::pair<KernelRecord, event_t>> pending_;
+  std::deque<KernelRecord> records_;
+  std::map<std::string, RoutineStats> stats_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SYCL_KERNEL_PROFILER_H
@@ -31,6 +31,22 @@
 
 namespace blas {
 
+/*!
+ * @brief Selects a given device, see codeplay_policy::make_side_queue.
+ */
+class same_device_selector : public cl::sycl::device_selector {
+ public:
+  explicit same_device_selector(const cl::sycl::device &device)
+      : device_(device) {}
+
+  int operator()(const cl::sycl::device &device) const override {
+    return device == device_ ? 1 : -1;
+  }
+
+ private:
+  cl::sycl::device device_;
+};
+
 struct codeplay_policy {
   template <typename scalar_t, int dim = 1>
   using buffer_t = cl::sycl::buffer<scalar_t, dim>;
@@ -83,6 +99,18 @@ struct codeplay_policy {
             .template get_info<cl::sycl::info::device::max_work_group_size>());
   }
 
+  // Returns true once all the commands behind the events have completed,
+  // without waiting for them.
+  static inline bool is_complete(const event_t &events) {
+    for (const auto &ev : events) {
+      if (ev.template get_info<cl::sycl::info::event::command_status>() !=
+          cl::sycl::info::event_command_status::complete) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   static inline size_t get_num_compute_units(cl::sycl::queue &q_) {
     return q_.get_device()
         .template get_info<cl::sycl::info::device::max_compute_units>();
@@ -117,6 +145,34 @@ struct codeplay_policy {
     }
     throw std::runtime_error("couldn't find device");
   }
+
+  // Second queue on the device of q and in its context, for work which must
+  // neither wait for the kernels submitted to q nor delay them.
+  static inline queue_t make_side_queue(const queue_t &q) {
+    return queue_t(q.get_context(), same_device_selector(q.get_device()));
+  }
+
+  // Name of the device type, as used in the GEMM dispatch tables.
+  static inline const char *get_device_type_name(device_type type) {
+    switch (type) {
+      case device_type::cpu:
+        return "cpu";
+      case device_type::host:
+        return "host";
+      case device_type::intel_gpu:
+        return "intel_gpu";
+      case device_type::amd_gpu:
+        return "amd_gpu";
+      case device_type::arm_gpu:
+        return "arm_gpu";
+      case device_type::rcar_cvengine:
+        return "rcar_cvengine";
+      case device_type::rcar_cpu:
+        return "rcar_cpu";
+      default:
+        return "unsupported";
+    }
+  }
 };  // namespace blas
 
 }  // namespace blas
@@ -28,7 +28,10 @@
 #include "blas_meta.h"
 #include "container/sycl_iterator.h"
 #include "policy/default_policy_handler.h"
+#include "policy/sycl_kernel_profiler.h"
 #include "policy/sycl_policy.h"
+#include "policy/sycl_release_list.h"
+#include "policy/sycl_scratch_pool.h"
 #include <CL/sycl.hpp>
 #include <stdexcept>
 #include <vptr/virtual_ptr.hpp>
@@ -48,6 +51,10 @@ class PolicyHandler<codeplay_policy> {
               p->clear();
               delete p;
             })),
+        scratchPoolPtr_(std::make_shared<ScratchPool>()),
+        releaseListPtr_(std::make_shared<DeferredReleaseList>()),
+        profilerPtr_(std::make_shared<KernelProfiler>(
+            q.has_property<cl::sycl::property::queue::enable_profiling>())),
         workGroupSize_(codeplay_policy::get_work_group_size(q)),
         selectedDeviceType_(codeplay_policy::find_chosen_device_type(q)),
         localMemorySupport_(codeplay_policy::has_local_memory(q)),
@@ -150,6 +157,70 @@ class PolicyHandler<codeplay_policy> {
   typename policy_t::event_t copy_to_host(
       BufferIterator<element_t, policy_t> src, element_t *dst, size_t);
 
+  /*  @brief Borrowing a temporary buffer from the scratch pool
+      @tparam element_t is the type of the data
+      @param num_elements is the number of elements required
+  */
+  template <typename element_t>
+  ScratchBuffer<element_t> acquire_scratch(size_t num_elements);
+
+  /*  @brief Borrowing a temporary buffer which is zero-filled when allocated
+      and must be given back with the content its users expect to find
+      @tparam element_t is the type of the data
+      @param num_elements is the number of elements required
+  */
+  template <typename element_t>
+  ScratchBuffer<element_t> acquire_zeroed_scratch(size_t num_elements);
+
+  /*  @brief Giving a temporary buffer back to the scratch pool. It is reused
+      once the dependencies have completed.
+      @tparam element_t is the type of the data
+      @param scratch is the buffer returned by acquire_scratch
+      @param dependencies are the events of the kernels using the buffer
+  */
+  template <typename element_t>
+  void release_scratch(ScratchBuffer<element_t> scratch,
+                       const typename policy_t::event_t &dependencies);
+
+  /*  @brief Providing a user-owned buffer the temporaries are taken from
+      before the scratch pool allocates device memory. Its size in bytes must
+      be a multiple of ScratchPool::min_block_bytes.
+      @param workspace is the user-owned buffer
+  */
+  inline void set_workspace(ScratchPool::buffer_t workspace) {
+    scratchPoolPtr_->set_workspace(workspace);
+  }
+
+  inline void clear_workspace() { scratchPoolPtr_->clear_workspace(); }
+
+  /*  @brief Freeing the idle device memory held by the scratch pool */
+  inline void trim_scratch() { scratchPoolPtr_->trim(); }
+
+  inline size_t get_scratch_allocation_count() const {
+    return scratchPoolPtr_->get_allocation_count();
+  }
+
+  /*  @brief Keeping a temporary object (e.g. a buffer) alive until the events
+      have completed, so that the caller does not block on its destruction.
+      @tparam object_t is the type of the object
+      @param object is the object to keep alive
+      @param dependencies are the events the lifetime of the object is tied to
+  */
+  // this must be in header as the type of the object is controlled by the
+  // caller
+  template <typename object_t>
+  inline void keep_alive(object_t object,
+                         const typename policy_t::event_t &dependencies) {
+    releaseListPtr_->push(object, dependencies);
+  }
+
+  inline size_t get_num_kept_alive() const { return releaseListPtr_->size(); }
+
+  /*  @brief The profiler recording the kernels submitted through this
+      handler, see KernelProfiler
+  */
+  inline KernelProfiler &get_profiler() const { return *profilerPtr_; }
+
   inline const policy_t::device_type get_device_type() const {
     return selectedDeviceType_;
   };
@@ -160,9 +231,15 @@ class PolicyHandler<codeplay_policy> {
 
   inline size_t get_num_compute_units() const { return computeUnits_; }
 
-  inline void wait() { q_.wait(); }
+  inline void wait() {
+    q_.wait();
+    releaseListPtr_->collect();
+  }
 
-  inline void wait(policy_t::event_t evs) { cl::sycl::event::wait(evs); }
+  inline void wait(policy_t::event_t evs) {
+    cl::sycl::event::wait(evs);
+    releaseListPtr_->collect();
+  }
 
   /*  @brief waiting for a list of sycl events
  @param first_event  and next_events are instances of sycl::sycl::event
@@ -172,11 +249,15 @@ class PolicyHandler<codeplay_policy> {
   template <typename first_event_t, typename... next_event_t>
   void inline wait(first_event_t first_event, next_event_t... next_events) {
     cl::sycl::event::wait(concatenate_vectors(first_event, next_events...));
+    releaseListPtr_->collect();
   }
 
  private:
   typename policy_t::queue_t q_;
   std::shared_ptr<cl::sycl::codeplay::PointerMapper> pointerMapperPtr_;
+  std::shared_ptr<ScratchPool> scratchPoolPtr_;
+  std::shared_ptr<DeferredReleaseList> releaseListPtr_;
+  std::shared_ptr<KernelProfiler> profilerPtr_;
   const size_t workGroupSize_;
   const policy_t::device_type selectedDeviceType_;
   const bool localMemorySupport_;
@@ -0,0 +1,91 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_release_list.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SYCL_RELEASE_LIST_H
+#define SYCL_BLAS_SYCL_RELEASE_LIST_H
+
+#include "policy/sycl_policy.h"
+#include <CL/sycl.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief List of objects kept alive until the events they are tied to have
+ * completed.
+ *
+ * The destructor of the last copy of a SYCL buffer blocks until the kernels
+ * using the buffer have finished. Handing a temporary buffer to this list
+ * instead of letting it go out of scope lets a routine return as soon as its
+ * kernels have been submitted. The objects are dropped by collect, which is
+ * called on every push and whenever the policy handler waits on the queue.
+ */
+class DeferredReleaseList {
+ public:
+  using event_t = codeplay_policy::event_t;
+
+  DeferredReleaseList() = default;
+
+  /*!
+   * @brief Keeps a copy of object alive until all the dependencies have
+   * completed.
+   * @tparam object_t any copyable type, usually a buffer or a BufferIterator
+   * @param object the object to keep alive
+   * @param dependencies the events the lifetime of the object is tied to
+   */
+  // this must be in the header as the type of the object is only known by the
+  // caller
+  template <typename object_t>
+  void push(object_t object, const event_t &dependencies) {
+    collect();
+    std::shared_ptr<void> holder = std::make_shared<object_t>(object);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.push_back(Entry{holder, dependencies});
+  }
+
+  /*!
+   * @brief Drops the objects whose dependencies have completed.
+   */
+  void collect();
+
+  /*!
+   * @brief Returns the number of objects still kept alive.
+   */
+  size_t size() const;
+
+ private:
+  struct Entry {
+    std::shared_ptr<void> object;
+    event_t dependencies;
+  };
+
+  mutable std::mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SYCL_RELEASE_LIST_H
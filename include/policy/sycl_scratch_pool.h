@@ -0,0 +1,190 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_scratch_pool.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SYCL_SCRATCH_POOL_H
+#define SYCL_BLAS_SYCL_SCRATCH_POOL_H
+
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include "policy/sycl_policy.h"
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace blas {
+
+/*!
+ * @brief Handle to a block of device memory borrowed from a ScratchPool.
+ *
+ * The iterator can be used like any other BufferIterator. The block id is
+ * needed to give the memory back to the pool once the kernels using it have
+ * been submitted.
+ */
+template <typename element_t>
+class ScratchBuffer {
+ public:
+  using iterator_t = BufferIterator<element_t, codeplay_policy>;
+
+  ScratchBuffer(iterator_t iterator, size_t block_id)
+      : iterator_(iterator), block_id_(block_id) {}
+
+  inline iterator_t get_iterator() const { return iterator_; }
+
+  inline size_t get_block_id() const { return block_id_; }
+
+ private:
+  iterator_t iterator_;
+  size_t block_id_;
+};
+
+/*!
+ * @brief Size-bucketed pool of device memory used for the temporaries of the
+ * BLAS routines (reduction scratch, GEMV dot products, tall and skinny GEMM
+ * cube buffer, ...).
+ *
+ * Requests are rounded up to a power of two of at least min_block_bytes and
+ * served from an idle block of the same bucket whose last users have
+ * completed. A new block is only allocated when no such block exists, so a
+ * steady stream of calls of the same shape does not allocate at all.
+ *
+ * A user-supplied workspace can be attached with set_workspace. Blocks are
+ * then carved from the workspace before the pool allocates its own memory.
+ */
+class ScratchPool {
+ public:
+  using byte_t = uint8_t;
+  using buffer_t = codeplay_policy::buffer_t<byte_t, 1>;
+  using event_t = codeplay_policy::event_t;
+
+  /*!
+   * @brief Smallest block handed out by the pool, also the required
+   * granularity of a user workspace.
+   */
+  static constexpr size_t min_block_bytes = 256;
+
+  ScratchPool();
+
+  /*!
+   * @brief Borrows a block large enough for num_elements elements.
+   * @tparam element_t type of the elements stored in the block
+   * @param num_elements the number of elements required
+   */
+  template <typename element_t>
+  ScratchBuffer<element_t> acquire(size_t num_elements);
+
+  /*!
+   * @brief Borrows a block which is filled with zeros when allocated. These
+   * blocks are only shared between users of acquire_zeroed, which must give
+   * them back with the content they expect to find (e.g. reset counters).
+   * @tparam element_t type of the elements stored in the block
+   * @param num_elements the number of elements required
+   */
+  template <typename element_t>
+  ScratchBuffer<element_t> acquire_zeroed(size_t num_elements);
+
+  /*!
+   * @brief Gives a block back to the pool. The block will not be handed out
+   * again before all the dependencies have completed.
+   * @param block_id the id returned alongside the block by acquire
+   * @param dependencies the events of the kernels using the block
+   */
+  void release(size_t block_id, const event_t &dependencies);
+
+  /*!
+   * @brief Attaches a user-provided workspace to the pool. Its size in bytes
+   * must be a multiple of min_block_bytes. Work already submitted using the
+   * previous workspace must complete before that memory is reused.
+   */
+  void set_workspace(buffer_t workspace);
+
+  /*!
+   * @brief Detaches the user-provided workspace, if any.
+   */
+  void clear_workspace();
+
+  /*!
+   * @brief Frees the idle blocks owned by the pool.
+   */
+  void trim();
+
+  /*!
+   * @brief Returns the number of device allocations made by the pool since
+   * its creation.
+   */
+  size_t get_allocation_count() const;
+
+  /*!
+   * @brief Returns the number of bytes currently held by the pool, including
+   * the blocks carved from the workspace.
+   */
+  size_t get_reserved_bytes() const;
+
+ private:
+  struct Block {
+    Block(buffer_t buff, size_t off, size_t sz, bool workspace, bool zero)
+        : buffer(buff),
+          offset(off),
+          size(sz),
+          in_use(true),
+          from_workspace(workspace),
+          zeroed(zero),
+          retired(false) {}
+    buffer_t buffer;
+    /* offset and size in bytes */
+    size_t offset;
+    size_t size;
+    bool in_use;
+    bool from_workspace;
+    /* the block belongs to the users of acquire_zeroed */
+    bool zeroed;
+    /* the workspace the block was carved from has been detached */
+    bool retired;
+    event_t pending;
+  };
+
+  /* Returns the id of a block of at least num_bytes, mutex_ must be held */
+  size_t acquire_block(size_t num_bytes, bool zeroed);
+
+  /* Builds the iterator over a block, mutex_ must be held */
+  template <typename element_t>
+  ScratchBuffer<element_t> make_scratch_buffer(size_t block_id) const;
+
+  /* Drops the workspace blocks, mutex_ must be held */
+  void retire_workspace();
+
+  static size_t get_bucket_size(size_t num_bytes);
+
+  mutable std::mutex mutex_;
+  std::map<size_t, Block> blocks_;
+  size_t next_block_id_;
+  size_t allocation_count_;
+  std::unique_ptr<buffer_t> workspace_;
+  size_t workspace_used_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SYCL_SCRATCH_POOL_H
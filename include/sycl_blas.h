@@ -29,10 +29,16 @@
 
 #include "policy/sycl_policy.h"
 
+#include "policy/host_policy.h"
+
 #include "container/blas_iterator.h"
 
 #include "container/sycl_iterator.h"
 
+#include "container/host_iterator.h"
+
+#include "container/scalar_future.h"
+
 #include "executors/executor.h"
 
 #include "executors/kernel_constructor.h"
@@ -43,6 +49,8 @@
 
 #include "interface/blas3_interface.h"
 
+#include "interface/gemm_dispatch_table.h"
+
 #include "interface/gemm_launcher.h"
 
 #include "operations/blas1_trees.h"
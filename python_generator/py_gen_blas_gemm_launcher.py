@@ -63,6 +63,8 @@ if __name__ == '__main__':
     gemm_vectorize_type = sys.argv[28]
     vector_size = sys.argv[29]
     batch_type = sys.argv[30]
+    input_data = sys.argv[31]
+    output_data = sys.argv[32]
     source = 'generated_src/' + blas_level_name + '/' + blas_function_name + '/'
 
     try:
@@ -174,6 +176,16 @@ if __name__ == '__main__':
             vals=[data],
             itermode=Itermode.combinations,
             iter_modifier=1),
+        Iterable(
+            key='INPUT_DATA_TYPE',
+            vals=[input_data],
+            itermode=Itermode.combinations,
+            iter_modifier=1),
+        Iterable(
+            key='OUTPUT_DATA_TYPE',
+            vals=[output_data],
+            itermode=Itermode.combinations,
+            iter_modifier=1),
         Iterable(
             key='INDEX_TYPE',
             vals=[index],
@@ -0,0 +1,370 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename executor_host.hpp
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_EXECUTOR_HOST_HPP
+#define SYCL_BLAS_EXECUTOR_HOST_HPP
+
+#include "blas_meta.h"
+#include "executors/executor.h"
+#include "policy/host_policy_handler.h"
+#include "views/view_host.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace blas {
+
+namespace host {
+
+/*!
+ * @brief Number of indices of a tree evaluated at once by a thread, so that
+ * the elements touched by a chunk fit in host_policy::chunk_bytes.
+ */
+template <typename value_t>
+inline size_t get_chunk_size() {
+  return std::max<size_t>(1, host_policy::chunk_bytes / sizeof(value_t));
+}
+
+/*!
+ * @brief Evaluates the indices of the tree in [first, last) which it accepts
+ * as valid threads. Each chunk works on its own copy of the tree, as each
+ * work item does on the device. Only the element-wise trees can be checked
+ * for an index rather than a work item, the others are not evaluated by the
+ * host this way.
+ */
+template <typename expression_tree_t, typename index_t>
+inline void eval_range(expression_tree_t t, index_t first, index_t last) {
+  for (index_t i = first; i < last; ++i) {
+    if (t.valid_thread(i)) {
+      t.eval(i);
+    }
+  }
+}
+
+}  // namespace host
+
+/*!
+ * @brief Evaluates the tree on the host threads. The index space is split in
+ * chunks of host_policy::chunk_bytes which the threads take in turn.
+ */
+template <>
+template <typename expression_tree_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(expression_tree_t t) {
+  using index_t = decltype(t.get_size());
+  t.adjust_access_displacement();
+  const index_t _N = t.get_size();
+  const index_t chunk = static_cast<index_t>(
+      host::get_chunk_size<typename expression_tree_t::value_t>());
+  const index_t num_chunks = (_N + chunk - 1) / chunk;
+  policy_handler_.get_queue().parallel_for(
+      static_cast<size_t>(num_chunks), [&](size_t c) {
+        const index_t first = static_cast<index_t>(c) * chunk;
+        host::eval_range(t, first, std::min(first + chunk, _N));
+      });
+  return {};
+}
+
+/*!
+ * @brief The work group sizes are meaningless on the host, the tree is
+ * evaluated as in the default case.
+ */
+template <>
+template <typename expression_tree_t, typename index_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(expression_tree_t t, index_t) {
+  return execute(t);
+}
+
+template <>
+template <typename expression_tree_t, typename index_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(expression_tree_t t, index_t,
+                                              index_t) {
+  return execute(t);
+}
+
+template <>
+template <typename expression_tree_t, typename index_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(expression_tree_t t, index_t,
+                                              index_t, index_t) {
+  return execute(t);
+}
+
+/*!
+ * @brief Applies a reduction to a tree. Each chunk is reduced by one thread
+ * and the partial results are combined in chunk order, so the result does
+ * not depend on the number of threads.
+ */
+template <>
+template <typename operator_t, typename lhs_t, typename rhs_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(
+    AssignReduction<operator_t, lhs_t, rhs_t> t) {
+  using index_t = typename AssignReduction<operator_t, lhs_t, rhs_t>::index_t;
+  using value_t = typename AssignReduction<operator_t, lhs_t, rhs_t>::value_t;
+  t.adjust_access_displacement();
+  const value_t init_val = operator_t::template init<rhs_t>();
+  const index_t _N = t.rhs_.get_size();
+  const index_t chunk =
+      static_cast<index_t>(host::get_chunk_size<value_t>());
+  const index_t num_chunks = (_N + chunk - 1) / chunk;
+  std::vector<value_t> partials(static_cast<size_t>(num_chunks), init_val);
+  policy_handler_.get_queue().parallel_for(
+      static_cast<size_t>(num_chunks), [&](size_t c) {
+        rhs_t rhs = t.rhs_;
+        const index_t first = static_cast<index_t>(c) * chunk;
+        const index_t last = std::min(first + chunk, _N);
+        value_t val = init_val;
+        for (index_t i = first; i < last; ++i) {
+          val = operator_t::eval(val, rhs.eval(i));
+        }
+        partials[c] = val;
+      });
+  value_t val = init_val;
+  for (const value_t &partial : partials) {
+    val = operator_t::eval(val, partial);
+  }
+  t.lhs_.eval(0) = val;
+  return {};
+}
+
+template <>
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename local_memory_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(
+    AssignReduction<operator_t, lhs_t, rhs_t> t, local_memory_t) {
+  return execute(t);
+}
+
+/*!
+ * @brief Both strategies are a single pass over the data on the host.
+ */
+template <>
+template <typename operator_t, typename lhs_t, typename rhs_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(
+    AssignReduction<operator_t, lhs_t, rhs_t> t, reduction_strategy_t) {
+  return execute(t);
+}
+
+namespace host {
+
+/*!
+ * @brief Computes the columns [first_col, last_col) of one matrix of the
+ * batch. The innermost loop runs over the rows of C, which are contiguous,
+ * so that it can be vectorized by the compiler when A is not transposed.
+ * The products are accumulated in element_t, whatever the types A, B
+ * (input_value_t) and C (output_value_t) are stored in.
+ */
+template <bool trans_a, bool trans_b, bool is_beta_zero, typename input_value_t,
+          typename output_value_t, typename element_t, typename index_t,
+          typename epilogue_t, typename prologue_t>
+inline void gemm_columns(const input_value_t *a, const input_value_t *b,
+                         output_value_t *c, index_t m, index_t k, index_t lda,
+                         index_t ldb, index_t ldc, element_t alpha,
+                         element_t beta, index_t first_col, index_t last_col,
+                         epilogue_t epilogue, prologue_t prologue) {
+  std::vector<element_t> acc(static_cast<size_t>(m));
+  for (index_t j = first_col; j < last_col; ++j) {
+    std::fill(acc.begin(), acc.end(), element_t{0});
+    element_t *acc_ptr = acc.data();
+    for (index_t p = 0; p < k; ++p) {
+      const element_t b_pj = prologue.eval_b(
+          element_t(trans_b ? b[j + p * ldb] : b[p + j * ldb]), p, j);
+      if (trans_a) {
+        for (index_t i = 0; i < m; ++i) {
+          acc_ptr[i] += prologue.eval_a(element_t(a[p + i * lda]), i, p) * b_pj;
+        }
+      } else {
+        const input_value_t *a_col = a + p * lda;
+        for (index_t i = 0; i < m; ++i) {
+          acc_ptr[i] += prologue.eval_a(element_t(a_col[i]), i, p) * b_pj;
+        }
+      }
+    }
+    output_value_t *c_col = c + j * ldc;
+    for (index_t i = 0; i < m; ++i) {
+      c_col[i] = output_value_t(epilogue.eval(
+          is_beta_zero ? alpha * acc_ptr[i]
+                       : alpha * acc_ptr[i] + beta * element_t(c_col[i]),
+          i, j));
+    }
+  }
+}
+
+/*!
+ * @brief Returns the epilogue of a GEMM tree. Only the trees fusing an
+ * epilogue store one, the others are given a GemmNoEpilogue.
+ */
+template <typename epilogue_t, typename gemm_t>
+inline typename std::enable_if<epilogue_t::is_identity, epilogue_t>::type
+get_epilogue(gemm_t &) {
+  return epilogue_t();
+}
+
+template <typename epilogue_t, typename gemm_t>
+inline typename std::enable_if<!epilogue_t::is_identity, epilogue_t>::type
+get_epilogue(gemm_t &gemm) {
+  return gemm.epilogue_;
+}
+
+/*!
+ * @brief Returns the prologue of a GEMM tree, like get_epilogue.
+ */
+template <typename prologue_t, typename gemm_t>
+inline typename std::enable_if<prologue_t::is_identity, prologue_t>::type
+get_prologue(gemm_t &) {
+  return prologue_t();
+}
+
+template <typename prologue_t, typename gemm_t>
+inline typename std::enable_if<!prologue_t::is_identity, prologue_t>::type
+get_prologue(gemm_t &gemm) {
+  return gemm.prologue_;
+}
+
+/*!
+ * @brief The interleaved batched GEMM trees have no host implementation.
+ */
+template <bool trans_a, bool trans_b, bool is_beta_zero, int BatchType,
+          bool beta_over_alpha, typename epilogue_t, typename prologue_t,
+          typename gemm_t>
+inline typename std::enable_if<static_cast<gemm_batch_type_t>(BatchType) ==
+                               gemm_batch_type_t::interleaved>::type
+run_gemm(HostQueue, gemm_t &) {
+  throw std::invalid_argument(
+      "The interleaved batched GEMM is not supported on the host");
+}
+
+/*!
+ * @brief Runs a (strided batched) GEMM tree on the host threads. The work is
+ * split in blocks of columns of C of about host_policy::chunk_bytes.
+ * The tiled GEMM trees store beta / alpha rather than beta, which is given by
+ * beta_over_alpha.
+ */
+template <bool trans_a, bool trans_b, bool is_beta_zero, int BatchType,
+          bool beta_over_alpha, typename epilogue_t, typename prologue_t,
+          typename gemm_t>
+inline typename std::enable_if<static_cast<gemm_batch_type_t>(BatchType) ==
+                               gemm_batch_type_t::strided>::type
+run_gemm(HostQueue q, gemm_t &gemm) {
+  using element_t = typename gemm_t::value_t;
+  using input_value_t = typename std::remove_const<typename std::remove_pointer<
+      decltype(gemm.a_.get_pointer())>::type>::type;
+  using output_value_t = typename std::remove_pointer<decltype(
+      gemm.c_.get_pointer())>::type;
+  using index_t = typename gemm_t::index_t;
+  gemm.a_.adjust_access_displacement();
+  gemm.b_.adjust_access_displacement();
+  gemm.c_.adjust_access_displacement();
+  auto epilogue = get_epilogue<epilogue_t>(gemm);
+  epilogue.adjust_access_displacement();
+  auto prologue = get_prologue<prologue_t>(gemm);
+  prologue.adjust_access_displacement();
+  const index_t m = gemm.a_.get_size_row();
+  const index_t k = gemm.a_.get_size_col();
+  const index_t n = gemm.b_.get_size_col();
+  const index_t lda = gemm.a_.getSizeL();
+  const index_t ldb = gemm.b_.getSizeL();
+  const index_t ldc = gemm.c_.getSizeL();
+  const index_t batch_size = gemm.batch_size_;
+  // The matrices of a strided batch are as far apart as the caller asked,
+  // which may be more or less than a matrix
+  const index_t stride_a = gemm.stride_a_;
+  const index_t stride_b = gemm.stride_b_;
+  const index_t stride_c = gemm.stride_c_;
+  const index_t cols_per_chunk = std::max<index_t>(
+      1, static_cast<index_t>(get_chunk_size<element_t>()) /
+             std::max<index_t>(1, m));
+  const index_t chunks_per_batch = (n + cols_per_chunk - 1) / cols_per_chunk;
+  const input_value_t *a = gemm.a_.get_pointer();
+  const input_value_t *b = gemm.b_.get_pointer();
+  output_value_t *c = gemm.c_.get_pointer();
+  const element_t alpha = gemm.alpha_;
+  const element_t beta = beta_over_alpha ? gemm.beta_ * alpha : gemm.beta_;
+  q.parallel_for(static_cast<size_t>(batch_size * chunks_per_batch),
+                 [&](size_t chunk) {
+                   const index_t batch =
+                       static_cast<index_t>(chunk) / chunks_per_batch;
+                   const index_t first =
+                       (static_cast<index_t>(chunk) % chunks_per_batch) *
+                       cols_per_chunk;
+                   gemm_columns<trans_a, trans_b, is_beta_zero>(
+                       a + batch * stride_a, b + batch * stride_b,
+                       c + batch * stride_c, m, k, lda, ldb, ldc, alpha, beta,
+                       first, std::min(first + cols_per_chunk, n),
+                       epilogue, prologue);
+                 });
+}
+
+}  // namespace host
+
+/*!
+ * @brief Executes a GEMM on the host, whatever the configuration of the
+ * tree: the tiling parameters only make sense on a device.
+ */
+template <>
+template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+          bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+          typename element_t, bool is_beta_zero, int GemmMemoryType,
+          int GemmAlgorithm, int GemmVectorization, int VectorSize,
+          int BatchType, typename epilogue_t, typename prologue_t>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(
+    Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
+         TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
+         GemmVectorization, VectorSize, BatchType, epilogue_t, prologue_t>
+        gemm_tree) {
+  host::run_gemm<TransA, TransB, is_beta_zero, BatchType,
+                 static_cast<gemm_algorithm_t>(GemmAlgorithm) ==
+                     gemm_algorithm_t::standard,
+                 epilogue_t, prologue_t>(policy_handler_.get_queue(),
+                                         gemm_tree);
+  return {};
+}
+
+template <>
+template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+          bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+          typename element_t, bool is_beta_zero, int GemmMemoryType,
+          int GemmVectorization, int VectorSize, int BatchType>
+inline typename host_policy::event_t
+Executor<PolicyHandler<host_policy>>::execute(
+    Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
+         TransB, element_t, is_beta_zero, GemmMemoryType,
+         static_cast<int>(gemm_algorithm_t::tall_skinny), GemmVectorization,
+         VectorSize, BatchType>
+        gemm_wrapper) {
+  host::run_gemm<TransA, TransB, is_beta_zero, BatchType, false,
+                 GemmNoEpilogue, GemmNoPrologue>(policy_handler_.get_queue(),
+                                                 gemm_wrapper);
+  return {};
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_EXECUTOR_HOST_HPP
@@ -56,7 +56,7 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t) {
   auto globalSize = nWG * localSize;
 
   return {execute_tree<using_local_memory::disabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, 0)};
+      policy_handler_, t, localSize, globalSize, 0)};
 };
 
 /*!
@@ -72,7 +72,7 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t,
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
   return {execute_tree<using_local_memory::disabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, 0)};
+      policy_handler_, t, localSize, globalSize, 0)};
 };
 
 /*!
@@ -86,7 +86,7 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t,
                                                   index_t localSize,
                                                   index_t globalSize) {
   return {execute_tree<using_local_memory::disabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, 0)};
+      policy_handler_, t, localSize, globalSize, 0)};
 }
 
 /*!
@@ -101,7 +101,7 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t,
                                                   index_t globalSize,
                                                   index_t shMem) {
   return {execute_tree<using_local_memory::enabled>(
-      policy_handler_.get_queue(), t, localSize, globalSize, shMem)};
+      policy_handler_, t, localSize, globalSize, shMem)};
 }
 
 /*!
@@ -125,10 +125,12 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
 
   // Two accessors to local memory
   auto sharedSize = ((nWG < localSize) ? localSize : nWG);
-  auto shMem1 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
-  auto shMem2 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
-  auto opShMem1 = lhs_t(shMem1, 1, sharedSize);
-  auto opShMem2 = lhs_t(shMem2, 1, sharedSize);
+  auto shMem1 = policy_handler_.template acquire_scratch<
+      typename lhs_t::value_t>(sharedSize);
+  auto shMem2 = policy_handler_.template acquire_scratch<
+      typename lhs_t::value_t>(sharedSize);
+  auto opShMem1 = lhs_t(shMem1.get_iterator(), 1, sharedSize);
+  auto opShMem2 = lhs_t(shMem2.get_iterator(), 1, sharedSize);
   typename codeplay_policy::event_t event;
   bool frst = true;
   bool even = false;
@@ -139,22 +141,22 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
       auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
                                          localSize, globalSize);
       event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+          policy_handler_, localTree, localSize, globalSize, sharedSize));
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
       auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
           ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
           (even ? opShMem1 : opShMem2), localSize, globalSize);
       event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+          policy_handler_, localTree, localSize, globalSize, sharedSize));
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
     frst = false;
     even = !even;
   } while (_N > 1);
+  policy_handler_.release_scratch(shMem1, event);
+  policy_handler_.release_scratch(shMem2, event);
   return event;
 }
 
@@ -193,16 +195,14 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
       auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
                                          localSize, globalSize);
       event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+          policy_handler_, localTree, localSize, globalSize, sharedSize));
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
       auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
           ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
           (even ? opShMem1 : opShMem2), localSize, globalSize);
       event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
+          policy_handler_, localTree, localSize, globalSize, sharedSize));
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
@@ -212,27 +212,80 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
   return event;
 }
 
+/*!
+ * @brief Applies a reduction to a tree with the given strategy. The single
+ * pass strategy launches at most as many work groups as there are threads in
+ * a work group, so that the last work group to finish can reduce all the
+ * partial results in the same kernel.
+ */
+template <>
+template <typename operator_t, typename lhs_t, typename rhs_t>
+inline typename codeplay_policy::event_t
+Executor<PolicyHandler<codeplay_policy>>::execute(
+    AssignReduction<operator_t, lhs_t, rhs_t> t,
+    reduction_strategy_t strategy) {
+  if (strategy == reduction_strategy_t::multi_pass) {
+    return execute(t);
+  }
+  using index_t = typename AssignReduction<operator_t, lhs_t, rhs_t>::index_t;
+  using value_t = typename lhs_t::value_t;
+  const index_t _N = t.get_size();
+  const index_t localSize = t.local_num_thread_;
+  // Each work group processes at least two blocks of elements
+  index_t nWG = (t.global_num_thread_ + (2 * localSize) - 1) / (2 * localSize);
+  const index_t nWG_needed = (_N + (2 * localSize) - 1) / (2 * localSize);
+  nWG = std::max(index_t(1), std::min(nWG, std::min(nWG_needed, localSize)));
+  const index_t globalSize = nWG * localSize;
+  auto lhs = t.lhs_;
+  auto rhs = t.rhs_;
+
+  if (nWG == 1) {
+    // A single work group writes the result directly
+    auto localTree = AssignReduction<operator_t, lhs_t, rhs_t>(
+        lhs, rhs, localSize, globalSize);
+    return {execute_tree<using_local_memory::enabled>(
+        policy_handler_, localTree, localSize, globalSize, localSize)};
+  }
+
+  auto partials = policy_handler_.template acquire_scratch<value_t>(nWG);
+  auto sync = policy_handler_.template acquire_zeroed_scratch<int>(nWG + 1);
+  auto partialsView = lhs_t(partials.get_iterator(), 1, nWG);
+  auto syncAcc = get_range_accessor<cl::sycl::access::mode::atomic>(
+      sync.get_iterator(), nWG + 1);
+  auto localTree = make_AssignReductionSinglePass<operator_t>(
+      lhs, rhs, partialsView, syncAcc,
+      static_cast<index_t>(sync.get_iterator().get_offset()), localSize,
+      globalSize);
+  typename codeplay_policy::event_t event{execute_tree<
+      using_local_memory::enabled>(policy_handler_, localTree, localSize,
+                                   globalSize, localSize)};
+  policy_handler_.release_scratch(partials, event);
+  policy_handler_.release_scratch(sync, event);
+  return event;
+}
+
 template <>
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 inline typename codeplay_policy::event_t
 Executor<PolicyHandler<codeplay_policy>>::execute(
     Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
          TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-         GemmVectorization, VectorSize, BatchType>
+         GemmVectorization, VectorSize, BatchType, epilogue_t, prologue_t>
         gemm_tree) {
   using gemm_t =
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm, GemmVectorization, VectorSize, BatchType>;
+           GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+           epilogue_t, prologue_t>;
   auto rng = gemm_tree.get_nd_range(policy_handler_.get_num_compute_units());
   return {execute_tree<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
              using_local_memory::enabled, using_local_memory::disabled>::type>(
-      policy_handler_.get_queue(), gemm_tree, rng.get_local_range()[0],
+      policy_handler_, gemm_tree, rng.get_local_range()[0],
       rng.get_global_range()[0], gemm_t::local_memory_size)};
 }
 
@@ -276,7 +329,9 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
 
   /* First step: partial gemm */
   /* Create the cube buffer that will hold the output of the partial gemm */
-  auto cube_buffer = make_sycl_iterator_buffer<element_t>(rows * cols * depth);
+  auto cube_scratch =
+      policy_handler_.template acquire_scratch<element_t>(rows * cols * depth);
+  auto cube_buffer = cube_scratch.get_iterator();
 
   /* Create a first matrix view used for the partial gemm */
   auto cube_gemm =
@@ -307,9 +362,10 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
   /* Otherwise we reduce to a temporary buffer */
   else {
     /* Create a temporary buffer to hold alpha * A * B */
-    auto temp_buffer = make_sycl_iterator_buffer<element_t>(rows * cols);
-    auto temp =
-        make_matrix_view<col_major>(*this, temp_buffer, rows, cols, rows);
+    auto temp_scratch =
+        policy_handler_.template acquire_scratch<element_t>(rows * cols);
+    auto temp = make_matrix_view<col_major>(
+        *this, temp_scratch.get_iterator(), rows, cols, rows);
 
     /* Execute the reduction */
     constexpr int work_group_size = tile_type::wg_rows * tile_type::wg_cols;
@@ -331,8 +387,10 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
       auto assignOp = make_op<Assign>(gemm_wrapper.c_, addOp);
       events = concatenate_vectors(events, execute(assignOp));
     }
+    policy_handler_.release_scratch(temp_scratch, events);
   }
 
+  policy_handler_.release_scratch(cube_scratch, events);
   return events;
 }
 
@@ -351,8 +409,7 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
   return {execute_tree<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
              using_local_memory::enabled, using_local_memory::disabled>::type>(
-      policy_handler_.get_queue(), gemm_partial,
-      gemm_partial_range.get_local_range()[0],
+      policy_handler_, gemm_partial, gemm_partial_range.get_local_range()[0],
       gemm_partial_range.get_global_range()[0],
       gemm_partial.local_memory_size)};
 }
@@ -360,15 +417,16 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
 /* Utility function used by the ReductionPartialRows specialization */
 template <typename operator_t, int ClSize, int WgSize, typename element_t,
           typename input_t, typename output_t, typename index_t,
-          typename queue_t>
+          typename policy_handler_t>
 static inline cl::sycl::event launch_row_reduction_step(
-    queue_t queue, input_t& in, output_t& out, index_t group_count_cols,
-    index_t local_memory_size, index_t num_compute_units) {
+    policy_handler_t& policy_handler, input_t& in, output_t& out,
+    index_t group_count_cols, index_t local_memory_size,
+    index_t num_compute_units) {
   ReductionPartialRows<operator_t, input_t, output_t, ClSize, WgSize, element_t>
       reduction_step(in, out, group_count_cols);
   auto step_range = reduction_step.get_nd_range(num_compute_units);
   return execute_tree<using_local_memory::enabled>(
-      queue, reduction_step, step_range.get_local_range()[0],
+      policy_handler, reduction_step, step_range.get_local_range()[0],
       step_range.get_global_range()[0], local_memory_size);
 }
 
@@ -411,28 +469,30 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
             : max_group_count_col;
 
     /* Create a temporary buffer */
-    auto temp_buffer =
-        make_sycl_iterator_buffer<element_t>(rows_ * group_count_cols);
-    auto temp_ = make_matrix_view<col_major>(*this, temp_buffer, rows_,
-                                             group_count_cols, rows_);
+    auto temp_scratch = policy_handler_.template acquire_scratch<element_t>(
+        rows_ * group_count_cols);
+    auto temp_ = make_matrix_view<col_major>(
+        *this, temp_scratch.get_iterator(), rows_, group_count_cols, rows_);
 
     /* 1st step */
     reduction_event.push_back(
         launch_row_reduction_step<operator_t, ClSize, WgSize, element_t>(
-            policy_handler_.get_queue(), in_, temp_, group_count_cols,
+            policy_handler_, in_, temp_, group_count_cols,
             params_t::local_memory_size, num_compute_units));
 
     /* 2nd step */
     reduction_event.push_back(
         launch_row_reduction_step<operator_t, ClSize, WgSize, element_t>(
-            policy_handler_.get_queue(), temp_, out_, index_t(1),
+            policy_handler_, temp_, out_, index_t(1),
             params_t::local_memory_size, num_compute_units));
+
+    policy_handler_.release_scratch(temp_scratch, reduction_event);
   }
   /* 1-step reduction */
   else {
     reduction_event.push_back(
         launch_row_reduction_step<operator_t, ClSize, WgSize, element_t>(
-            policy_handler_.get_queue(), in_, out_, index_t(1),
+            policy_handler_, in_, out_, index_t(1),
             params_t::local_memory_size, num_compute_units));
   }
 
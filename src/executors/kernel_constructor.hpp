@@ -160,14 +160,28 @@ struct ExpressionTreeFunctor {
   }
 };
 
-template <int using_local_memory, typename queue_t, typename expression_tree_t>
-static SYCL_BLAS_INLINE cl::sycl::event execute_tree(queue_t q_,
-                                                     expression_tree_t t,
-                                                     size_t _localSize,
-                                                     size_t _globalSize,
-                                                     size_t _shMem) {
+/*!
+@brief Size in bytes of an element of the shared memory, zero when the kernel
+does not use shared memory.
+*/
+template <typename value_t>
+struct LocalMemoryElementSize {
+  static constexpr size_t value = sizeof(value_t);
+};
+
+template <>
+struct LocalMemoryElementSize<void> {
+  static constexpr size_t value = 0;
+};
+
+template <int using_local_memory, typename policy_handler_t,
+          typename expression_tree_t>
+static SYCL_BLAS_INLINE cl::sycl::event execute_tree(
+    policy_handler_t &policy_handler, expression_tree_t t, size_t _localSize,
+    size_t _globalSize, size_t _shMem) {
   using value_t =
       typename LocalMemoryType<using_local_memory, expression_tree_t>::type;
+  auto q_ = policy_handler.get_queue();
 
   auto localSize = _localSize;
   auto globalSize = _globalSize;
@@ -187,6 +201,12 @@ static SYCL_BLAS_INLINE cl::sycl::event execute_tree(queue_t q_,
     };
 
     ev = q_.submit(cg1);
+    auto &profiler = policy_handler.get_profiler();
+    if (profiler.is_enabled()) {
+      profiler.record(KernelName<expression_tree_t>::get(), globalSize,
+                      localSize,
+                      shMem * LocalMemoryElementSize<value_t>::value, ev);
+    }
     return ev;
   } catch (cl::sycl::exception e) {
     std::cerr << e.what() << std::endl;
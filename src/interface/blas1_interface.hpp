@@ -60,7 +60,8 @@ typename executor_t::policy_t::event_t _axpy(
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto vy = make_vector_view(ex, _vy, _incy, _N);
 
-  auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+  auto scalOp =
+      make_op<ScalarOp, ProductOperator>(make_scalar_operand(ex, _alpha), vx);
   auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
   auto assignOp = make_op<Assign>(vy, addOp);
   auto ret = ex.execute(assignOp);
@@ -115,7 +116,7 @@ typename executor_t::policy_t::event_t _dot(
 
   auto assignOp =
       make_AssignReduction<AddOperator>(rs, prdOp, localSize, localSize * nWG);
-  auto ret = ex.execute(assignOp);
+  auto ret = ex.execute(assignOp, ReductionStrategy<AddOperator>::value);
   return ret;
 }
 
@@ -139,7 +140,8 @@ typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
   const auto nWG = 2 * localSize;
   auto assignOp = make_AssignReduction<AbsoluteAddOperator>(rs, vx, localSize,
                                                             localSize * nWG);
-  auto ret = ex.execute(assignOp);
+  auto ret =
+      ex.execute(assignOp, ReductionStrategy<AbsoluteAddOperator>::value);
   return ret;
 }
 
@@ -162,7 +164,7 @@ typename executor_t::policy_t::event_t _iamax(executor_t &ex, index_t _N,
   auto tupOp = make_tuple_op(vx);
   auto assignOp =
       make_AssignReduction<IMaxOperator>(rs, tupOp, localSize, localSize * nWG);
-  auto ret = ex.execute(assignOp);
+  auto ret = ex.execute(assignOp, ReductionStrategy<IMaxOperator>::value);
   return ret;
 }
 
@@ -186,7 +188,7 @@ typename executor_t::policy_t::event_t _iamin(executor_t &ex, index_t _N,
   auto tupOp = make_tuple_op(vx);
   auto assignOp =
       make_AssignReduction<IMinOperator>(rs, tupOp, localSize, localSize * nWG);
-  auto ret = ex.execute(assignOp);
+  auto ret = ex.execute(assignOp, ReductionStrategy<IMinOperator>::value);
   return ret;
 }
 
@@ -227,13 +229,15 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx) {
   auto vx = make_vector_view(ex, _vx, _incx, _N);
-  if (_alpha == element_t{0}) {
+  if (is_scalar_zero(_alpha)) {
     auto zeroOp = make_op<UnaryOp, AdditionIdentity>(vx);
     auto assignOp = make_op<Assign>(vx, zeroOp);
     auto ret = ex.execute(assignOp);
     return ret;
   } else {
-    auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
+    // A device alpha of zero still zeroes x, as the host one does
+    auto scalOp = make_op<ScalarOp, ScaleOutputOperator>(
+        make_scalar_operand(ex, _alpha), vx);
     auto assignOp = make_op<Assign>(vx, scalOp);
     auto ret = ex.execute(assignOp);
     return ret;
@@ -261,7 +265,7 @@ typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
   const auto nWG = 2 * localSize;
   auto assignOp =
       make_AssignReduction<AddOperator>(rs, prdOp, localSize, localSize * nWG);
-  auto ret0 = ex.execute(assignOp);
+  auto ret0 = ex.execute(assignOp, ReductionStrategy<AddOperator>::value);
   auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
   auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
   auto ret1 = ex.execute(assignOpFinal);
@@ -289,10 +293,14 @@ typename executor_t::policy_t::event_t _rot(
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin) {
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto vy = make_vector_view(ex, _vy, _incy, _N);
-  auto scalOp1 = make_op<ScalarOp, ProductOperator>(_cos, vx);
-  auto scalOp2 = make_op<ScalarOp, ProductOperator>(_sin, vy);
-  auto scalOp3 = make_op<ScalarOp, ProductOperator>(-_sin, vx);
-  auto scalOp4 = make_op<ScalarOp, ProductOperator>(_cos, vy);
+  auto cosine = make_scalar_operand(ex, _cos);
+  auto sine = make_scalar_operand(ex, _sin);
+  auto scalOp1 = make_op<ScalarOp, ProductOperator>(cosine, vx);
+  auto scalOp2 = make_op<ScalarOp, ProductOperator>(sine, vy);
+  auto sinMulXOp = make_op<ScalarOp, ProductOperator>(sine, vx);
+  // -sin * x, the sine may only be known on the device
+  auto scalOp3 = make_op<UnaryOp, NegationOperator>(sinMulXOp);
+  auto scalOp4 = make_op<ScalarOp, ProductOperator>(cosine, vy);
   auto addOp12 = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
   auto addOp34 = make_op<BinaryOp, AddOperator>(scalOp3, scalOp4);
   auto DoubleAssignView = make_op<DoubleAssign>(vx, vy, addOp12, addOp34);
@@ -300,6 +308,319 @@ typename executor_t::policy_t::event_t _rot(
   return ret;
 }
 
+/**
+ * \brief AXPY_DOT: \f$y = ax + y\f$ and \f$rs = y \cdot z\f$.
+ *
+ * The assignment to y is a node of the reduced expression, so that y is
+ * updated while its elements are being reduced: the vectors are read once
+ * and the reduction is the only kernel launched.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ * @param _vz  BufferIterator, must not alias _vy
+ * @param _incz Increment in Z axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_dot(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy, container_2_t _vz,
+    increment_t _incz, container_3_t _rs) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto vz = make_vector_view(ex, _vz, _incz, _N);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             static_cast<index_t>(1));
+
+  auto scalOp =
+      make_op<ScalarOp, ProductOperator>(make_scalar_operand(ex, _alpha), vx);
+  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  auto prdOp = make_op<BinaryOp, ProductOperator>(assignOp, vz);
+
+  auto localSize = ex.get_policy_handler().get_work_group_size();
+  auto nWG = 2 * localSize;
+  auto reductionOp =
+      make_AssignReduction<AddOperator>(rs, prdOp, localSize, localSize * nWG);
+  auto ret = ex.execute(reductionOp, ReductionStrategy<AddOperator>::value);
+  return ret;
+}
+
+/**
+ * \brief AXPY_NRM2: \f$y = ax + y\f$ and \f$rs = \|y\|_2\f$, fused in the
+ * same way as _axpy_dot.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _axpy_nrm2(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             static_cast<index_t>(1));
+
+  auto scalOp =
+      make_op<ScalarOp, ProductOperator>(make_scalar_operand(ex, _alpha), vx);
+  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  auto sqrOp = make_op<UnaryOp, SquareOperator>(assignOp);
+
+  const auto localSize = ex.get_policy_handler().get_work_group_size();
+  const auto nWG = 2 * localSize;
+  auto reductionOp =
+      make_AssignReduction<AddOperator>(rs, sqrOp, localSize, localSize * nWG);
+  auto ret0 = ex.execute(reductionOp, ReductionStrategy<AddOperator>::value);
+  auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
+  auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
+  auto ret1 = ex.execute(assignOpFinal);
+  return blas::concatenate_vectors(ret0, ret1);
+}
+
+/**
+ * \brief XPAY: \f$y = x + ay\f$.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _xpay(executor_t &ex, index_t _N,
+                                             container_0_t _vx,
+                                             increment_t _incx,
+                                             element_t _alpha,
+                                             container_1_t _vy,
+                                             increment_t _incy) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+
+  auto scalOp =
+      make_op<ScalarOp, ProductOperator>(make_scalar_operand(ex, _alpha), vy);
+  auto addOp = make_op<BinaryOp, AddOperator>(vx, scalOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
+/**
+ * \brief WAXPBY: \f$w = ax + by\f$.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ * @param _vw  BufferIterator
+ * @param _incw Increment in W axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _waxpby(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, element_t _beta, container_1_t _vy, increment_t _incy,
+    container_2_t _vw, increment_t _incw) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto vw = make_vector_view(ex, _vw, _incw, _N);
+
+  auto alphaMulXOp =
+      make_op<ScalarOp, ProductOperator>(make_scalar_operand(ex, _alpha), vx);
+  auto betaMulYOp =
+      make_op<ScalarOp, ProductOperator>(make_scalar_operand(ex, _beta), vy);
+  auto addOp = make_op<BinaryOp, AddOperator>(alphaMulXOp, betaMulYOp);
+  auto assignOp = make_op<Assign>(vw, addOp);
+  auto ret = ex.execute(assignOp);
+  return ret;
+}
+
+/**
+ * \brief Number of elements spanned by batch_size vectors of _N elements,
+ * _stride elements apart.
+ */
+template <typename index_t, typename increment_t>
+inline index_t get_batch_extent(index_t _N, increment_t _inc, index_t _stride,
+                                index_t _batch_size) {
+  return _stride * (_batch_size - 1) +
+         (_N - 1) * static_cast<index_t>(std::abs(_inc)) + 1;
+}
+
+/**
+ * \brief Reduces each vector of _N elements of a batched tree into one
+ * element of rs, with one work group per vector. The work groups are only as
+ * large as the vectors need, up to the work group size of the device.
+ */
+template <typename operator_t, typename executor_t, typename lhs_t,
+          typename rhs_t, typename index_t>
+typename executor_t::policy_t::event_t _batched_reduction(
+    executor_t &ex, lhs_t rs, rhs_t rhs, index_t _N, index_t _batch_size) {
+  const index_t max_local_size = ex.get_policy_handler().get_work_group_size();
+  index_t localSize = 1;
+  while (localSize < _N && localSize < max_local_size) {
+    localSize *= 2;
+  }
+  auto assignOp = make_AssignBatchedReduction<operator_t>(rs, rhs, _N);
+  return ex.execute(assignOp, localSize, localSize * _batch_size, localSize);
+}
+
+/**
+ * \brief AXPY on a batch of vectors, \f$y_b = ax_b + y_b\f$, in one launch.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stride_x Distance between two consecutive vectors x
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ * @param _stride_y Distance between two consecutive vectors y
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy_batched(
+    executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
+    increment_t _incx, index_t _stride_x, container_1_t _vy, increment_t _incy,
+    index_t _stride_y, index_t _batch_size) {
+  typename executor_t::policy_t::event_t ret;
+  if (_N == 0 || _batch_size == 0) {
+    return ret;
+  }
+  auto vx = make_vector_view(ex, _vx, index_t(1),
+                             get_batch_extent(_N, _incx, _stride_x,
+                                              _batch_size));
+  auto vy = make_vector_view(ex, _vy, index_t(1),
+                             get_batch_extent(_N, _incy, _stride_y,
+                                              _batch_size));
+  auto bx = make_vector_batch(vx, _N, index_t(_incx), _stride_x, _batch_size);
+  auto by = make_vector_batch(vy, _N, index_t(_incy), _stride_y, _batch_size);
+
+  auto scalOp =
+      make_op<ScalarOp, ProductOperator>(make_scalar_operand(ex, _alpha), bx);
+  auto addOp = make_op<BinaryOp, AddOperator>(by, scalOp);
+  auto assignOp = make_op<Assign>(by, addOp);
+  ret = ex.execute(assignOp);
+  return ret;
+}
+
+/**
+ * \brief Inner products of a batch of pairs of vectors, one result per pair,
+ * computed in one launch.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stride_x Distance between two consecutive vectors x
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ * @param _stride_y Distance between two consecutive vectors y
+ * @param _rs  BufferIterator receiving the _batch_size results
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stride_x, container_1_t _vy, increment_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size) {
+  typename executor_t::policy_t::event_t ret;
+  if (_N == 0 || _batch_size == 0) {
+    return ret;
+  }
+  auto vx = make_vector_view(ex, _vx, index_t(1),
+                             get_batch_extent(_N, _incx, _stride_x,
+                                              _batch_size));
+  auto vy = make_vector_view(ex, _vy, index_t(1),
+                             get_batch_extent(_N, _incy, _stride_y,
+                                              _batch_size));
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             _batch_size);
+  auto bx = make_vector_batch(vx, _N, index_t(_incx), _stride_x, _batch_size);
+  auto by = make_vector_batch(vy, _N, index_t(_incy), _stride_y, _batch_size);
+  auto prdOp = make_op<BinaryOp, ProductOperator>(bx, by);
+  ret = _batched_reduction<AddOperator>(ex, rs, prdOp, _N, _batch_size);
+  return ret;
+}
+
+/**
+ * \brief Euclidean norms of a batch of vectors, one result per vector,
+ * computed by a reduction launch followed by a square root launch.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stride_x Distance between two consecutive vectors x
+ * @param _rs  BufferIterator receiving the _batch_size results
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size) {
+  typename executor_t::policy_t::event_t ret;
+  if (_N == 0 || _batch_size == 0) {
+    return ret;
+  }
+  auto vx = make_vector_view(ex, _vx, index_t(1),
+                             get_batch_extent(_N, _incx, _stride_x,
+                                              _batch_size));
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             _batch_size);
+  auto bx = make_vector_batch(vx, _N, index_t(_incx), _stride_x, _batch_size);
+  auto prdOp = make_op<UnaryOp, SquareOperator>(bx);
+  auto ret0 = _batched_reduction<AddOperator>(ex, rs, prdOp, _N, _batch_size);
+  auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
+  auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
+  auto ret1 = ex.execute(assignOpFinal);
+  return blas::concatenate_vectors(ret0, ret1);
+}
+
+/**
+ * \brief IAMAX on a batch of vectors, computed in one launch. The index of
+ * each result is relative to its own vector.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stride_x Distance between two consecutive vectors x
+ * @param _rs  BufferIterator receiving the _batch_size index/value tuples
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _iamax_batched(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    index_t _stride_x, ContainerI _rs, index_t _batch_size) {
+  typename executor_t::policy_t::event_t ret;
+  if (_N == 0 || _batch_size == 0) {
+    return ret;
+  }
+  auto vx = make_vector_view(ex, _vx, index_t(1),
+                             get_batch_extent(_N, _incx, _stride_x,
+                                              _batch_size));
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             _batch_size);
+  auto bx = make_vector_batch(vx, _N, index_t(_incx), _stride_x, _batch_size);
+  auto tupOp = make_tuple_op(bx);
+  ret = _batched_reduction<IMaxOperator>(ex, rs, tupOp, _N, _batch_size);
+  return ret;
+}
+
 /**
  * \brief Compute the inner product of two vectors with extended
     precision accumulation and result.
@@ -321,7 +642,8 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
   auto res = std::vector<element_t>(1);
   auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
   blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  ex.get_policy_handler().wait(event);
   return res[0];
 }
 
@@ -339,7 +661,8 @@ index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
   auto gpu_res =
       make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
   blas::internal::_iamax(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
+  ex.get_policy_handler().wait(event);
   return rsT[0].get_index();
 }
 
@@ -357,7 +680,8 @@ index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
   auto gpu_res =
       make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
   blas::internal::_iamin(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
+  ex.get_policy_handler().wait(event);
   return rsT[0].get_index();
 }
 
@@ -377,7 +701,8 @@ typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
   auto res = std::vector<element_t>(1, element_t(0));
   auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
   blas::internal::_asum(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  ex.get_policy_handler().wait(event);
   return res[0];
 }
 
@@ -397,10 +722,134 @@ typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
   auto res = std::vector<element_t>(1, element_t(0));
   auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
   blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
+  ex.get_policy_handler().wait(event);
   return res[0];
 }
 
+/**
+ * \brief Compute the inner product of two vectors with extended
+    precision accumulation, copying the result to a slot of a ResultArray.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vx  BufferIterator
+ * @param _incy Increment in Y axis
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_0_t>::type> _dot(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, ResultArray &_results) {
+  using element_t = typename ValueType<container_0_t>::type;
+  auto policy_handler = ex.get_policy_handler();
+  auto gpu_res = policy_handler.template acquire_scratch<element_t>(1);
+  blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy,
+                       gpu_res.get_iterator());
+  auto res = _results.template allocate<element_t>();
+  auto event = policy_handler.copy_to_host(gpu_res.get_iterator(), res, 1);
+  policy_handler.release_scratch(gpu_res, event);
+  return ScalarFuture<executor_t, element_t>(policy_handler, res, event);
+}
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum, copying
+ * the result to a slot of a ResultArray.
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t,
+             IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+       ResultArray &_results) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  auto policy_handler = ex.get_policy_handler();
+  auto gpu_res = policy_handler.template acquire_scratch<IndValTuple>(1);
+  blas::internal::_iamax(ex, _N, _vx, _incx, gpu_res.get_iterator());
+  auto res = _results.template allocate<IndValTuple>();
+  auto event = policy_handler.copy_to_host(gpu_res.get_iterator(), res, 1);
+  policy_handler.release_scratch(gpu_res, event);
+  return ScalarFuture<executor_t, IndValTuple>(policy_handler, res, event);
+}
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum, copying
+ * the result to a slot of a ResultArray.
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t,
+             IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+       ResultArray &_results) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  auto policy_handler = ex.get_policy_handler();
+  auto gpu_res = policy_handler.template acquire_scratch<IndValTuple>(1);
+  blas::internal::_iamin(ex, _N, _vx, _incx, gpu_res.get_iterator());
+  auto res = _results.template allocate<IndValTuple>();
+  auto event = policy_handler.copy_to_host(gpu_res.get_iterator(), res, 1);
+  policy_handler.release_scratch(gpu_res, event);
+  return ScalarFuture<executor_t, IndValTuple>(policy_handler, res, event);
+}
+
+/**
+ * \brief ASUM Takes the sum of the absolute values, copying the result to a
+ * slot of a ResultArray.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_t>::type> _asum(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ResultArray &_results) {
+  using element_t = typename ValueType<container_t>::type;
+  auto policy_handler = ex.get_policy_handler();
+  auto gpu_res = policy_handler.template acquire_scratch<element_t>(1);
+  blas::internal::_asum(ex, _N, _vx, _incx, gpu_res.get_iterator());
+  auto res = _results.template allocate<element_t>();
+  auto event = policy_handler.copy_to_host(gpu_res.get_iterator(), res, 1);
+  policy_handler.release_scratch(gpu_res, event);
+  return ScalarFuture<executor_t, element_t>(policy_handler, res, event);
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector, copying the result to a
+ * slot of a ResultArray.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _results ResultArray receiving the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+ScalarFuture<executor_t, typename ValueType<container_t>::type> _nrm2(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    ResultArray &_results) {
+  using element_t = typename ValueType<container_t>::type;
+  auto policy_handler = ex.get_policy_handler();
+  auto gpu_res = policy_handler.template acquire_scratch<element_t>(1);
+  blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res.get_iterator());
+  auto res = _results.template allocate<element_t>();
+  auto event = policy_handler.copy_to_host(gpu_res.get_iterator(), res, 1);
+  policy_handler.release_scratch(gpu_res, event);
+  return ScalarFuture<executor_t, element_t>(policy_handler, res, event);
+}
+
 }  // namespace internal
 }  // namespace blas
 
@@ -48,5 +48,68 @@ typename Executor::policy_t::event_t _gemv(Executor& ex, index_t _M, index_t _N,
 }
 }  // namespace backend
 }  // namespace gemv
+namespace gemv_quantized {
+namespace backend {
+template <transpose_type trn, int bits, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename container_t2, typename increment_t, typename container_t3>
+typename Executor::policy_t::event_t _gemv_quantized(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _ldq, container_t1 _scale, container_t2 _vx, increment_t _incx,
+    element_t _beta, container_t3 _vy, increment_t _incy) {
+  if (trn == transpose_type::Normal) {
+    return blas::internal::_gemv_quantized_impl<256, 32, gemv_memory_t::local,
+                                                trn, bits>(
+        ex, _M, _N, _alpha, _mA, _ldq, _scale, _vx, _incx, _beta, _vy, _incy);
+  } else {
+    return blas::internal::_gemv_quantized_impl<128, 32, gemv_memory_t::local,
+                                                trn, bits>(
+        ex, _M, _N, _alpha, _mA, _ldq, _scale, _vx, _incx, _beta, _vy, _incy);
+  }
+}
+}  // namespace backend
+}  // namespace gemv_quantized
+namespace gemv_multi {
+namespace backend {
+/*!
+ * @brief Number of work items of a work group of _gemv_multi, each of them
+ * computes a row of op(A) unless A is transposed.
+ */
+template <transpose_type trn>
+constexpr uint32_t get_local_range() {
+  // The rows of op(A) are split between few work items on CPUs, each of them
+  // streams contiguous memory
+  return trn == transpose_type::Normal ? 64 : 16;
+}
+
+template <transpose_type trn, transpose_type trn_x, typename Executor,
+          typename index_t, typename element_t, typename container_t0,
+          typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi(
+    Executor& ex, index_t _M, index_t _N, index_t _num_vectors,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _mX,
+    index_t _ldx, element_t _beta, container_t2 _mY, index_t _ldy) {
+  return blas::internal::_gemv_multi_impl<get_local_range<trn>(), trn, trn_x>(
+      ex, _M, _N, _num_vectors, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+}
+}  // namespace backend
+}  // namespace gemv_multi
+namespace symv {
+namespace backend {
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _symv(Executor& ex, char _Uplo, index_t _N,
+                                           element_t _alpha, container_t0 _mA,
+                                           index_t _lda, container_t1 _vx,
+                                           increment_t _incx, element_t _beta,
+                                           container_t2 _vy,
+                                           increment_t _incy) {
+  // Local memory is regular memory on CPUs, larger tiles mean fewer groups
+  return blas::internal::_symv_impl<64>(ex, _Uplo, _N, _alpha, _mA, _lda, _vx,
+                                        _incx, _beta, _vy, _incy);
+}
+}  // namespace backend
+}  // namespace symv
 }  // namespace blas
 #endif
@@ -0,0 +1,54 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_quantized.cpp
+ *
+ **************************************************************************/
+
+
+#include "container/sycl_iterator.hpp"
+#include "executors/executor_sycl.hpp"
+#include "executors/kernel_constructor.hpp"
+#include "interface/blas2_interface.hpp"
+#include "operations/blas1_trees.hpp"
+#include "operations/blas2_trees.hpp"
+#include "operations/blas_constants.hpp"
+#include "policy/sycl_policy_handler.hpp"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+namespace internal {
+using executor_t = Executor<PolicyHandler<codeplay_policy>>;
+using int8_container_t = BufferIterator<int8_t, codeplay_policy>;
+using float_container_t = BufferIterator<float, codeplay_policy>;
+
+// Product of int8 or int4 weights with float vectors
+template typename executor_t::policy_t::event_t _gemv_quantized(
+    executor_t& ex, char _trans, int _M, int _N, float _alpha,
+    int8_container_t _mA, int _ldq, gemv_weight_t _weight_type,
+    float_container_t _scale, float_container_t _vx, int _incx, float _beta,
+    float_container_t _vy, int _incy);
+// Packing of a float matrix into int8 or int4 weights
+template typename executor_t::policy_t::event_t _gemv_quantize_weights(
+    executor_t& ex, int _M, int _N, float_container_t _mA, int _lda,
+    gemv_weight_t _weight_type, int8_container_t _mQ, int _ldq,
+    float_container_t _scale);
+}  // namespace internal
+}  // namespace blas
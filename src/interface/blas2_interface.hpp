@@ -42,88 +42,93 @@
 namespace blas {
 namespace internal {
 
-/*! _gemv_impl.
- * @brief Internal implementation of the General Matrix Vector product.
- *
- * This function contains the code that sets up and executes the kernels
- * required to perform the gemv operation.
- *
- * This function is called by blas::internal::backend::gemv which, dependant on
- * the platform being compiled for and other parameters, provides different
- * template parameters to ensure the most optimal kernel is constructed
- *
- * @tparam local_range  specifies the number of threads per work group used by
- *                      the kernel
- * @tparam cache_line_size  specifies the size in bytes of the cache line. This
- *                          value will determine the dimensions of tiles loaded
- *                          into local memory in the transposed local memory
- *                          version of the kernel
- * @tparam memory_type  specifies whether the kernel should use local shared
- *                      memory or not
- * @tparam trn  specifies whether the input matrix should be transposed
+/*! _gemv_single_pass.
+ * @brief Launches a GemvSinglePass, which computes y = alpha * op(A) * x +
+ * beta * y in one kernel.
  *
+ * @param partials  the partial dot products, only used when wgs_per_c > 1
+ * @param wgs_per_nc  the number of blocks of local_range rows of y
+ * @param wgs_per_c  the number of work groups sharing a block of rows
+ * @param c_blocks_per_wg  the number of blocks of local_range elements of x
+ *                         each work group goes through
+ * @param scratch_size  the local memory of a work group, when memory_type is
+ *                      gemv_memory_t::local
  */
 template <uint32_t local_range, uint32_t cache_line_size,
-          gemv_memory_t memory_type, transpose_type trn, typename Executor,
-          typename index_t, typename element_t, typename container_t0,
-          typename container_t1, typename increment_t, typename container_t2>
-typename Executor::policy_t::event_t _gemv_impl(
-    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
-    index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
-    container_t2 _vy, increment_t _incy) {
-  constexpr int cl_elems = cache_line_size / sizeof(element_t);
-  constexpr bool is_transposed = trn != transpose_type::Normal;
+          gemv_memory_t memory_type, bool is_transposed, typename Executor,
+          typename matrix_t, typename vector_x_t, typename vector_y_t,
+          typename partials_t, typename index_t, typename alpha_t,
+          typename beta_t>
+typename Executor::policy_t::event_t _gemv_single_pass(
+    Executor& ex, matrix_t mA, vector_x_t vx, vector_y_t vy,
+    partials_t partials, index_t wgs_per_nc, index_t wgs_per_c,
+    index_t c_blocks_per_wg, alpha_t alpha, beta_t beta, bool is_beta_zero,
+    index_t global_size, index_t scratch_size) {
+  auto policy_handler = ex.get_policy_handler();
+  // One counter per block of rows, only used when x is split. Otherwise the
+  // kernel never touches the counter, which needs not be zeroed
+  const index_t num_counters = (wgs_per_c > 1) ? wgs_per_nc : 1;
+  auto sync =
+      (wgs_per_c > 1)
+          ? policy_handler.template acquire_zeroed_scratch<int>(num_counters)
+          : policy_handler.template acquire_scratch<int>(num_counters);
+  auto sync_acc = get_range_accessor<cl::sycl::access::mode::atomic>(
+      sync.get_iterator(), num_counters);
+  const index_t sync_offset = sync.get_iterator().get_offset();
+
+  auto gemv = make_Gemv<local_range, is_transposed, cache_line_size, 1>(
+      partials, mA, vx, wgs_per_nc, wgs_per_c);
+  typename Executor::policy_t::event_t events;
+  if (is_beta_zero) {
+    auto gemv_sp = make_GemvSinglePass<true>(gemv, vy, alpha, beta, sync_acc,
+                                             sync_offset, c_blocks_per_wg);
+    events = (memory_type == gemv_memory_t::local)
+                 ? ex.execute(gemv_sp, static_cast<index_t>(local_range),
+                              global_size, scratch_size)
+                 : ex.execute(gemv_sp, static_cast<index_t>(local_range),
+                              global_size);
+  } else {
+    auto gemv_sp = make_GemvSinglePass<false>(gemv, vy, alpha, beta, sync_acc,
+                                              sync_offset, c_blocks_per_wg);
+    events = (memory_type == gemv_memory_t::local)
+                 ? ex.execute(gemv_sp, static_cast<index_t>(local_range),
+                              global_size, scratch_size)
+                 : ex.execute(gemv_sp, static_cast<index_t>(local_range),
+                              global_size);
+  }
+  policy_handler.release_scratch(sync, events);
+  return events;
+}
 
-  const auto x_vector_size = is_transposed ? _M : _N;
+/*! _gemv_launch.
+ * @brief Launches the kernels computing y = alpha * op(A) * x + beta * y for
+ * the matrix operand mA, a MatrixView or a QuantizedMatrix. See _gemv_impl
+ * for the template parameters.
+ */
+template <uint32_t local_range, uint32_t cache_line_size,
+          gemv_memory_t memory_type, bool is_transposed, typename Executor,
+          typename matrix_t, typename vector_x_t, typename vector_y_t,
+          typename index_t, typename alpha_t, typename beta_t>
+typename Executor::policy_t::event_t _gemv_launch(
+    Executor& ex, matrix_t mA, vector_x_t vx, vector_y_t vy, index_t _M,
+    index_t _N, alpha_t alpha, beta_t beta, bool is_beta_zero) {
+  // The dot products are computed in the type of x, which is also the type
+  // of the dequantized elements of a quantized matrix
+  using element_t =
+      typename std::remove_cv<typename vector_x_t::value_t>::type;
+  constexpr int cl_elems = cache_line_size / sizeof(element_t);
   const auto y_vector_size = is_transposed ? _N : _M;
 
-  auto mA = make_matrix_view<col_major>(ex, _mA, _M, _N, _lda);
-  auto vx = make_vector_view(ex, _vx, _incx, x_vector_size);
-  auto vy = make_vector_view(ex, _vy, _incy, y_vector_size);
-
   // Non-local memory kernel
   if (memory_type != gemv_memory_t::local) {
-    // Leading dimension for dot products matrix
-    const auto ld = is_transposed ? _N : _M;
+    // Each work item computes whole dot products and applies alpha and beta,
+    // so that y is computed in a single kernel without temporary
     constexpr index_t one = 1;
-
-    auto dot_products_buffer = blas::make_sycl_iterator_buffer<element_t>(ld);
-    auto dot_products_matrix =
-        make_matrix_view<col_major>(ex, dot_products_buffer, ld, one, ld);
-
-    const index_t global_size = roundUp<index_t>(ld, local_range);
-
-    auto gemv = make_Gemv<local_range, is_transposed, cache_line_size, 1>(
-        dot_products_matrix, mA, vx, one, one);
-
-    // Execute the GEMV kernel that calculate the partial dot products of rows
-    // auto gemvEvent = ex.execute(gemv, local_range, global_size);
-    auto gemvEvent =
-        ex.execute(gemv, static_cast<index_t>(local_range), global_size);
-
-    if (_beta != static_cast<element_t>(0)) {
-      // vec_y * b
-      auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
-
-      // alpha * vec_dot_products
-      auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, dot_products_matrix);
-
-      // add up
-      auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulDotsOp);
-
-      // assign the result back to vec_y
-      auto assignOp = make_op<Assign>(vy, addOp);
-
-      // exectutes the above expression tree to yield the final GEMV result
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
-    } else {
-      auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, dot_products_matrix);
-      auto assignOp = make_op<Assign>(vy, alphaMulDotsOp);
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
-    }
-
+    const index_t global_size = roundUp<index_t>(y_vector_size, local_range);
+    return _gemv_single_pass<local_range, cache_line_size, memory_type,
+                             is_transposed>(ex, mA, vx, vy, vy, one, one, one,
+                                            alpha, beta, is_beta_zero,
+                                            global_size, index_t(0));
   } else  // Local memory kernel
   {
     // Calculate number of work groups per each dimension based on the local
@@ -142,13 +147,55 @@ typename Executor::policy_t::event_t _gemv_impl(
 
     // Leading dimension for partial dot products matrix
     const auto ld = is_transposed ? _N : _M;
+    auto policy_handler = ex.get_policy_handler();
+
+    // x is only split across work groups when the blocks of rows alone do not
+    // give every compute unit a few work groups
+    constexpr index_t wgs_per_compute_unit = 4;
+    const index_t min_num_wgs =
+        wgs_per_compute_unit * policy_handler.get_num_compute_units();
+    const index_t split_factor = std::min(
+        WGs_per_C,
+        std::max(index_t(1), (min_num_wgs + WGs_per_NC - 1) / WGs_per_NC));
+    const index_t c_blocks_per_wg = (WGs_per_C - 1) / split_factor + 1;
+    const index_t split_WGs_per_C = (WGs_per_C - 1) / c_blocks_per_wg + 1;
+    const index_t split_global_size =
+        local_range * split_WGs_per_C * WGs_per_NC;
+
+    if (split_WGs_per_C == 1) {
+      // Each work group goes through the whole of x, no temporary is needed
+      return _gemv_single_pass<local_range, cache_line_size, memory_type,
+                               is_transposed>(
+          ex, mA, vx, vy, vy, WGs_per_NC, split_WGs_per_C, c_blocks_per_wg,
+          alpha, beta, is_beta_zero, split_global_size, kernel_scratch_size);
+    }
+    if (ReductionStrategy<AddOperator>::value ==
+        reduction_strategy_t::single_pass) {
+      // The last work group of each block of rows adds up the partial dot
+      // products of the others
+      auto partials_buffer = policy_handler.template acquire_scratch<element_t>(
+          ld * split_WGs_per_C);
+      auto partials = make_matrix_view<col_major>(
+          ex, partials_buffer.get_iterator(), ld, split_WGs_per_C, ld);
+      auto events = _gemv_single_pass<local_range, cache_line_size,
+                                      memory_type, is_transposed>(
+          ex, mA, vx, vy, partials, WGs_per_NC, split_WGs_per_C,
+          c_blocks_per_wg, alpha, beta, is_beta_zero, split_global_size,
+          kernel_scratch_size);
+      policy_handler.release_scratch(partials_buffer, events);
+      return events;
+    }
+
+    // Otherwise a second kernel adds up the partial dot products of each
+    // block of x
     const auto dot_products_buffer_size = ld * WGs_per_C;
 
     // Create the dot products buffer and matrix view
     auto dot_products_buffer =
-        blas::make_sycl_iterator_buffer<element_t>(dot_products_buffer_size);
-    auto dot_products_matrix =
-        make_matrix_view<col_major>(ex, dot_products_buffer, ld, WGs_per_C, ld);
+        policy_handler.template acquire_scratch<element_t>(
+            dot_products_buffer_size);
+    auto dot_products_matrix = make_matrix_view<col_major>(
+        ex, dot_products_buffer.get_iterator(), ld, WGs_per_C, ld);
 
     const index_t global_size = local_range * WGs_per_C * WGs_per_NC;
 
@@ -163,13 +210,13 @@ typename Executor::policy_t::event_t _gemv_impl(
     // Sum the partial dot products results from the GEMV kernel
     auto sumColsOp = make_sumMatrixColumns(dot_products_matrix);
 
-    if (_beta != static_cast<element_t>(0)) {
-      // vec_y * b
-      auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
+    if (!is_beta_zero) {
+      // vec_y * b, y is not used when a device beta is zero
+      auto betaMulYOp = make_op<ScalarOp, ScaleOutputOperator>(beta, vy);
 
       // alpha * vec_dot_products
       auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, sumColsOp);
+          make_op<ScalarOp, ProductOperator>(alpha, sumColsOp);
 
       // add up
       auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulDotsOp);
@@ -178,14 +225,305 @@ typename Executor::policy_t::event_t _gemv_impl(
       auto assignOp = make_op<Assign>(vy, addOp);
 
       // exectutes the above expression tree to yield the final GEMV result
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      auto events =
+          concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      policy_handler.release_scratch(dot_products_buffer, events);
+      return events;
     } else {
       auto alphaMulDotsOp =
-          make_op<ScalarOp, ProductOperator>(_alpha, sumColsOp);
+          make_op<ScalarOp, ProductOperator>(alpha, sumColsOp);
       auto assignOp = make_op<Assign>(vy, alphaMulDotsOp);
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      auto events =
+          concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      policy_handler.release_scratch(dot_products_buffer, events);
+      return events;
+    }
+  }
+}
+
+/*! _gemv_impl.
+ * @brief Internal implementation of the General Matrix Vector product.
+ *
+ * This function contains the code that sets up and executes the kernels
+ * required to perform the gemv operation.
+ *
+ * This function is called by blas::internal::backend::gemv which, dependant on
+ * the platform being compiled for and other parameters, provides different
+ * template parameters to ensure the most optimal kernel is constructed
+ *
+ * @tparam local_range  specifies the number of threads per work group used by
+ *                      the kernel
+ * @tparam cache_line_size  specifies the size in bytes of the cache line. This
+ *                          value will determine the dimensions of tiles loaded
+ *                          into local memory in the transposed local memory
+ *                          version of the kernel
+ * @tparam memory_type  specifies whether the kernel should use local shared
+ *                      memory or not
+ * @tparam trn  specifies whether the input matrix should be transposed
+ *
+ */
+template <uint32_t local_range, uint32_t cache_line_size,
+          gemv_memory_t memory_type, transpose_type trn, typename Executor,
+          typename index_t, typename scalar_t, typename container_t0,
+          typename container_t1, typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gemv_impl(
+    Executor& ex, index_t _M, index_t _N, scalar_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, scalar_t _beta,
+    container_t2 _vy, increment_t _incy) {
+  // alpha and beta are either host values or device scalars
+  auto alpha = make_scalar_operand(ex, _alpha);
+  auto beta = make_scalar_operand(ex, _beta);
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+
+  const auto x_vector_size = is_transposed ? _M : _N;
+  const auto y_vector_size = is_transposed ? _N : _M;
+
+  auto mA = make_matrix_view<col_major>(ex, _mA, _M, _N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, x_vector_size);
+  auto vy = make_vector_view(ex, _vy, _incy, y_vector_size);
+
+  return _gemv_launch<local_range, cache_line_size, memory_type,
+                      is_transposed>(ex, mA, vx, vy, _M, _N, alpha, beta,
+                                     is_scalar_zero(_beta));
+}
+
+/*! _gemv_quantized_impl.
+ * @brief Internal implementation of the General Matrix Vector product with
+ * a weight-only quantized matrix, which is dequantized as the GEMV kernels
+ * load it. See _gemv_impl for the other template parameters.
+ *
+ * @tparam bits  the number of bits of a weight, 8 or 4
+ * @param _mA  the packed int8_t weights, see QuantizedMatrix for the layout
+ * @param _ldq  the leading dimension of the weights, at least _M and even
+ *              with 4 bits
+ * @param _scale  the _M scales of the rows of A
+ */
+template <uint32_t local_range, uint32_t cache_line_size,
+          gemv_memory_t memory_type, transpose_type trn, int bits,
+          typename Executor, typename index_t, typename scalar_t,
+          typename container_t0, typename container_t1,
+          typename container_t2, typename increment_t, typename container_t3>
+typename Executor::policy_t::event_t _gemv_quantized_impl(
+    Executor& ex, index_t _M, index_t _N, scalar_t _alpha, container_t0 _mA,
+    index_t _ldq, container_t1 _scale, container_t2 _vx, increment_t _incx,
+    scalar_t _beta, container_t3 _vy, increment_t _incy) {
+  auto alpha = make_scalar_operand(ex, _alpha);
+  auto beta = make_scalar_operand(ex, _beta);
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  constexpr index_t rows_per_byte = 8 / bits;
+
+  const auto x_vector_size = is_transposed ? _M : _N;
+  const auto y_vector_size = is_transposed ? _N : _M;
+
+  auto weights = make_vector_view(ex, _mA, index_t(1),
+                                  (_ldq / rows_per_byte) * _N);
+  auto scales = make_vector_view(ex, _scale, index_t(1), _M);
+  auto mA = make_quantized_matrix<bits>(weights, scales, _M, _N, _ldq);
+  auto vx = make_vector_view(ex, _vx, _incx, x_vector_size);
+  auto vy = make_vector_view(ex, _vy, _incy, y_vector_size);
+  return _gemv_launch<local_range, cache_line_size, memory_type,
+                      is_transposed>(ex, mA, vx, vy, _M, _N, alpha, beta,
+                                     is_scalar_zero(_beta));
+}
+
+/*! _gemv_quantize_weights_impl.
+ * @brief Packs the float matrix A into the weights and scales of a
+ * quantized GEMV, see GemvQuantizeWeights.
+ *
+ * @tparam bits  the number of bits of a weight, 8 or 4
+ */
+template <int bits, typename Executor, typename index_t,
+          typename container_t0, typename container_t1,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_quantize_weights_impl(
+    Executor& ex, index_t _M, index_t _N, container_t0 _mA, index_t _lda,
+    container_t1 _mQ, index_t _ldq, container_t2 _scale) {
+  constexpr index_t rows_per_byte = 8 / bits;
+  constexpr index_t local_range = 128;
+  auto mA = make_matrix_view<col_major>(ex, _mA, _M, _N, _lda);
+  auto weights = make_vector_view(ex, _mQ, index_t(1),
+                                  (_ldq / rows_per_byte) * _N);
+  auto scales = make_vector_view(ex, _scale, index_t(1), _M);
+  auto quantize = make_gemv_quantize_weights<bits>(mA, weights, scales, _ldq);
+  return ex.execute(quantize, local_range);
+}
+
+/*! _gemv_multi_launch.
+ * @brief Launches a GemvMulti keeping max_vectors dot products per work item.
+ */
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          typename Executor, typename matrix_t, typename rhs_t, typename lhs_t,
+          typename alpha_t, typename beta_t, typename index_t>
+typename Executor::policy_t::event_t _gemv_multi_launch(
+    Executor& ex, matrix_t mA, rhs_t mX, lhs_t mY, alpha_t alpha, beta_t beta,
+    bool is_beta_zero, index_t nc_dim) {
+  if (is_beta_zero) {
+    auto gemv = make_GemvMulti<local_range, max_vectors, is_transposed, true>(
+        mY, mA, mX, alpha, beta);
+    const index_t global_size =
+        local_range * decltype(gemv)::get_num_work_groups(nc_dim);
+    return ex.execute(gemv, static_cast<index_t>(local_range), global_size,
+                      decltype(gemv)::get_local_memory_size());
+  } else {
+    auto gemv = make_GemvMulti<local_range, max_vectors, is_transposed, false>(
+        mY, mA, mX, alpha, beta);
+    const index_t global_size =
+        local_range * decltype(gemv)::get_num_work_groups(nc_dim);
+    return ex.execute(gemv, static_cast<index_t>(local_range), global_size,
+                      decltype(gemv)::get_local_memory_size());
+  }
+}
+
+/*! _gemv_multi_impl.
+ * @brief Internal implementation of the product of a matrix with a few
+ * vectors, Y = alpha * op(A) * X + beta * Y.
+ *
+ * A is read once for up to 16 vectors, the number of dot products kept in
+ * registers is the smallest of 4, 8 or 16 which holds all the vectors.
+ *
+ * @tparam local_range  the number of work items of a work group, a power of 2
+ * @tparam trn  whether op(A) is the transpose of A
+ * @tparam trn_x  whether the vectors are the rows of the array X rather than
+ *                its columns, as for the B operand of a GEMM with transb = 't'
+ */
+template <uint32_t local_range, transpose_type trn, transpose_type trn_x,
+          typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_impl(
+    Executor& ex, index_t _M, index_t _N, index_t _num_vectors,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _mX,
+    index_t _ldx, element_t _beta, container_t2 _mY, index_t _ldy) {
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  constexpr bool is_x_transposed = trn_x != transpose_type::Normal;
+  using x_layout_t =
+      typename std::conditional<is_x_transposed, row_major, col_major>::type;
+  constexpr index_t max_vectors = 16;
+
+  typename Executor::policy_t::event_t events;
+  const index_t nc_dim = is_transposed ? _N : _M;
+  const index_t c_dim = is_transposed ? _M : _N;
+  if (nc_dim == 0 || _num_vectors == 0) {
+    return events;
+  }
+  auto alpha = make_scalar_operand(ex, _alpha);
+  auto beta = make_scalar_operand(ex, _beta);
+  const bool is_beta_zero = is_scalar_zero(_beta);
+  auto mA = make_matrix_view<col_major>(ex, _mA, _M, _N, _lda);
+
+  // More than 16 vectors are processed 16 at a time
+  for (index_t first = 0; first < _num_vectors; first += max_vectors) {
+    const index_t k = std::min(max_vectors, _num_vectors - first);
+    auto mX = make_matrix_view<x_layout_t>(
+        ex, _mX + (is_x_transposed ? first : first * _ldx), c_dim, k, _ldx);
+    auto mY = make_matrix_view<col_major>(ex, _mY + first * _ldy, nc_dim, k,
+                                          _ldy);
+    if (k <= 4) {
+      append_vector(events, _gemv_multi_launch<local_range, 4, is_transposed>(
+                                ex, mA, mX, mY, alpha, beta, is_beta_zero,
+                                nc_dim));
+    } else if (k <= 8) {
+      append_vector(events, _gemv_multi_launch<local_range, 8, is_transposed>(
+                                ex, mA, mX, mY, alpha, beta, is_beta_zero,
+                                nc_dim));
+    } else {
+      append_vector(events,
+                    _gemv_multi_launch<local_range, 16, is_transposed>(
+                        ex, mA, mX, mY, alpha, beta, is_beta_zero, nc_dim));
     }
   }
+  return events;
+}
+
+/*! _gemv_batched_launch.
+ * @brief Launches a GemvBatched for the given batch layout.
+ */
+template <bool is_transposed, int batch_type, typename Executor,
+          typename matrix_t, typename vector_x_t, typename vector_y_t,
+          typename alpha_t, typename beta_t, typename index_t>
+typename Executor::policy_t::event_t _gemv_batched_launch(
+    Executor& ex, index_t _M, index_t _N, alpha_t alpha, matrix_t mA,
+    index_t _lda, index_t _stride_a, vector_x_t vx, index_t _incx,
+    index_t _stride_x, beta_t beta, bool is_beta_zero, vector_y_t vy,
+    index_t _incy, index_t _stride_y, index_t _batch_size) {
+  const index_t local_range = ex.get_policy_handler().get_work_group_size();
+  const index_t y_vector_size = is_transposed ? _N : _M;
+  const index_t global_size =
+      roundUp<index_t>(y_vector_size * _batch_size, local_range);
+  if (is_beta_zero) {
+    auto gemv = make_GemvBatched<is_transposed, true, batch_type>(
+        vy, mA, vx, alpha, beta, _M, _N, _lda, _stride_a, _incx, _stride_x,
+        _incy, _stride_y, _batch_size);
+    return ex.execute(gemv, local_range, global_size);
+  } else {
+    auto gemv = make_GemvBatched<is_transposed, false, batch_type>(
+        vy, mA, vx, alpha, beta, _M, _N, _lda, _stride_a, _incx, _stride_x,
+        _incy, _stride_y, _batch_size);
+    return ex.execute(gemv, local_range, global_size);
+  }
+}
+
+/*! _gemv_batched_impl.
+ * @brief Internal implementation of the batched General Matrix Vector
+ * product, computing y_b = alpha * op(A_b) * x_b + beta * y_b for every b of
+ * the batch in a single kernel launch.
+ *
+ * @tparam trn  whether the matrices are transposed
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gemv_batched_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, index_t _stride_a, container_t1 _vx, increment_t _incx,
+    index_t _stride_x, element_t _beta, container_t2 _vy, increment_t _incy,
+    index_t _stride_y, index_t _batch_size, gemm_batch_type_t _batch_type) {
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  typename Executor::policy_t::event_t events;
+  if (_M == 0 || _N == 0 || _batch_size == 0) {
+    return events;
+  }
+  if (_incx == 0 || _incy == 0) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  const index_t x_vector_size = is_transposed ? _M : _N;
+  const index_t y_vector_size = is_transposed ? _N : _M;
+  const index_t incx = static_cast<index_t>(std::abs(_incx));
+  const index_t incy = static_cast<index_t>(std::abs(_incy));
+
+  // The kernel indexes the whole buffers, the views span every operand of
+  // the batch
+  const bool is_interleaved = _batch_type == gemm_batch_type_t::interleaved;
+  const index_t a_size = _lda * (_N - 1) + _M;
+  const index_t x_size = incx * (x_vector_size - 1) + 1;
+  const index_t y_size = incy * (y_vector_size - 1) + 1;
+  auto mA = make_vector_view(
+      ex, _mA, index_t(1),
+      is_interleaved ? a_size * _batch_size
+                     : _stride_a * (_batch_size - 1) + a_size);
+  auto vx = make_vector_view(
+      ex, _vx, index_t(1),
+      is_interleaved ? x_size * _batch_size
+                     : _stride_x * (_batch_size - 1) + x_size);
+  auto vy = make_vector_view(
+      ex, _vy, index_t(1),
+      is_interleaved ? y_size * _batch_size
+                     : _stride_y * (_batch_size - 1) + y_size);
+  auto alpha = make_scalar_operand(ex, _alpha);
+  auto beta = make_scalar_operand(ex, _beta);
+  const bool is_beta_zero = is_scalar_zero(_beta);
+
+  if (is_interleaved) {
+    return _gemv_batched_launch<is_transposed,
+                                static_cast<int>(
+                                    gemm_batch_type_t::interleaved)>(
+        ex, _M, _N, alpha, mA, _lda, _stride_a, vx, index_t(_incx), _stride_x,
+        beta, is_beta_zero, vy, index_t(_incy), _stride_y, _batch_size);
+  } else {
+    return _gemv_batched_launch<is_transposed,
+                                static_cast<int>(gemm_batch_type_t::strided)>(
+        ex, _M, _N, alpha, mA, _lda, _stride_a, vx, index_t(_incx), _stride_x,
+        beta, is_beta_zero, vy, index_t(_incy), _stride_y, _batch_size);
+  }
 }
 
 /*! _TRMV.
@@ -229,18 +567,25 @@ typename Executor::policy_t::event_t _trmv_impl(
   const index_t scratchPadSize =
       (_localSize == 0) ? localSize : _scratchPadSize;
 
-  const index_t nWGPerCol = (N - 1) / nColsWG + 1;
   const index_t nWGPerRow = (N - 1) / nRowsWG + 1;
+  // GemvCol only runs the blocks of the triangle, on a square grid
+  const index_t nWGPerCol =
+      (data_layout_t::is_col_major()) ? nWGPerRow : (N - 1) / nColsWG + 1;
   const index_t scratchSize =
       (data_layout_t::is_col_major())
           ? nWGPerCol
           : (((scratchPadSize == 0) ? std::min(N, localSize) : 1) * nWGPerCol);
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
+  const index_t globalSize =
+      (data_layout_t::is_col_major())
+          ? localSize * TriangularBlocks::get_num_blocks(nWGPerRow)
+          : localSize * nWGPerRow * nWGPerCol;
 
   using element_t = typename ValueType<container_t0>::type;
-  auto valT1 = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize);
-  auto mat1 =
-      make_matrix_view<row_major>(ex, valT1, N, scratchSize, scratchSize);
+  auto policy_handler = ex.get_policy_handler();
+  auto valT1 =
+      policy_handler.template acquire_scratch<element_t>(N * scratchSize);
+  auto mat1 = make_matrix_view<row_major>(ex, valT1.get_iterator(), N,
+                                          scratchSize, scratchSize);
 
   if (data_layout_t::is_col_major()) {
     if (triangOpr == 1) {
@@ -298,11 +643,85 @@ typename Executor::policy_t::event_t _trmv_impl(
   auto addMOp = make_sumMatrixColumns(mat1);
   auto assignOp = make_op<Assign>(vx, addMOp);
   ret = concatenate_vectors(ret, ex.execute(assignOp, localSize));
+  policy_handler.release_scratch(valT1, ret);
+  return ret;
+}
+
+/*! _SYMV.
+ * @brief Implementation of the Symmetric Matrix Vector product reading the
+ * stored triangle once.
+ *
+ * The first kernel (see Symv) applies every stored tile both as A_ij and
+ * A_ji and writes one partial sum per block of columns for each row. The
+ * second one sums the partial sums and scales them into y.
+ *
+ * @tparam tile_size  the dimension of the tiles of the matrix, also the work
+ *                    group size of the first kernel
+ */
+template <int tile_size, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _symv_impl(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
+    container_t2 _vy, increment_t _incy) {
+  _Uplo = tolower(_Uplo);
+  if ((_Uplo != 'u') && (_Uplo != 'l')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  typename Executor::policy_t::event_t ret;
+  if (_N == 0) {
+    return ret;
+  }
+  const index_t N = _N;
+  auto mA = make_matrix_view<col_major>(ex, _mA, N, N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, N);
+  auto vy = make_vector_view(ex, _vy, _incy, N);
+
+  const index_t num_blocks = (N - 1) / tile_size + 1;
+  auto policy_handler = ex.get_policy_handler();
+  auto partials_buffer =
+      policy_handler.template acquire_scratch<element_t>(N * num_blocks);
+  auto partials = make_matrix_view<col_major>(
+      ex, partials_buffer.get_iterator(), N, num_blocks, N);
+
+  const index_t local_size = tile_size;
+  if (_Uplo == 'u') {
+    auto symv = make_Symv<tile_size, true>(partials, mA, vx);
+    using symv_t = decltype(symv);
+    ret = concatenate_vectors(
+        ret, ex.execute(symv, local_size,
+                        symv_t::get_num_work_groups(N) * local_size,
+                        symv_t::get_local_memory_size()));
+  } else {
+    auto symv = make_Symv<tile_size, false>(partials, mA, vx);
+    using symv_t = decltype(symv);
+    ret = concatenate_vectors(
+        ret, ex.execute(symv, local_size,
+                        symv_t::get_num_work_groups(N) * local_size,
+                        symv_t::get_local_memory_size()));
+  }
+
+  auto sumColsOp = make_sumMatrixColumns(partials);
+  auto alphaMulSumOp = make_op<ScalarOp, ProductOperator>(_alpha, sumColsOp);
+  const index_t assign_local_size = policy_handler.get_work_group_size();
+  if (!is_scalar_zero(_beta)) {
+    auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
+    auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulSumOp);
+    auto assignOp = make_op<Assign>(vy, addOp);
+    ret = concatenate_vectors(ret, ex.execute(assignOp, assign_local_size));
+  } else {
+    auto assignOp = make_op<Assign>(vy, alphaMulSumOp);
+    ret = concatenate_vectors(ret, ex.execute(assignOp, assign_local_size));
+  }
+  policy_handler.release_scratch(partials_buffer, ret);
   return ret;
 }
 
 /*! _SYMV.
- * @brief Implementation of the Symmetric Matrix Vector product.
+ * @brief Implementation of the Symmetric Matrix Vector product with a
+ * column-wise and a row-wise GEMV over the stored triangle, which reads the
+ * matrix twice. Kept as a reference for the blocked kernel of _symv_impl.
  */
 /*
 ssymv 	( 	character  	UPLO,
@@ -319,7 +738,7 @@ ssymv 	( 	character  	UPLO,
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename container_t1, typename increment_t,
           typename container_t2>
-typename Executor::policy_t::event_t _symv_impl(
+typename Executor::policy_t::event_t _symv_two_pass_impl(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy, index_t _localSize = 0,
@@ -352,24 +771,28 @@ typename Executor::policy_t::event_t _symv_impl(
   const index_t globalSize_R = localSize * nWGPerRow_R * nWGPerCol_R;
 
   const index_t nRowsWG_C = (_nRowsWG == 0) ? localSize : _nRowsWG;
-  const index_t nColsWG_C = (_nColsWG == 0) ? localSize : _nColsWG;
 
+  // Only the blocks of the triangle are launched, on a square grid
   const index_t nWGPerRow_C = (N - 1) / nRowsWG_C + 1;
-  const index_t nWGPerCol_C = (N - 1) / nColsWG_C + 1;
-  const index_t globalSize_C = localSize * nWGPerRow_C * nWGPerCol_C;
+  const index_t nWGPerCol_C = nWGPerRow_C;
+  const index_t globalSize_C =
+      localSize * TriangularBlocks::get_num_blocks(nWGPerRow_C);
 
   const index_t scratchSize_R =
       ((scratchPadSize == 0) ? std::min(N, localSize) : 1) * nWGPerCol_R;
 
-  auto valTR = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_R);
-  auto matR =
-      make_matrix_view<row_major>(ex, valTR, N, scratchSize_R, scratchSize_R);
+  auto policy_handler = ex.get_policy_handler();
+  auto valTR =
+      policy_handler.template acquire_scratch<element_t>(N * scratchSize_R);
+  auto matR = make_matrix_view<row_major>(ex, valTR.get_iterator(), N,
+                                          scratchSize_R, scratchSize_R);
 
   const index_t scratchSize_C = nWGPerCol_C;
 
-  auto valTC = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_C);
-  auto matC =
-      make_matrix_view<row_major>(ex, valTC, N, scratchSize_C, scratchSize_C);
+  auto valTC =
+      policy_handler.template acquire_scratch<element_t>(N * scratchSize_C);
+  auto matC = make_matrix_view<row_major>(ex, valTC.get_iterator(), N,
+                                          scratchSize_C, scratchSize_C);
 
   if (triangOpr == 1) {
     auto gemvC = make_Gemv_Col<false, true, true>(matC, mA, vx, nWGPerRow_C,
@@ -399,6 +822,8 @@ typename Executor::policy_t::event_t _symv_impl(
   auto addOp = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
   auto assignOp = make_op<Assign>(vy, addOp);
   ret = concatenate_vectors(ret, ex.execute(assignOp, localSize));
+  policy_handler.release_scratch(valTR, ret);
+  policy_handler.release_scratch(valTC, ret);
   return ret;
 }
 
@@ -468,13 +893,14 @@ typename Executor::policy_t::event_t _syr_impl(
                                 ? ex.get_policy_handler().get_work_group_size()
                                 : _localSize;
   const index_t nRowsWG = (_nRowsWG == 0) ? localSize : std::min(N, _nRowsWG);
-  const index_t nColsWG = (_nColsWG == 0) ? localSize : std::min(N, _nColsWG);
   const index_t scratchPadSize =
       (_localSize == 0) ? localSize : _scratchPadSize;
 
+  // Only the square blocks touching the updated triangle are launched
   const index_t nWGPerRow = (N - 1) / nRowsWG + 1;
-  const index_t nWGPerCol = (N - 1) / nColsWG + 1;
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
+  const index_t nWGPerCol = nWGPerRow;
+  const index_t globalSize =
+      localSize * TriangularBlocks::get_num_blocks(nWGPerRow);
 
   if (triangOpr) {
     auto assignOp = make_Ger_Col<true, false, true, true>(
@@ -523,13 +949,14 @@ typename Executor::policy_t::event_t _syr2_impl(
                                 ? ex.get_policy_handler().get_work_group_size()
                                 : _localSize;
   const index_t nRowsWG = (_nRowsWG == 0) ? localSize : std::min(N, _nRowsWG);
-  const index_t nColsWG = (_nColsWG == 0) ? localSize : std::min(N, _nColsWG);
   const index_t scratchPadSize =
       (_localSize == 0) ? 2 * localSize : _scratchPadSize;
 
+  // The blocks are square and enumerated on the triangle (see SYR)
   const index_t nWGPerRow = (N - 1) / nRowsWG + 1;
-  const index_t nWGPerCol = (N - 1) / nColsWG + 1;
-  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
+  const index_t nWGPerCol = nWGPerRow;
+  const index_t globalSize =
+      localSize * TriangularBlocks::get_num_blocks(nWGPerRow);
 
   if (triangOpr) {
     auto assignOp = make_Ger_Col<false, false, true, true>(
@@ -585,6 +1012,124 @@ typename Executor::policy_t::event_t inline _gemv(
                    _incy);
 }
 
+/*!
+ @brief Batched generalised matrix vector product, computing
+ y_b = alpha*op(A_b)*x_b + beta*y_b for every b < batch_size in one launch.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _gemv_batched(
+    Executor& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, index_t _stride_a, container_t1 _vx,
+    increment_t _incx, index_t _stride_x, element_t _beta, container_t2 _vy,
+    increment_t _incy, index_t _stride_y, index_t _batch_size,
+    gemm_batch_type_t _batch_type) {
+  return tolower(_trans) == 'n'
+             ? _gemv_batched_impl<transpose_type::Normal>(
+                   ex, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx,
+                   _stride_x, _beta, _vy, _incy, _stride_y, _batch_size,
+                   _batch_type)
+             : _gemv_batched_impl<transpose_type::Transposed>(
+                   ex, _M, _N, _alpha, _mA, _lda, _stride_a, _vx, _incx,
+                   _stride_x, _beta, _vy, _incy, _stride_y, _batch_size,
+                   _batch_type);
+}
+
+/*!
+ @brief Generalised matrix vector product of a rectangular non-symmetric matrix
+ with several vectors, reading the matrix once.
+
+ Computes, for each of the num_vectors columns x_j and y_j of X and Y:
+
+ y_j = alpha*op(A)*x_j + beta*y_j
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t inline _gemv_multi(
+    Executor& ex, char _trans, index_t _M, index_t _N, index_t _num_vectors,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _mX,
+    index_t _ldx, element_t _beta, container_t2 _mY, index_t _ldy) {
+  return tolower(_trans) == 'n'
+             ? blas::gemv_multi::backend::_gemv_multi<transpose_type::Normal,
+                                                      transpose_type::Normal>(
+                   ex, _M, _N, _num_vectors, _alpha, _mA, _lda, _mX, _ldx,
+                   _beta, _mY, _ldy)
+             : blas::gemv_multi::backend::_gemv_multi<
+                   transpose_type::Transposed, transpose_type::Normal>(
+                   ex, _M, _N, _num_vectors, _alpha, _mA, _lda, _mX, _ldx,
+                   _beta, _mY, _ldy);
+}
+
+/*!
+ @brief Generalised matrix vector product with a weight-only quantized matrix,
+ y = alpha*op(A)*x + beta*y, where A(i, j) = scale[i] * q(i, j) is
+ dequantized as the GEMV kernels load it.
+
+ The weights q are int8_t values, or int4 values packed two per byte, in the
+ layout written by _gemv_quantize_weights.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1,
+          typename container_t2, typename increment_t, typename container_t3>
+typename Executor::policy_t::event_t inline _gemv_quantized(
+    Executor& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _ldq, gemv_weight_t _weight_type,
+    container_t1 _scale, container_t2 _vx, increment_t _incx,
+    element_t _beta, container_t3 _vy, increment_t _incy) {
+  // Two rows share a byte with int4 weights, so the columns must start on a
+  // byte
+  if (_ldq < _M || (_weight_type == gemv_weight_t::int4 && _ldq % 2 != 0)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_weight_type == gemv_weight_t::int8) {
+    return tolower(_trans) == 'n'
+               ? blas::gemv_quantized::backend::_gemv_quantized<
+                     transpose_type::Normal, 8>(ex, _M, _N, _alpha, _mA, _ldq,
+                                                _scale, _vx, _incx, _beta,
+                                                _vy, _incy)
+               : blas::gemv_quantized::backend::_gemv_quantized<
+                     transpose_type::Transposed, 8>(
+                     ex, _M, _N, _alpha, _mA, _ldq, _scale, _vx, _incx,
+                     _beta, _vy, _incy);
+  } else {
+    return tolower(_trans) == 'n'
+               ? blas::gemv_quantized::backend::_gemv_quantized<
+                     transpose_type::Normal, 4>(ex, _M, _N, _alpha, _mA, _ldq,
+                                                _scale, _vx, _incx, _beta,
+                                                _vy, _incy)
+               : blas::gemv_quantized::backend::_gemv_quantized<
+                     transpose_type::Transposed, 4>(
+                     ex, _M, _N, _alpha, _mA, _ldq, _scale, _vx, _incx,
+                     _beta, _vy, _incy);
+  }
+}
+
+/*!
+ @brief Quantizes the float matrix A once, before it is used by
+ _gemv_quantized: each row gets a scale, its largest magnitude divided by 127
+ for int8 weights or 7 for int4 weights, and its elements are divided by the
+ scale and rounded to the nearest weight.
+ */
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t inline _gemv_quantize_weights(
+    Executor& ex, index_t _M, index_t _N, container_t0 _mA, index_t _lda,
+    gemv_weight_t _weight_type, container_t1 _mQ, index_t _ldq,
+    container_t2 _scale) {
+  if (_ldq < _M || (_weight_type == gemv_weight_t::int4 && _ldq % 2 != 0)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_M == 0 || _N == 0) {
+    return typename Executor::policy_t::event_t{};
+  }
+  return _weight_type == gemv_weight_t::int8
+             ? _gemv_quantize_weights_impl<8>(ex, _M, _N, _mA, _lda, _mQ,
+                                              _ldq, _scale)
+             : _gemv_quantize_weights_impl<4>(ex, _M, _N, _mA, _lda, _mQ,
+                                              _ldq, _scale);
+}
+
 template <typename Executor, typename index_t, typename container_t0,
           typename container_t1, typename increment_t>
 typename Executor::policy_t::event_t inline _trmv(
@@ -605,10 +1150,8 @@ typename Executor::policy_t::event_t inline _symv(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
-  return _symv_impl(ex, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
-                    _incy);
+  return blas::symv::backend::_symv(ex, _Uplo, _N, _alpha, _mA, _lda, _vx,
+                                    _incx, _beta, _vy, _incy);
 }
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename increment_t, typename container_t1,
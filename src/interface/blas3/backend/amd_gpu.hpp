@@ -24,19 +24,92 @@
  **************************************************************************/
 #ifndef SYCL_BLAS_GEMM_AMD_GPU_BACKEND_HPP
 #define SYCL_BLAS_GEMM_AMD_GPU_BACKEND_HPP
+#include "interface/gemm_dispatch.hpp"
 #include "interface/gemm_launcher.h"
 
 namespace blas {
 namespace gemm {
 
 namespace backend {
+/*!
+ * @brief Tile of the AMD configurations, whose work group rows and columns
+ * fill a cache line of elements.
+ */
+template <typename element_t, int ItemRows, int ItemCols>
+using amd_tile_t = Tile<ItemRows, ItemCols, 64 / sizeof(element_t),
+                        64 / sizeof(element_t)>;
+
+// Strided configurations compiled for AMD_GPU
+template <typename element_t>
+using dispatch_configs_t = DispatchConfigList<
+#ifdef GEMM_TALL_SKINNY_SUPPORT
+    DispatchConfig<256, true, true, true, 64,
+                   amd_tile_t<element_t, 1, 1>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 2>,
+    DispatchConfig<256, true, true, true, 64,
+                   amd_tile_t<element_t, 2, 2>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 2>,
+    DispatchConfig<256, true, true, true, 64,
+                   amd_tile_t<element_t, 4, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 2>,
+    DispatchConfig<256, true, true, true, 64,
+                   amd_tile_t<element_t, 1, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 2>,
+    DispatchConfig<256, true, true, true, 64,
+                   amd_tile_t<element_t, 4, 1>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 2>,
+#endif
+    DispatchConfig<256, false, false, false, 64,
+                   amd_tile_t<element_t, 1, 1>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 1>,
+    DispatchConfig<256, false, false, false, 64,
+                   amd_tile_t<element_t, 4, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 2>>;
+
+// Configuration compiled for AMD_GPU for the GEMMs fusing an epilogue or a
+// prologue, see _gemm_ex. Only the naive and the full vectorization
+// kernels take them
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using ex_launcher_t = Gemm_Launcher<
+    256, false, false, false, 64, Tile<4, 4, 16, 16>, _t_a, _t_b,
+    static_cast<int>(gemm_memory_t::local),
+    static_cast<int>(gemm_algorithm_t::standard),
+    static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 2,
+    static_cast<int>(gemm_batch_type_t::strided)>;
+
+// The GEMMs reading half operands and accumulating in float use the same
+// configuration on AMD_GPU, see _gemm_mixed
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using mixed_launcher_t = ex_launcher_t<_t_a, _t_b, is_beta_zero>;
+
+// Tile of the GEMMs of small matrices on AMD_GPU, whose blocks of C tell
+// whether a GEMM fills the device or is split along K, see _gemm_split_k
+template <typename element_t>
+using small_tile_t =
+    Tile<1, 1, 64 / sizeof(element_t), 64 / sizeof(element_t)>;
+
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm(
     executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
-    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+    container_0_t _a, index_t _lda, index_t _stridea, container_1_t _b,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _c,
+    index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type) {
   static constexpr int ClSize = 64;
   static constexpr int tileWgSize = ClSize / sizeof(element_t);
@@ -50,9 +123,12 @@ typename executor_t::policy_t::event_t _gemm(
             gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
                                                                     _K, _alpha,
                                                                     _a, _lda,
+                                                                    _stridea,
                                                                     _b, _ldb,
+                                                                    _strideb,
                                                                     _beta, _c,
                                                                     _ldc,
+                                                                    _stridec,
                                                                     batch_size);
   }
 /* Tall & Skinny matrices. */
@@ -68,9 +144,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M > 64 && _N <= 32) {
       return blas::Gemm_Launcher<
@@ -81,9 +161,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M <= 16 || _N <= 16) {
       return blas::Gemm_Launcher<
@@ -94,9 +178,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M <= 32 || _N <= 32) {
       return blas::Gemm_Launcher<
@@ -107,9 +195,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else {
       return blas::Gemm_Launcher<
@@ -120,9 +212,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     }
   } else
@@ -136,8 +232,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   } else {
     return blas::Gemm_Launcher<
@@ -148,8 +247,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }
 }
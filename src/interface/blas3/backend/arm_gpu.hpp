@@ -24,18 +24,57 @@
  **************************************************************************/
 #ifndef SYCL_BLAS_GEMM_ARM_GPU_BACKEND_HPP
 #define SYCL_BLAS_GEMM_ARM_GPU_BACKEND_HPP
+#include "interface/gemm_dispatch.hpp"
 #include "interface/gemm_launcher.h"
 
 namespace blas {
 namespace gemm {
 namespace backend {
+// Strided configurations compiled for ARM_GPU
+template <typename element_t>
+using dispatch_configs_t = DispatchConfigList<
+    DispatchConfig<64, false, false, false, 64, Tile<4, 4, 8, 8>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::partial), 2>,
+    DispatchConfig<128, false, false, false, 64, Tile<4, 8, 16, 8>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::partial), 4>,
+    DispatchConfig<64, false, false, false, 64, Tile<4, 4, 4, 4>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::partial), 2>>;
+
+// Configuration compiled for ARM_GPU for the GEMMs fusing an epilogue or a
+// prologue, see _gemm_ex. Only the naive and the full vectorization
+// kernels take them
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using ex_launcher_t = Gemm_Launcher<
+    64, false, false, false, 64, Tile<4, 4, 8, 8>, _t_a, _t_b,
+    static_cast<int>(gemm_memory_t::no_local),
+    static_cast<int>(gemm_algorithm_t::standard),
+    static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+    static_cast<int>(gemm_batch_type_t::strided)>;
+
+// The GEMMs reading half operands and accumulating in float use the same
+// configuration on ARM_GPU, see _gemm_mixed
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using mixed_launcher_t = ex_launcher_t<_t_a, _t_b, is_beta_zero>;
+
+// Tile of the GEMMs of small matrices on ARM_GPU, whose blocks of C tell
+// whether a GEMM fills the device or is split along K, see _gemm_split_k
+template <typename element_t>
+using small_tile_t = Tile<4, 4, 4, 4>;
+
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm(
     executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
-    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+    container_0_t _a, index_t _lda, index_t _stridea, container_1_t _b,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _c,
+    index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type) {
   if (batch_type == gemm_batch_type_t::interleaved) {
     return blas::Gemm_Launcher<
@@ -47,9 +86,12 @@ typename executor_t::policy_t::event_t _gemm(
             gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
                                                                     _K, _alpha,
                                                                     _a, _lda,
+                                                                    _stridea,
                                                                     _b, _ldb,
+                                                                    _strideb,
                                                                     _beta, _c,
                                                                     _ldc,
+                                                                    _stridec,
                                                                     batch_size);
   } else {
     /* Tends to perform well for Winograd sizes (i.e. batched) */
@@ -62,9 +104,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (!_t_a) {
       /* Does well on most im2col or 1x1 convolutions, or is within 10% of
@@ -77,9 +123,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else {
       return blas::Gemm_Launcher<
@@ -90,9 +140,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     }
   }
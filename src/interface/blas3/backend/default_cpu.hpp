@@ -24,19 +24,73 @@
  **************************************************************************/
 #ifndef SYCL_BLAS_GEMM_DEFAULT_CPU_BACKEND_HPP
 #define SYCL_BLAS_GEMM_DEFAULT_CPU_BACKEND_HPP
+#include "interface/gemm_dispatch.hpp"
 #include "interface/gemm_launcher.h"
 
 namespace blas {
 namespace gemm {
 namespace backend {
+// Strided configurations compiled for the default CPU target, which a
+// GemmDispatchTable can select instead of the thresholds below
+template <typename element_t>
+using dispatch_configs_t = DispatchConfigList<
+#if defined(NAIVE_GEMM)
+    DispatchConfig<64, false, false, false, 64, Tile<8, 8, 8, 8>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::naive),
+                   static_cast<int>(gemm_vectorization_t::none), 1>>;
+#else
+    DispatchConfig<64, false, false, false, 64, Tile<2, 2, 8, 8>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 2>,
+    DispatchConfig<64, false, false, false, 64, Tile<8, 8, 8, 8>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::partial), 1>>;
+#endif
+
+// Configuration compiled for the default CPU target for the GEMMs fusing an
+// epilogue or a prologue, see _gemm_ex. Only the naive and the full
+// vectorization kernels take them
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using ex_launcher_t = Gemm_Launcher<
+#if defined(NAIVE_GEMM)
+    64, false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
+    static_cast<int>(gemm_memory_t::no_local),
+    static_cast<int>(gemm_algorithm_t::naive),
+    static_cast<int>(gemm_vectorization_t::none), is_beta_zero, 1,
+#else
+    64, false, false, false, 64, Tile<2, 2, 8, 8>, _t_a, _t_b,
+    static_cast<int>(gemm_memory_t::no_local),
+    static_cast<int>(gemm_algorithm_t::standard),
+    static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 2,
+#endif
+    static_cast<int>(gemm_batch_type_t::strided)>;
+
+// The GEMMs reading half operands and accumulating in float use the same
+// configuration on the default CPU target, see _gemm_mixed
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using mixed_launcher_t = ex_launcher_t<_t_a, _t_b, is_beta_zero>;
+
+// Tile of the GEMMs of small matrices on the default CPU target, whose blocks
+// of C tell whether a GEMM fills the device or is split along K, see
+// _gemm_split_k. The naive GEMM computes an element of C per work item.
+template <typename element_t>
+#if defined(NAIVE_GEMM)
+using small_tile_t = Tile<1, 1, 8, 8>;
+#else
+using small_tile_t = Tile<2, 2, 8, 8>;
+#endif
 
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm(
     executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
-    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+    container_0_t _a, index_t _lda, index_t _stridea, container_1_t _b,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _c,
+    index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type) {
   if (batch_type == gemm_batch_type_t::interleaved) {
     return blas::Gemm_Launcher<
@@ -48,9 +102,12 @@ typename executor_t::policy_t::event_t _gemm(
             gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
                                                                     _K, _alpha,
                                                                     _a, _lda,
+                                                                    _stridea,
                                                                     _b, _ldb,
+                                                                    _strideb,
                                                                     _beta, _c,
                                                                     _ldc,
+                                                                    _stridec,
                                                                     batch_size);
   }
 #if defined(NAIVE_GEMM)
@@ -62,8 +119,10 @@ typename executor_t::policy_t::event_t _gemm(
       static_cast<int>(
           gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                               _alpha, _a, _lda,
-                                                              _b, _ldb, _beta,
-                                                              _c, _ldc,
+                                                              _stridea, _b,
+                                                              _ldb, _strideb,
+                                                              _beta, _c, _ldc,
+                                                              _stridec,
                                                               batch_size);
 #else
   if (_M <= 128 && _N <= 128 && _K <= 128) {
@@ -75,8 +134,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   } else {
     return blas::Gemm_Launcher<
@@ -87,8 +149,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }
 
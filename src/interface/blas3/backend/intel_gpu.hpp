@@ -24,18 +24,87 @@
  **************************************************************************/
 #ifndef SYCL_BLAS_GEMM_INTEL_GPU_BACKEND_HPP
 #define SYCL_BLAS_GEMM_INTEL_GPU_BACKEND_HPP
+#include "interface/gemm_dispatch.hpp"
 #include "interface/gemm_launcher.h"
 
 namespace blas {
 namespace gemm {
 namespace backend {
+// Strided configurations compiled for INTEL_GPU, selectable at runtime
+template <typename element_t>
+using dispatch_configs_t = DispatchConfigList<
+#ifdef GEMM_TALL_SKINNY_SUPPORT
+    DispatchConfig<16, true, false, false, 64, Tile<1, 1, 4, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 4>,
+    DispatchConfig<16, true, false, false, 64, Tile<2, 2, 4, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 4>,
+    DispatchConfig<64, true, true, true, 64, Tile<2, 2, 8, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 4>,
+    DispatchConfig<64, true, true, true, 64, Tile<4, 4, 8, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 4>,
+    DispatchConfig<256, true, true, true, 64, Tile<4, 4, 16, 16>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 4>,
+    DispatchConfig<32, true, true, true, 64, Tile<2, 1, 8, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 4>,
+    DispatchConfig<32, true, true, true, 64, Tile<2, 2, 8, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::tall_skinny),
+                   static_cast<int>(gemm_vectorization_t::none), 4>,
+#endif
+    DispatchConfig<64, true, false, false, 64, Tile<4, 4, 8, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 4>,
+    DispatchConfig<64, false, false, false, 64, Tile<8, 8, 8, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 4>,
+    DispatchConfig<64, false, false, false, 64, Tile<8, 8, 8, 8>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::partial), 4>>;
+
+// Configuration compiled for INTEL_GPU for the GEMMs fusing an epilogue or a
+// prologue, see _gemm_ex. Only the naive and the full vectorization
+// kernels take them
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using ex_launcher_t = Gemm_Launcher<
+    64, true, false, false, 64, Tile<4, 4, 8, 8>, _t_a, _t_b,
+    static_cast<int>(gemm_memory_t::local),
+    static_cast<int>(gemm_algorithm_t::standard),
+    static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+    static_cast<int>(gemm_batch_type_t::strided)>;
+
+// The GEMMs reading half operands and accumulating in float use the same
+// configuration on INTEL_GPU, see _gemm_mixed
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using mixed_launcher_t = ex_launcher_t<_t_a, _t_b, is_beta_zero>;
+
+// Tile of the GEMMs of small matrices on INTEL_GPU, whose blocks of C tell
+// whether a GEMM fills the device or is split along K, see _gemm_split_k
+template <typename element_t>
+using small_tile_t = Tile<4, 4, 8, 8>;
+
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm(
     executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
-    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+    container_0_t _a, index_t _lda, index_t _stridea, container_1_t _b,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _c,
+    index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type) {
   if (batch_type == gemm_batch_type_t::interleaved) {
     return blas::Gemm_Launcher<
@@ -47,9 +116,12 @@ typename executor_t::policy_t::event_t _gemm(
             gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
                                                                     _K, _alpha,
                                                                     _a, _lda,
+                                                                    _stridea,
                                                                     _b, _ldb,
+                                                                    _strideb,
                                                                     _beta, _c,
                                                                     _ldc,
+                                                                    _stridec,
                                                                     batch_size);
   }
 #ifdef GEMM_TALL_SKINNY_SUPPORT
@@ -65,9 +137,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M <= 4 || _N <= 4) {
       return blas::Gemm_Launcher<
@@ -78,9 +154,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M >= 16 && _N <= 8) {
       return blas::Gemm_Launcher<
@@ -91,9 +171,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M <= 8 || _N <= 8) {
       return blas::Gemm_Launcher<
@@ -104,9 +188,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M <= 16 || _N <= 16) {
       return blas::Gemm_Launcher<
@@ -117,9 +205,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else if (_M <= 32 || _N <= 32) {
       return blas::Gemm_Launcher<
@@ -130,9 +222,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else {
       return blas::Gemm_Launcher<
@@ -143,9 +239,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     }
   } else if (batch_size == 1 && (_t_a || (_t_b && _M * _N > 1048576))) {
@@ -158,9 +258,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     } else {
       return blas::Gemm_Launcher<
@@ -171,9 +275,13 @@ typename executor_t::policy_t::event_t _gemm(
           static_cast<int>(
               gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N,
                                                                   _K, _alpha,
-                                                                  _a, _lda, _b,
-                                                                  _ldb, _beta,
-                                                                  _c, _ldc,
+                                                                  _a, _lda,
+                                                                  _stridea, _b,
+                                                                  _ldb,
+                                                                  _strideb,
+                                                                  _beta, _c,
+                                                                  _ldc,
+                                                                  _stridec,
                                                                   batch_size);
     }
   }
@@ -187,8 +295,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   } else if (_t_b && !_t_a) {
     return blas::Gemm_Launcher<
@@ -199,8 +310,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   } else {
     return blas::Gemm_Launcher<
@@ -211,8 +325,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }
 }
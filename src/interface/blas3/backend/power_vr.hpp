@@ -24,6 +24,7 @@
  **************************************************************************/
 #ifndef SYCL_BLAS_GEMM_POWERVR_BACKEND_HPP
 #define SYCL_BLAS_GEMM_POWERVR_BACKEND_HPP
+#include "interface/gemm_dispatch.hpp"
 #include "interface/gemm_launcher.h"
 
 #ifdef IMGDNN_LIBRARY
@@ -36,6 +37,50 @@
 namespace blas {
 namespace gemm {
 namespace backend {
+// Strided configurations compiled for POWER_VR
+template <typename element_t>
+using dispatch_configs_t = DispatchConfigList<
+    DispatchConfig<96, true, false, false, 16, Tile<4, 6, 12, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 1>,
+    DispatchConfig<64, false, false, false, 128, Tile<1, 1, 8, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 1>,
+    DispatchConfig<64, false, false, false, 64, Tile<4, 4, 8, 8>,
+                   static_cast<int>(gemm_memory_t::no_local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 1>,
+    DispatchConfig<128, false, false, false, 16, Tile<4, 8, 16, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 1>,
+    DispatchConfig<64, false, false, false, 32, Tile<4, 4, 8, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 1>>;
+
+// Configuration compiled for POWER_VR for the GEMMs fusing an epilogue or a
+// prologue, see _gemm_ex. Only the naive and the full vectorization
+// kernels take them
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using ex_launcher_t = Gemm_Launcher<
+    64, false, false, false, 32, Tile<4, 4, 8, 8>, _t_a, _t_b,
+    static_cast<int>(gemm_memory_t::local),
+    static_cast<int>(gemm_algorithm_t::standard),
+    static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 1,
+    static_cast<int>(gemm_batch_type_t::strided)>;
+
+// The GEMMs reading half operands and accumulating in float use the same
+// configuration on POWER_VR, see _gemm_mixed
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using mixed_launcher_t = ex_launcher_t<_t_a, _t_b, is_beta_zero>;
+
+// Tile of the GEMMs of small matrices on POWER_VR, whose blocks of C tell
+// whether a GEMM fills the device or is split along K, see _gemm_split_k
+template <typename element_t>
+using small_tile_t = Tile<4, 4, 8, 8>;
 
 #ifdef IMGDNN_LIBRARY
 namespace sycl_imagination_nn_api {
@@ -302,8 +347,9 @@ template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm(
     executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
-    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+    container_0_t _a, index_t _lda, index_t _stridea, container_1_t _b,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _c,
+    index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type) {
 #ifdef IMGDNN_LIBRARY
   if (batch_type == gemm_batch_type_t::interleaved) {
@@ -311,6 +357,12 @@ typename executor_t::policy_t::event_t _gemm(
               << std::endl;
     return {};
   }
+  if (batch_size > 1 && (_stridea != _M * _K || _strideb != _K * _N ||
+                         _stridec != _M * _N)) {
+    std::cerr << "Error: IMGDNN only supports contiguous batches of matrices"
+              << std::endl;
+    return {};
+  }
   return blas::gemm::backend::sycl_imagination_nn_api::Gemm_Launcher<
       _t_a, _t_b>::template _select_gemm(ex, _M, _N, _K, _alpha, _a, _b, _beta,
                                          _c, batch_size);
@@ -325,9 +377,12 @@ typename executor_t::policy_t::event_t _gemm(
             gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
                                                                     _K, _alpha,
                                                                     _a, _lda,
+                                                                    _stridea,
                                                                     _b, _ldb,
+                                                                    _strideb,
                                                                     _beta, _c,
                                                                     _ldc,
+                                                                    _stridec,
                                                                     batch_size);
   }
   // The following _M, _N ,and _K is used for SSD + Mobilenet v2 (TF version)
@@ -344,8 +399,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }  // The following _M, _N ,and _K is used for SSD + Mobilenet v2 (TF version)
   // We computed the best tile combination for each sizes -(4-March-2018)
@@ -364,8 +422,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }  // The following _M, _N ,and _K is used for SSD + Mobilenet v2 (TF version)
   // We computed the best tile combination for each sizes -(4-March-2018)
@@ -380,8 +441,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }  // The following _M, _N ,and _K is used for SSD + Mobilenet v2 (TF version)
   // We computed the best tile combination for each sizes -(4-March-2018)
@@ -403,8 +467,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   } else {
     return blas::Gemm_Launcher<
@@ -415,8 +482,11 @@ typename executor_t::policy_t::event_t _gemm(
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
+                                                                _lda, _stridea,
+                                                                _b, _ldb,
+                                                                _strideb, _beta,
+                                                                _c, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }
 #endif
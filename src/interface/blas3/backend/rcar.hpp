@@ -24,20 +24,56 @@
  **************************************************************************/
 #ifndef SYCL_BLAS_GEMM_RCAR_BACKEND_HPP
 #define SYCL_BLAS_GEMM_RCAR_BACKEND_HPP
+#include "interface/gemm_dispatch.hpp"
 #include "interface/gemm_launcher.h"
 
 namespace blas {
 namespace gemm {
 namespace backend {
+// Strided configurations compiled for RCAR
+template <typename element_t>
+using dispatch_configs_t = DispatchConfigList<
+    DispatchConfig<32, false, false, false, 128, Tile<4, 8, 8, 4>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 4>,
+    DispatchConfig<32, false, false, false, 128, Tile<8, 4, 4, 8>,
+                   static_cast<int>(gemm_memory_t::local),
+                   static_cast<int>(gemm_algorithm_t::standard),
+                   static_cast<int>(gemm_vectorization_t::full), 4>>;
+
+// Configuration compiled for RCAR for the GEMMs fusing an epilogue or a
+// prologue, see _gemm_ex. Only the naive and the full vectorization
+// kernels take them
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using ex_launcher_t = Gemm_Launcher<
+    32, false, false, false, 128, Tile<4, 8, 8, 4>, _t_a, _t_b,
+    static_cast<int>(gemm_memory_t::local),
+    static_cast<int>(gemm_algorithm_t::standard),
+    static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+    static_cast<int>(gemm_batch_type_t::strided)>;
+
+// The GEMMs reading half operands and accumulating in float use the same
+// configuration on RCAR, see _gemm_mixed
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+using mixed_launcher_t = ex_launcher_t<_t_a, _t_b, is_beta_zero>;
+
+// Tile of the GEMMs of small matrices on RCAR, whose blocks of C tell
+// whether a GEMM fills the device or is split along K, see _gemm_split_k
+template <typename element_t>
+using small_tile_t = Tile<4, 8, 8, 4>;
+
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename Executor,
           typename container_t0, typename container_t1, typename container_t2,
           typename element_t, typename index_t>
 typename Executor::policy_t::event_t _gemm(Executor& ex, index_t _M, index_t _N,
                                            index_t _K, element_t _alpha,
                                            container_t0 a_, index_t _lda,
-                                           container_t1 b_, index_t _ldb,
+                                           index_t _stridea, container_t1 b_,
+                                           index_t _ldb, index_t _strideb,
                                            element_t _beta, container_t2 _C,
-                                           index_t _ldc, index_t batch_size,
+                                           index_t _ldc, index_t _stridec,
+                                           index_t batch_size,
                                            gemm_batch_type_t batch_type) {
   if (batch_type == gemm_batch_type_t::interleaved) {
     return blas::Gemm_Launcher<
@@ -48,10 +84,13 @@ typename Executor::policy_t::event_t _gemm(Executor& ex, index_t _M, index_t _N,
         static_cast<int>(
             gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
                                                                     _K, _alpha,
-                                                                    _a, _lda,
-                                                                    _b, _ldb,
-                                                                    _beta, _c,
+                                                                    a_, _lda,
+                                                                    _stridea,
+                                                                    b_, _ldb,
+                                                                    _strideb,
+                                                                    _beta, _C,
                                                                     _ldc,
+                                                                    _stridec,
                                                                     batch_size);
   }
   if (_M < 512 && _N < 512) {
@@ -63,8 +102,11 @@ typename Executor::policy_t::event_t _gemm(Executor& ex, index_t _M, index_t _N,
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, a_,
-                                                                _lda, b_, _ldb,
-                                                                _beta, _C, _ldc,
+                                                                _lda, _stridea,
+                                                                b_, _ldb,
+                                                                _strideb, _beta,
+                                                                _C, _ldc,
+                                                                _stridec,
                                                                 batch_size);
 
   } else {
@@ -76,8 +118,11 @@ typename Executor::policy_t::event_t _gemm(Executor& ex, index_t _M, index_t _N,
         static_cast<int>(
             gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
                                                                 _alpha, a_,
-                                                                _lda, b_, _ldb,
-                                                                _beta, _C, _ldc,
+                                                                _lda, _stridea,
+                                                                b_, _ldb,
+                                                                _strideb, _beta,
+                                                                _C, _ldc,
+                                                                _stridec,
                                                                 batch_size);
   }
 }
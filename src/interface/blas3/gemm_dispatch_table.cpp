@@ -0,0 +1,354 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_dispatch_table.cpp
+ *
+ **************************************************************************/
+
+#include "interface/gemm_dispatch_table.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace blas {
+
+namespace {
+
+const char* get_name(gemm_memory_t memory) {
+  return memory == gemm_memory_t::local ? "local" : "no_local";
+}
+
+const char* get_name(gemm_algorithm_t algorithm) {
+  switch (algorithm) {
+    case gemm_algorithm_t::naive:
+      return "naive";
+    case gemm_algorithm_t::tall_skinny:
+      return "tall_skinny";
+    default:
+      return "standard";
+  }
+}
+
+const char* get_name(gemm_vectorization_t vectorization) {
+  switch (vectorization) {
+    case gemm_vectorization_t::none:
+      return "none";
+    case gemm_vectorization_t::partial:
+      return "partial";
+    default:
+      return "full";
+  }
+}
+
+/* A size column is either '*' or a non-negative integer */
+int64_t parse_size(const std::string& field, size_t line_number) {
+  if (field == "*") {
+    return -1;
+  }
+  std::istringstream stream(field);
+  int64_t value;
+  if (!(stream >> value) || !stream.eof() || value < 0) {
+    throw std::invalid_argument("invalid size '" + field +
+                                "' in the GEMM dispatch table, line " +
+                                std::to_string(line_number));
+  }
+  return value;
+}
+
+std::string parse_transpose(const std::string& field, size_t line_number) {
+  if (field == "*") {
+    return "";
+  }
+  if (field != "n" && field != "t") {
+    throw std::invalid_argument("invalid transpose '" + field +
+                                "' in the GEMM dispatch table, line " +
+                                std::to_string(line_number));
+  }
+  return field;
+}
+
+bool fits(int64_t max_size, int64_t size) {
+  return max_size < 0 || size <= max_size;
+}
+
+}  // namespace
+
+std::string get_gemm_config_name(gemm_memory_t memory,
+                                 gemm_algorithm_t algorithm,
+                                 gemm_vectorization_t vectorization,
+                                 int vector_size, int cl_size,
+                                 bool double_buffer, bool nbc_a, bool nbc_b,
+                                 int item_rows, int item_cols, int wg_rows,
+                                 int wg_cols) {
+  std::ostringstream str{};
+  str << get_name(memory) << "_" << get_name(algorithm) << "_"
+      << get_name(vectorization) << "_vs" << vector_size << "_cl" << cl_size
+      << "_db" << double_buffer << "_nca" << nbc_a << "_ncb" << nbc_b << "_t"
+      << item_rows << "x" << item_cols << "_wg" << wg_rows << "x" << wg_cols;
+  return str.str();
+}
+
+GemmDispatchTable::GemmDispatchTable()
+    : rules_(std::make_shared<const rules_t>()), size_(0) {}
+
+GemmDispatchTable& GemmDispatchTable::get_default() {
+  static GemmDispatchTable table;
+  static std::once_flag loaded;
+  std::call_once(loaded, []() { table.load_default(); });
+  return table;
+}
+
+void GemmDispatchTable::load_default() {
+  clear();
+  const char* path = std::getenv(env_var);
+#ifdef SYCL_BLAS_DEFAULT_GEMM_DISPATCH_TABLE
+  if (path == nullptr) {
+    path = SYCL_BLAS_DEFAULT_GEMM_DISPATCH_TABLE;
+  }
+#endif
+  // A table which fails to load is reported, the GEMM routines then use the
+  // backend thresholds rather than failing
+  if (path != nullptr && path[0] != '\0') {
+    try {
+      load_file(path);
+    } catch (const std::exception& e) {
+      std::cerr << "Warning: ignoring the GEMM dispatch table: " << e.what()
+                << std::endl;
+    }
+  }
+}
+
+void GemmDispatchTable::load(std::istream& input) {
+  std::vector<GemmDispatchRule> rules;
+  std::string line;
+  size_t line_number = 0;
+  while (std::getline(input, line)) {
+    ++line_number;
+    std::istringstream fields(line);
+    std::string device;
+    if (!(fields >> device) || device[0] == '#') {
+      continue;
+    }
+    std::string trans_a, trans_b, m, n, k, batch_size, config, extra;
+    if (!(fields >> trans_a >> trans_b >> m >> n >> k >> batch_size >>
+          config) ||
+        (fields >> extra)) {
+      throw std::invalid_argument(
+          "expected 8 columns in the GEMM dispatch table, line " +
+          std::to_string(line_number));
+    }
+    rules.push_back({device == "*" ? "" : device,
+                     parse_transpose(trans_a, line_number),
+                     parse_transpose(trans_b, line_number),
+                     parse_size(m, line_number), parse_size(n, line_number),
+                     parse_size(k, line_number),
+                     parse_size(batch_size, line_number), config});
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto new_rules = std::make_shared<rules_t>(*std::atomic_load(&rules_));
+  new_rules->insert(new_rules->end(), rules.begin(), rules.end());
+  set_rules(std::move(new_rules));
+}
+
+void GemmDispatchTable::load_file(const std::string& path) {
+  std::ifstream input(path);
+  if (!input) {
+    throw std::runtime_error("could not read the GEMM dispatch table " +
+                             path);
+  }
+  load(input);
+}
+
+void GemmDispatchTable::add_rule(const GemmDispatchRule& rule) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto new_rules = std::make_shared<rules_t>(*std::atomic_load(&rules_));
+  new_rules->push_back(rule);
+  set_rules(std::move(new_rules));
+}
+
+void GemmDispatchTable::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  set_rules(std::make_shared<const rules_t>());
+}
+
+size_t GemmDispatchTable::size() const { return size_; }
+
+void GemmDispatchTable::set_rules(std::shared_ptr<const rules_t> rules) {
+  size_ = rules->size();
+  std::atomic_store(&rules_, std::move(rules));
+}
+
+std::string GemmDispatchTable::find(const std::string& device, bool trans_a,
+                                    bool trans_b, int64_t m, int64_t n,
+                                    int64_t k, int64_t batch_size) const {
+  if (size_ == 0) {
+    return "";
+  }
+  const char ta = trans_a ? 't' : 'n';
+  const char tb = trans_b ? 't' : 'n';
+  // The snapshot stays valid while the rules are changed
+  const auto rules = std::atomic_load(&rules_);
+  for (const auto& rule : *rules) {
+    if ((rule.device.empty() || rule.device == device) &&
+        (rule.trans_a.empty() || rule.trans_a[0] == ta) &&
+        (rule.trans_b.empty() || rule.trans_b[0] == tb) &&
+        fits(rule.max_m, m) && fits(rule.max_n, n) && fits(rule.max_k, k) &&
+        fits(rule.max_batch_size, batch_size)) {
+      return rule.config;
+    }
+  }
+  return "";
+}
+
+constexpr GemmOnlineTuner::interval_t GemmOnlineTuner::default_min_interval;
+
+GemmOnlineTuner::~GemmOnlineTuner() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+    tasks_.clear();
+  }
+  cv_.notify_all();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+GemmOnlineTuner& GemmOnlineTuner::get_default() {
+  static GemmOnlineTuner tuner;
+  static std::once_flag initialized;
+  std::call_once(initialized, []() {
+    const char* value = std::getenv(env_var);
+    tuner.set_enabled(value != nullptr && std::string(value) == "1");
+  });
+  return tuner;
+}
+
+std::string GemmOnlineTuner::get_key(const std::string& device, bool trans_a,
+                                     bool trans_b, int64_t m, int64_t n,
+                                     int64_t k, int64_t batch_size,
+                                     size_t element_size) {
+  std::ostringstream str{};
+  str << device << " " << (trans_a ? "t" : "n") << (trans_b ? "t" : "n")
+      << " " << m << " " << n << " " << k << " " << batch_size << " "
+      << element_size;
+  return str.str();
+}
+
+void GemmOnlineTuner::set_enabled(bool enabled) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  enabled_ = enabled;
+  update_active();
+}
+
+bool GemmOnlineTuner::is_enabled() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return enabled_;
+}
+
+void GemmOnlineTuner::set_min_interval(interval_t min_interval) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    min_interval_ = min_interval;
+  }
+  cv_.notify_all();
+}
+
+GemmOnlineTuner::interval_t GemmOnlineTuner::get_min_interval() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return min_interval_;
+}
+
+std::string GemmOnlineTuner::find(const std::string& key, bool& must_tune) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto config = configs_.find(key);
+  must_tune = enabled_ && config == configs_.end();
+  if (must_tune) {
+    configs_[key] = "";
+    update_active();
+    return "";
+  }
+  return config == configs_.end() ? "" : config->second;
+}
+
+void GemmOnlineTuner::submit(const std::string& key, task_t task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stop_) {
+      return;
+    }
+    tasks_.emplace_back(key, std::move(task));
+    if (!worker_.joinable()) {
+      worker_ = std::thread(&GemmOnlineTuner::run, this);
+    }
+  }
+  cv_.notify_all();
+}
+
+void GemmOnlineTuner::wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return tasks_.empty() && running_ == 0; });
+}
+
+void GemmOnlineTuner::clear() {
+  wait();
+  std::lock_guard<std::mutex> lock(mutex_);
+  configs_.clear();
+  update_active();
+}
+
+void GemmOnlineTuner::update_active() {
+  active_ = enabled_ || !configs_.empty();
+}
+
+void GemmOnlineTuner::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+    // The interval is read again when it is changed while waiting
+    while (!stop_ &&
+           cv_.wait_until(lock, last_start_ + min_interval_) ==
+               std::cv_status::no_timeout) {
+    }
+    if (stop_) {
+      return;
+    }
+    last_start_ = std::chrono::steady_clock::now();
+    auto task = std::move(tasks_.front());
+    tasks_.pop_front();
+    ++running_;
+    lock.unlock();
+    std::string config;
+    try {
+      config = task.second();
+    } catch (...) {
+      // The shape keeps using the backend thresholds
+    }
+    lock.lock();
+    configs_[task.first] = config;
+    --running_;
+    cv_.notify_all();
+  }
+}
+
+}  // namespace blas
@@ -0,0 +1,53 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_s8.cpp
+ *
+ **************************************************************************/
+
+#include "container/sycl_iterator.hpp"
+#include "executors/executor_sycl.hpp"
+#include "interface/blas3_interface.hpp"
+#include "operations/blas3_trees.hpp"
+#include "operations/blas_constants.hpp"
+#include "policy/sycl_policy_handler.hpp"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+namespace internal {
+using executor_t = Executor<PolicyHandler<codeplay_policy>>;
+using int8_container_t = BufferIterator<int8_t, codeplay_policy>;
+using int32_container_t = BufferIterator<int32_t, codeplay_policy>;
+using float_container_t = BufferIterator<float, codeplay_policy>;
+
+// int8 operands requantized to an int8 result
+template typename executor_t::policy_t::event_t _gemm_s8(
+    executor_t& ex, char _TransA, char _TransB, int _M, int _N, int _K,
+    int8_container_t a_, int _lda, int8_container_t b_, int _ldb,
+    int8_container_t _C, int _ldc, gemm_quantization_t quantization_type,
+    float_container_t scale, int32_container_t zero_point);
+// int8 operands requantized to a float result
+template typename executor_t::policy_t::event_t _gemm_s8(
+    executor_t& ex, char _TransA, char _TransB, int _M, int _N, int _K,
+    int8_container_t a_, int _lda, int8_container_t b_, int _ldb,
+    float_container_t _C, int _ldc, gemm_quantization_t quantization_type,
+    float_container_t scale, int32_container_t zero_point);
+}  // namespace internal
+}  // namespace blas
@@ -29,15 +29,19 @@
 #include "blas_meta.h"
 #include "executors/executor.h"
 #include "interface/blas1_interface.h"
+#include "interface/blas2_interface.hpp"
 #include "interface/blas3/backend/backend.hpp"
 #include "interface/blas3_interface.h"
+#include "interface/gemm_dispatch_table.h"
 #include "operations/blas3_trees.h"
 #include "policy/sycl_policy_handler.h"
 #include <algorithm>
 #include <cctype>
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace blas {
@@ -50,17 +54,251 @@ namespace blas {
  */
 namespace internal {
 
+/*!
+ * @brief The distance between two consecutive matrices of A, or of B, when
+ * they are stored one after the other.
+ */
+template <typename index_t>
+inline index_t get_implicit_stride_a(char _TransA, index_t _M, index_t _K,
+                                     index_t _lda) {
+  return _lda * (tolower(_TransA) == 'n' ? _K : _M);
+}
+
+template <typename index_t>
+inline index_t get_implicit_stride_b(char _TransB, index_t _K, index_t _N,
+                                     index_t _ldb) {
+  return _ldb * (tolower(_TransB) == 'n' ? _N : _K);
+}
+
+/*!
+ * @brief Computes a GEMM with at most 16 columns as the product of A with a
+ * few vectors, which streams A once instead of cutting it in the square tiles
+ * the GEMM kernels are tuned for.
+ *
+ * Each row of C is reduced along K by a single work item, or by a single work
+ * group when A is transposed. The GEMM is only launched this way when its rows
+ * give every compute unit a work group and K is not much deeper than M, other
+ * shapes are left to the GEMMs sharing the reduction between work groups.
+ * @return whether the GEMM was launched, events then holds its events
+ */
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename std::enable_if<
+    std::is_same<typename executor_t::policy_t, codeplay_policy>::value,
+    bool>::type
+_gemm_small_n(executor_t& ex, index_t _M, index_t _N, index_t _K,
+              element_t _alpha, container_0_t a_, index_t _lda,
+              container_1_t b_, index_t _ldb, element_t _beta,
+              container_2_t _C, index_t _ldc,
+              typename executor_t::policy_t::event_t& events) {
+  constexpr index_t gemm_small_n_max = 16;
+  constexpr index_t gemm_small_n_max_k_ratio = 8;
+  if (_N > gemm_small_n_max || _K > gemm_small_n_max_k_ratio * _M) {
+    return false;
+  }
+  constexpr transpose_type trn_a =
+      _t_a ? transpose_type::Transposed : transpose_type::Normal;
+  constexpr transpose_type trn_b =
+      _t_b ? transpose_type::Transposed : transpose_type::Normal;
+  constexpr index_t rows_per_work_group =
+      _t_a ? 1
+           : blas::gemv_multi::backend::get_local_range<
+                 transpose_type::Normal>();
+  const index_t work_groups = (_M - 1) / rows_per_work_group + 1;
+  if (work_groups <
+      static_cast<index_t>(ex.get_policy_handler().get_num_compute_units())) {
+    return false;
+  }
+  // The columns of op(B) are the vectors x and those of C the vectors y
+  const index_t rows_a = _t_a ? _K : _M;
+  const index_t cols_a = _t_a ? _M : _K;
+  events = blas::gemv_multi::backend::_gemv_multi<trn_a, trn_b>(
+      ex, rows_a, cols_a, _N, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc);
+  return true;
+}
+
+/*!
+ * @brief The kernel of the product with a few vectors relies on work group
+ * barriers, other executors always run the GEMM kernels.
+ */
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename std::enable_if<
+    !std::is_same<typename executor_t::policy_t, codeplay_policy>::value,
+    bool>::type
+_gemm_small_n(executor_t&, index_t, index_t, index_t, element_t,
+              container_0_t, index_t, container_1_t, index_t, element_t,
+              container_2_t, index_t, typename executor_t::policy_t::event_t&) {
+  return false;
+}
+
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm_platform_specific(
     executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
-    element_t _beta, container_2_t _C, index_t _ldc, index_t batch_size,
+    container_0_t a_, index_t _lda, index_t _stridea, container_1_t b_,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t _stridec, index_t batch_size,
+    gemm_batch_type_t batch_type);
+
+/*!
+ * @brief Number of slices K is split into so that a GEMM whose blocks of C do
+ * not occupy every compute unit fills the device, 1 when it is not split.
+ * @param block_rows, block_cols the size of the blocks of C computed by a
+ * work group of the backend
+ */
+template <typename index_t>
+inline index_t get_split_k_depth(index_t compute_units, index_t block_rows,
+                                 index_t block_cols, index_t _M, index_t _N,
+                                 index_t _K) {
+  // The smallest slice of K worth the extra pass over C
+  constexpr index_t min_slice_size = 256;
+  constexpr index_t max_depth = 32;
+  const index_t blocks =
+      ((_M - 1) / block_rows + 1) * ((_N - 1) / block_cols + 1);
+  if (blocks >= compute_units) {
+    return 1;
+  }
+  // As in the tall and skinny GEMM, each compute unit is given 4 work groups
+  const index_t depth = (4 * compute_units) / blocks;
+  return std::max<index_t>(
+      1, std::min(std::min(depth, _K / min_slice_size), max_depth));
+}
+
+/*!
+ * @brief Computes a GEMM which does not fill the device by splitting K in
+ * slices of the same size, whose products are computed into a scratch buffer
+ * by a single strided batched GEMM. The remainder of K, when K is not a
+ * multiple of the slices, goes through a GEMM writing C directly. One last
+ * kernel then adds the products of the slices to C, applying beta when C was
+ * not already written.
+ *
+ * The GEMM kernels store their blocks of C rather than add them atomically,
+ * so the slices are not accumulated onto C directly. The scratch buffer holds
+ * M * N * depth elements, which stays small as only GEMMs with few blocks of
+ * C are split.
+ * @return whether K was split, events then holds the events of the GEMM
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+bool _gemm_split_k(executor_t& ex, index_t _M, index_t _N, index_t _K,
+                   element_t _alpha, container_0_t a_, index_t _lda,
+                   container_1_t b_, index_t _ldb, element_t _beta,
+                   container_2_t _C, index_t _ldc,
+                   typename executor_t::policy_t::event_t& events) {
+  using tile_t = blas::gemm::backend::small_tile_t<element_t>;
+  auto policy_handler = ex.get_policy_handler();
+  const index_t depth = get_split_k_depth(
+      static_cast<index_t>(policy_handler.get_num_compute_units()),
+      static_cast<index_t>(tile_t::item_rows * tile_t::wg_rows),
+      static_cast<index_t>(tile_t::item_cols * tile_t::wg_cols), _M, _N, _K);
+  if (depth < 2) {
+    return false;
+  }
+  const index_t slice_size = _K / depth;
+  const index_t remainder = _K - slice_size * depth;
+  // The remainder is the beginning of K. Columns of op(A), and rows of
+  // op(B), are lda, and 1, elements apart unless they are transposed.
+  const index_t k_stride_a = _t_a ? 1 : _lda;
+  const index_t k_stride_b = _t_b ? _ldb : 1;
+  if (remainder > 0) {
+    events = _gemm_platform_specific<_t_a, _t_b, is_beta_zero>(
+        ex, _M, _N, remainder, _alpha, a_, _lda,
+        get_implicit_stride_a(_t_a ? 't' : 'n', _M, remainder, _lda), b_, _ldb,
+        get_implicit_stride_b(_t_b ? 't' : 'n', remainder, _N, _ldb), _beta,
+        _C, _ldc, _ldc * _N, index_t(1), gemm_batch_type_t::strided);
+  }
+  auto products =
+      policy_handler.template acquire_scratch<element_t>(_M * _N * depth);
+  events = concatenate_vectors(
+      events,
+      _gemm_platform_specific<_t_a, _t_b, true>(
+          ex, _M, _N, slice_size, _alpha, a_ + remainder * k_stride_a, _lda,
+          slice_size * k_stride_a, b_ + remainder * k_stride_b, _ldb,
+          slice_size * k_stride_b, element_t{0}, products.get_iterator(), _M,
+          _M * _N, depth, gemm_batch_type_t::strided));
+
+  // Each row of the products matrix holds the contributions of the slices
+  // to one element of C
+  auto mC = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  auto mP = make_matrix_view<col_major>(ex, products.get_iterator(), _M * _N,
+                                        depth, _M * _N);
+  auto sumSlicesOp = make_sumMatrixColumns(mP);
+  if (remainder > 0) {
+    auto addOp = make_op<BinaryOp, AddOperator>(mC, sumSlicesOp);
+    auto assignOp = make_op<Assign>(mC, addOp);
+    events = concatenate_vectors(events, ex.execute(assignOp));
+  } else if (is_beta_zero) {
+    auto assignOp = make_op<Assign>(mC, sumSlicesOp);
+    events = concatenate_vectors(events, ex.execute(assignOp));
+  } else {
+    auto betaMulCOp = make_op<ScalarOp, ProductOperator>(_beta, mC);
+    auto addOp = make_op<BinaryOp, AddOperator>(betaMulCOp, sumSlicesOp);
+    auto assignOp = make_op<Assign>(mC, addOp);
+    events = concatenate_vectors(events, ex.execute(assignOp));
+  }
+  policy_handler.release_scratch(products, events);
+  return true;
+}
+
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_platform_specific(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, index_t _stridea, container_1_t b_,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type) {
+  // A rule of the dispatch table, or else the choice of the online tuner,
+  // overrides the choice of the backend as long as it names one of the
+  // configurations compiled for it. Without either, a GEMM with too few
+  // blocks of C for the device is split along K, and one with only a few
+  // columns is computed as the product of A with a few vectors.
+  if (batch_type == gemm_batch_type_t::strided) {
+    using policy_t = typename executor_t::policy_t;
+    using configs_t = blas::gemm::backend::dispatch_configs_t<element_t>;
+    auto& dispatch_table = GemmDispatchTable::get_default();
+    std::string config;
+    // Neither is looked up, nor the device named, while both are unused
+    if (!dispatch_table.empty() ||
+        GemmOnlineTuner::get_default().is_active()) {
+      const std::string device = policy_t::get_device_type_name(
+          ex.get_policy_handler().get_device_type());
+      config = dispatch_table.find(device, _t_a, _t_b, _M, _N, _K, batch_size);
+      if (config.empty()) {
+        config = blas::gemm::find_online_config<configs_t, _t_a, _t_b,
+                                                is_beta_zero>(
+            ex, device, _M, _N, _K, _alpha, _lda, _ldb, _beta, _ldc,
+            batch_size);
+      }
+    }
+    typename policy_t::event_t events;
+    if (!config.empty() &&
+        configs_t::template launch<_t_a, _t_b, is_beta_zero>(
+            config, events, ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_,
+            _ldb, _strideb, _beta, _C, _ldc, _stridec, batch_size)) {
+      return events;
+    }
+    if (config.empty() && batch_size == 1 &&
+        _gemm_split_k<_t_a, _t_b, is_beta_zero>(ex, _M, _N, _K, _alpha, a_,
+                                                _lda, b_, _ldb, _beta, _C,
+                                                _ldc, events)) {
+      return events;
+    }
+    if (config.empty() && batch_size == 1 &&
+        _gemm_small_n<_t_a, _t_b>(ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb,
+                                  _beta, _C, _ldc, events)) {
+      return events;
+    }
+  }
   return blas::gemm::backend::_gemm<_t_a, _t_b, is_beta_zero>(
-      ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc, batch_size,
-      batch_type);
+      ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb, _beta, _C,
+      _ldc, _stridec, batch_size, batch_type);
 }
 
 template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
@@ -68,16 +306,19 @@ template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
           typename index_t>
 typename executor_t::policy_t::event_t _gemm_is_beta_zero(
     executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
-    element_t _beta, container_2_t _C, index_t _ldc, index_t batch_size,
+    container_0_t a_, index_t _lda, index_t _stridea, container_1_t b_,
+    index_t _ldb, index_t _strideb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type) {
   return ((_beta == static_cast<element_t>(0))
               ? _gemm_platform_specific<_t_a, _t_b, true>(
-                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
-                    batch_size, batch_type)
+                    ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb,
+                    _strideb, _beta, _C, _ldc, _stridec, batch_size,
+                    batch_type)
               : _gemm_platform_specific<_t_a, _t_b, false>(
-                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
-                    batch_size, batch_type));
+                    ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb,
+                    _strideb, _beta, _C, _ldc, _stridec, batch_size,
+                    batch_type));
 }
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -85,21 +326,24 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _gemm_backend(
     executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
     index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
-    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
-    index_t _ldc, index_t batch_size, gemm_batch_type_t batch_type) {
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    index_t batch_size, gemm_batch_type_t batch_type) {
   if (_alpha == element_t{0}) {
     // When alpha = 0, GEMM is equivalent to C = beta * C.
-    if (_ldc == _M) {
-      // When LDC is M, we can scale the full matrix at once.
+    if (_ldc == _M && (batch_size == 1 || _stridec == _M * _N)) {
+      // When the batches of C are contiguous, we can scale them at once.
       const auto matrix_size = _N * _M * batch_size;
       return ::blas::_scal(ex, matrix_size, _beta, _C, index_t{1});
     } else {
-      // When LDC is not M, we must scale each column of C separately.
+      // Otherwise, we must scale each column of C separately.
       typename executor_t::policy_t::event_t events;
-      const auto num_columns = batch_size * _N;
-      for (index_t i = 0; i < num_columns; ++i) {
-        auto ev = ::blas::_scal(ex, _M, _beta, _C + i * _ldc, index_t{1});
-        append_vector(events, ev);
+      for (index_t b = 0; b < batch_size; ++b) {
+        for (index_t i = 0; i < _N; ++i) {
+          auto ev = ::blas::_scal(ex, _M, _beta, _C + b * _stridec + i * _ldc,
+                                  index_t{1});
+          append_vector(events, ev);
+        }
       }
       return events;
     }
@@ -117,21 +361,21 @@ typename executor_t::policy_t::event_t _gemm_backend(
   bool _TrA = _TransA != 'n';
   bool _TrB = _TransB != 'n';
   if (_TrA && _TrB) {
-    return _gemm_is_beta_zero<true, true>(ex, _M, _N, _K, _alpha, a_, _lda, b_,
-                                          _ldb, _beta, _C, _ldc, batch_size,
-                                          batch_type);
+    return _gemm_is_beta_zero<true, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb, _beta,
+        _C, _ldc, _stridec, batch_size, batch_type);
   } else if (!_TrA && _TrB) {
-    return _gemm_is_beta_zero<false, true>(ex, _M, _N, _K, _alpha, a_, _lda, b_,
-                                           _ldb, _beta, _C, _ldc, batch_size,
-                                           batch_type);
+    return _gemm_is_beta_zero<false, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb, _beta,
+        _C, _ldc, _stridec, batch_size, batch_type);
   } else if (_TrA && !_TrB) {
-    return _gemm_is_beta_zero<true, false>(ex, _M, _N, _K, _alpha, a_, _lda, b_,
-                                           _ldb, _beta, _C, _ldc, batch_size,
-                                           batch_type);
+    return _gemm_is_beta_zero<true, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb, _beta,
+        _C, _ldc, _stridec, batch_size, batch_type);
   } else {
-    return _gemm_is_beta_zero<false, false>(ex, _M, _N, _K, _alpha, a_, _lda,
-                                            b_, _ldb, _beta, _C, _ldc,
-                                            batch_size, batch_type);
+    return _gemm_is_beta_zero<false, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb, _beta,
+        _C, _ldc, _stridec, batch_size, batch_type);
   }
 }
 
@@ -144,8 +388,10 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _lda, container_1_t b_,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc) {
-  return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, b_,
-                       _ldb, _beta, _C, _ldc, index_t(1),
+  return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda,
+                       get_implicit_stride_a(_TransA, _M, _K, _lda), b_, _ldb,
+                       get_implicit_stride_b(_TransB, _K, _N, _ldb), _beta, _C,
+                       _ldc, _ldc * _N, index_t(1),
                        gemm_batch_type_t::strided);
 }
 
@@ -156,8 +402,754 @@ typename executor_t::policy_t::event_t _gemm_batched(
     index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, index_t batch_size, gemm_batch_type_t batch_type) {
-  return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, b_,
-                       _ldb, _beta, _C, _ldc, batch_size, batch_type);
+  return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda,
+                       get_implicit_stride_a(_TransA, _M, _K, _lda), b_, _ldb,
+                       get_implicit_stride_b(_TransB, _K, _N, _ldb), _beta, _C,
+                       _ldc, _ldc * _N, batch_size, batch_type);
+}
+
+/*!
+ * @brief Strided batched GEMM. The matrices of a batch are stride_a,
+ * stride_b and stride_c elements apart, so they can be sub-matrices of a
+ * larger tensor. A stride of 0 for A or B uses the same matrix for every
+ * product of the batch.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_strided_batched(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    index_t batch_size) {
+  if (_stridea < 0) {
+    throw std::invalid_argument("invalid _stridea");
+  } else if (_strideb < 0) {
+    throw std::invalid_argument("invalid _strideb");
+  } else if (batch_size > 1 && _stridec <= 0) {
+    // The products of the batch would all be written to the same C
+    throw std::invalid_argument("invalid _stridec");
+  }
+  return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda,
+                       _stridea, b_, _ldb, _strideb, _beta, _C, _ldc, _stridec,
+                       batch_size, gemm_batch_type_t::strided);
+}
+
+/*!
+ * @brief Launches the GemmGrouped kernel computing the group of problems
+ * described in desc, its blocks being computed by the local memory Gemm when
+ * the device has local memory, by the no local memory one otherwise.
+ */
+template <bool trans_a, bool trans_b, bool is_beta_zero, typename tile_t,
+          typename executor_t, typename input_t, typename output_t,
+          typename desc_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped_launch(
+    executor_t& ex, input_t a, input_t b, output_t c, desc_t desc,
+    element_t _alpha, element_t _beta, index_t group_count,
+    index_t num_work_groups) {
+  constexpr int strided = static_cast<int>(gemm_batch_type_t::strided);
+  constexpr index_t wg_size = tile_t::wg_rows * tile_t::wg_cols;
+  if (ex.get_policy_handler().has_local_memory()) {
+    auto gemm = make_gemm<false, false, false, 64, tile_t, trans_a, trans_b,
+                          static_cast<int>(gemm_memory_t::local),
+                          static_cast<int>(gemm_algorithm_t::standard),
+                          static_cast<int>(gemm_vectorization_t::full),
+                          is_beta_zero, 4, strided>(
+        a, b, c, _alpha, _beta, index_t(1), index_t(0), index_t(0),
+        index_t(0));
+    auto grouped = make_gemm_grouped(gemm, desc, group_count, num_work_groups);
+    constexpr index_t local_memory_size =
+        decltype(grouped)::local_memory_size;
+    return ex.execute(grouped, wg_size, num_work_groups * wg_size,
+                      local_memory_size);
+  } else {
+    auto gemm = make_gemm<false, false, false, 64, tile_t, trans_a, trans_b,
+                          static_cast<int>(gemm_memory_t::no_local),
+                          static_cast<int>(gemm_algorithm_t::standard),
+                          static_cast<int>(gemm_vectorization_t::full),
+                          is_beta_zero, 4, strided>(
+        a, b, c, _alpha, _beta, index_t(1), index_t(0), index_t(0),
+        index_t(0));
+    auto grouped = make_gemm_grouped(gemm, desc, group_count, num_work_groups);
+    return ex.execute(grouped, wg_size, num_work_groups * wg_size);
+  }
+}
+
+template <bool trans_a, bool trans_b, typename tile_t, typename executor_t,
+          typename input_t, typename output_t, typename desc_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped_is_beta_zero(
+    executor_t& ex, input_t a, input_t b, output_t c, desc_t desc,
+    element_t _alpha, element_t _beta, index_t group_count,
+    index_t num_work_groups) {
+  return is_scalar_zero(_beta)
+             ? _gemm_grouped_launch<trans_a, trans_b, true, tile_t>(
+                   ex, a, b, c, desc, _alpha, _beta, group_count,
+                   num_work_groups)
+             : _gemm_grouped_launch<trans_a, trans_b, false, tile_t>(
+                   ex, a, b, c, desc, _alpha, _beta, group_count,
+                   num_work_groups);
+}
+
+/*!
+ * @brief Grouped GEMM. The sizes, leading dimensions and offsets of the
+ * problems, along with the first work group of each, are copied to a device
+ * buffer from the scratch pool, so that a single kernel computes the whole
+ * group whatever the sizes of its problems.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped(
+    executor_t& ex, char _TransA, char _TransB, const std::vector<index_t>& _M,
+    const std::vector<index_t>& _N, const std::vector<index_t>& _K,
+    element_t _alpha, container_0_t a_, const std::vector<index_t>& _lda,
+    const std::vector<index_t>& _offseta, container_1_t b_,
+    const std::vector<index_t>& _ldb, const std::vector<index_t>& _offsetb,
+    element_t _beta, container_2_t _C, const std::vector<index_t>& _ldc,
+    const std::vector<index_t>& _offsetc) {
+  using tile_t = Tile<4, 4, 8, 8>;
+  using view_t =
+      decltype(make_matrix_view<col_major>(ex, a_, index_t(1), index_t(1),
+                                           index_t(1)));
+  using vector_t = decltype(make_vector_view(ex, a_, index_t(1), index_t(1)));
+  // The fields and the blocks of the problems do not depend on the Gemm
+  using problem_t = GemmGrouped<
+      Gemm<view_t, view_t, false, false, false, 64, tile_t, false, false,
+           element_t, false, static_cast<int>(gemm_memory_t::no_local),
+           static_cast<int>(gemm_algorithm_t::standard),
+           static_cast<int>(gemm_vectorization_t::full), 4,
+           static_cast<int>(gemm_batch_type_t::strided)>,
+      vector_t>;
+  constexpr index_t num_fields = problem_t::num_problem_fields;
+  typename executor_t::policy_t::event_t events;
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  const index_t group_count = static_cast<index_t>(_M.size());
+  const auto is_group_size = [=](const std::vector<index_t>& v) {
+    return static_cast<index_t>(v.size()) == group_count;
+  };
+  if (!is_group_size(_N) || !is_group_size(_K) || !is_group_size(_lda) ||
+      !is_group_size(_ldb) || !is_group_size(_ldc) ||
+      !is_group_size(_offseta) || !is_group_size(_offsetb) ||
+      !is_group_size(_offsetc)) {
+    throw std::invalid_argument("invalid group size");
+  }
+
+  // The first part of the description holds the first work group of every
+  // problem, the second one their sizes, leading dimensions and offsets
+  // It is shared with the policy handler, which keeps it alive until the
+  // asynchronous copy to the device has read it
+  auto desc_ptr = std::make_shared<std::vector<index_t>>(
+      group_count + 1 + group_count * num_fields);
+  std::vector<index_t>& desc = *desc_ptr;
+  index_t size_a = 0;
+  index_t size_b = 0;
+  index_t size_c = 0;
+  index_t num_work_groups = 0;
+  for (index_t p = 0; p < group_count; ++p) {
+    const index_t rows_a = (_TransA == 'n') ? _M[p] : _K[p];
+    const index_t cols_a = (_TransA == 'n') ? _K[p] : _M[p];
+    const index_t rows_b = (_TransB == 'n') ? _K[p] : _N[p];
+    const index_t cols_b = (_TransB == 'n') ? _N[p] : _K[p];
+    if (_M[p] < 0 || _N[p] < 0 || _K[p] < 0) {
+      throw std::invalid_argument("invalid problem size");
+    } else if (_lda[p] < std::max<index_t>(1, rows_a)) {
+      throw std::invalid_argument("invalid _lda");
+    } else if (_ldb[p] < std::max<index_t>(1, rows_b)) {
+      throw std::invalid_argument("invalid _ldb");
+    } else if (_ldc[p] < std::max<index_t>(1, _M[p])) {
+      throw std::invalid_argument("invalid _ldc");
+    } else if (_offseta[p] < 0 || _offsetb[p] < 0 || _offsetc[p] < 0) {
+      throw std::invalid_argument("invalid offset");
+    }
+    desc[p] = num_work_groups;
+    if (_M[p] == 0 || _N[p] == 0) {
+      continue;
+    }
+    num_work_groups += problem_t::get_num_work_groups(_M[p], _N[p]);
+    if (_K[p] > 0) {
+      size_a = std::max(size_a, _offseta[p] + _lda[p] * (cols_a - 1) + rows_a);
+      size_b = std::max(size_b, _offsetb[p] + _ldb[p] * (cols_b - 1) + rows_b);
+    }
+    size_c = std::max(size_c, _offsetc[p] + _ldc[p] * (_N[p] - 1) + _M[p]);
+    index_t* fields = desc.data() + group_count + 1 + p * num_fields;
+    fields[problem_t::field_m] = _M[p];
+    fields[problem_t::field_n] = _N[p];
+    fields[problem_t::field_k] = _K[p];
+    fields[problem_t::field_lda] = _lda[p];
+    fields[problem_t::field_ldb] = _ldb[p];
+    fields[problem_t::field_ldc] = _ldc[p];
+    fields[problem_t::field_offset_a] = _offseta[p];
+    fields[problem_t::field_offset_b] = _offsetb[p];
+    fields[problem_t::field_offset_c] = _offsetc[p];
+  }
+  desc[group_count] = num_work_groups;
+  if (num_work_groups == 0) {
+    return events;
+  } else if (_alpha == element_t{0}) {
+    // Gemm scales C by beta / alpha, only beta is applied to each C_p instead
+    for (index_t p = 0; p < group_count; ++p) {
+      if (_M[p] > 0 && _N[p] > 0) {
+        append_vector(
+            events,
+            _gemm_backend(ex, _TransA, _TransB, _M[p], _N[p], _K[p], _alpha,
+                          a_ + _offseta[p], _lda[p], index_t(0),
+                          b_ + _offsetb[p], _ldb[p], index_t(0), _beta,
+                          _C + _offsetc[p], _ldc[p], _ldc[p] * _N[p],
+                          index_t(1), gemm_batch_type_t::strided));
+      }
+    }
+    return events;
+  }
+
+  auto policy_handler = ex.get_policy_handler();
+  auto desc_buffer =
+      policy_handler.template acquire_scratch<index_t>(desc.size());
+  auto copy_event = policy_handler.copy_to_device(
+      desc.data(), desc_buffer.get_iterator(), desc.size());
+  policy_handler.keep_alive(desc_ptr, copy_event);
+
+  // The Gemm views the whole buffers as single columns, the problems giving
+  // their own sizes. Views of zero elements are given one element as A or B
+  // are not read when every K is zero
+  size_a = std::max<index_t>(1, size_a);
+  size_b = std::max<index_t>(1, size_b);
+  auto a = make_matrix_view<col_major>(ex, a_, size_a, index_t(1), size_a);
+  auto b = make_matrix_view<col_major>(ex, b_, size_b, index_t(1), size_b);
+  auto c = make_matrix_view<col_major>(ex, _C, size_c, index_t(1), size_c);
+  auto d = make_vector_view(ex, desc_buffer.get_iterator(), index_t(1),
+                            static_cast<index_t>(desc.size()));
+  if (_TransA == 'n' && _TransB == 'n') {
+    events = _gemm_grouped_is_beta_zero<false, false, tile_t>(
+        ex, a, b, c, d, _alpha, _beta, group_count, num_work_groups);
+  } else if (_TransA == 'n') {
+    events = _gemm_grouped_is_beta_zero<false, true, tile_t>(
+        ex, a, b, c, d, _alpha, _beta, group_count, num_work_groups);
+  } else if (_TransB == 'n') {
+    events = _gemm_grouped_is_beta_zero<true, false, tile_t>(
+        ex, a, b, c, d, _alpha, _beta, group_count, num_work_groups);
+  } else {
+    events = _gemm_grouped_is_beta_zero<true, true, tile_t>(
+        ex, a, b, c, d, _alpha, _beta, group_count, num_work_groups);
+  }
+  policy_handler.release_scratch(desc_buffer, events);
+  return events;
+}
+
+/*!
+ * @brief Launches the GemmStreamK kernel and, when it splits blocks of C
+ * between work groups, the GemmStreamKFixup kernel completing them. The
+ * blocks are computed by the local memory Gemm when the device has local
+ * memory, by the no local memory one otherwise.
+ */
+template <bool trans_a, bool trans_b, bool is_beta_zero, typename tile_t,
+          typename executor_t, typename input_t, typename output_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_stream_k_launch(
+    executor_t& ex, input_t a, input_t b, output_t c, output_t workspace,
+    element_t _alpha, element_t _beta, index_t _M, index_t _N, index_t _K,
+    index_t _lda, index_t _ldb, index_t _ldc, index_t share,
+    index_t num_work_groups) {
+  constexpr int strided = static_cast<int>(gemm_batch_type_t::strided);
+  constexpr index_t wg_size = tile_t::wg_rows * tile_t::wg_cols;
+  typename executor_t::policy_t::event_t events;
+  // The partial sums are stored as they are, the fixup applying alpha and
+  // beta
+  if (ex.get_policy_handler().has_local_memory()) {
+    constexpr int local = static_cast<int>(gemm_memory_t::local);
+    auto gemm = make_gemm<false, false, false, 64, tile_t, trans_a, trans_b,
+                          local, static_cast<int>(gemm_algorithm_t::standard),
+                          static_cast<int>(gemm_vectorization_t::full),
+                          is_beta_zero, 4, strided>(
+        a, b, c, _alpha, _beta, index_t(1), index_t(0), index_t(0),
+        index_t(0));
+    auto partial_gemm =
+        make_gemm<false, false, false, 64, tile_t, trans_a, trans_b, local,
+                  static_cast<int>(gemm_algorithm_t::standard),
+                  static_cast<int>(gemm_vectorization_t::full), true, 4,
+                  strided>(a, b, workspace, element_t{1}, element_t{0},
+                           index_t(1), index_t(0), index_t(0), index_t(0));
+    auto stream_k = make_gemm_stream_k(gemm, partial_gemm, _M, _N, _K, _lda,
+                                       _ldb, _ldc, share, num_work_groups);
+    constexpr index_t local_memory_size =
+        decltype(stream_k)::local_memory_size;
+    events = ex.execute(stream_k, wg_size, num_work_groups * wg_size,
+                        local_memory_size);
+  } else {
+    constexpr int no_local = static_cast<int>(gemm_memory_t::no_local);
+    auto gemm = make_gemm<false, false, false, 64, tile_t, trans_a, trans_b,
+                          no_local,
+                          static_cast<int>(gemm_algorithm_t::standard),
+                          static_cast<int>(gemm_vectorization_t::full),
+                          is_beta_zero, 4, strided>(
+        a, b, c, _alpha, _beta, index_t(1), index_t(0), index_t(0),
+        index_t(0));
+    auto partial_gemm =
+        make_gemm<false, false, false, 64, tile_t, trans_a, trans_b, no_local,
+                  static_cast<int>(gemm_algorithm_t::standard),
+                  static_cast<int>(gemm_vectorization_t::full), true, 4,
+                  strided>(a, b, workspace, element_t{1}, element_t{0},
+                           index_t(1), index_t(0), index_t(0), index_t(0));
+    auto stream_k = make_gemm_stream_k(gemm, partial_gemm, _M, _N, _K, _lda,
+                                       _ldb, _ldc, share, num_work_groups);
+    events = ex.execute(stream_k, wg_size, num_work_groups * wg_size);
+  }
+  // Work groups only start inside a block when the share is not a multiple
+  // of K
+  if (share % _K != 0) {
+    auto fixup = make_gemm_stream_k_fixup<is_beta_zero, tile_t>(
+        c, workspace, _alpha, _beta, _M, _N, _K, _ldc, share);
+    events = concatenate_vectors(events, ex.execute(fixup));
+  }
+  return events;
+}
+
+template <bool trans_a, bool trans_b, typename tile_t, typename executor_t,
+          typename input_t, typename output_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_stream_k_is_beta_zero(
+    executor_t& ex, input_t a, input_t b, output_t c, output_t workspace,
+    element_t _alpha, element_t _beta, index_t _M, index_t _N, index_t _K,
+    index_t _lda, index_t _ldb, index_t _ldc, index_t share,
+    index_t num_work_groups) {
+  return (_beta == element_t{0})
+             ? _gemm_stream_k_launch<trans_a, trans_b, true, tile_t>(
+                   ex, a, b, c, workspace, _alpha, _beta, _M, _N, _K, _lda,
+                   _ldb, _ldc, share, num_work_groups)
+             : _gemm_stream_k_launch<trans_a, trans_b, false, tile_t>(
+                   ex, a, b, c, workspace, _alpha, _beta, _M, _N, _K, _lda,
+                   _ldb, _ldc, share, num_work_groups);
+}
+
+/*!
+ * @brief GEMM with stream-K scheduling. A number of work groups which can all
+ * be resident on the device at once share the multiply-accumulate iterations
+ * of the GEMM evenly, so the last blocks of C do not run in a partial wave
+ * occupying only a few compute units.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_stream_k(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  using tile_t = Tile<4, 4, 8, 8>;
+  using view_t =
+      decltype(make_matrix_view<col_major>(ex, a_, index_t(1), index_t(1),
+                                           index_t(1)));
+  // The blocks do not depend on the Gemm
+  using block_gemm_t =
+      Gemm<view_t, view_t, false, false, false, 64, tile_t, false, false,
+           element_t, false, static_cast<int>(gemm_memory_t::no_local),
+           static_cast<int>(gemm_algorithm_t::standard),
+           static_cast<int>(gemm_vectorization_t::full), 4,
+           static_cast<int>(gemm_batch_type_t::strided)>;
+  using gemm_t = GemmStreamK<block_gemm_t, block_gemm_t>;
+  typename executor_t::policy_t::event_t events;
+  if (_M == 0 || _N == 0) {
+    return events;
+  } else if (_K == 0 || _alpha == element_t{0}) {
+    // Only beta is applied to C, as done by the other GEMM kernels
+    return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda,
+                         get_implicit_stride_a(_TransA, _M, _K, _lda), b_,
+                         _ldb, get_implicit_stride_b(_TransB, _K, _N, _ldb),
+                         _beta, _C, _ldc, _ldc * _N, index_t(1),
+                         gemm_batch_type_t::strided);
+  }
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  const bool trans_a = _TransA != 'n';
+  const bool trans_b = _TransB != 'n';
+
+  // Each compute unit is given 4 work groups. A work group gets at least K
+  // iterations, so that a block is shared by two work groups at most: GEMMs
+  // with fewer blocks than work groups are better split along K.
+  auto policy_handler = ex.get_policy_handler();
+  const index_t total_iters = gemm_t::get_num_blocks(_M, _N) * _K;
+  const index_t max_work_groups =
+      4 * static_cast<index_t>(policy_handler.get_num_compute_units());
+  index_t share = (total_iters + max_work_groups - 1) / max_work_groups;
+  share = std::max(share, _K);
+  const index_t num_work_groups = (total_iters + share - 1) / share;
+
+  const index_t size_w = static_cast<index_t>(
+      2 * num_work_groups * gemm_t::block_rows * gemm_t::block_cols);
+  auto workspace = policy_handler.template acquire_scratch<element_t>(size_w);
+  // The Gemms view the whole buffers as single columns, each range of
+  // iterations giving its own sizes and offsets
+  const index_t size_a =
+      _lda * ((trans_a ? _M : _K) - 1) + (trans_a ? _K : _M);
+  const index_t size_b =
+      _ldb * ((trans_b ? _K : _N) - 1) + (trans_b ? _N : _K);
+  const index_t size_c = _ldc * (_N - 1) + _M;
+  auto a = make_matrix_view<col_major>(ex, a_, size_a, index_t(1), size_a);
+  auto b = make_matrix_view<col_major>(ex, b_, size_b, index_t(1), size_b);
+  auto c = make_matrix_view<col_major>(ex, _C, size_c, index_t(1), size_c);
+  auto w = make_matrix_view<col_major>(ex, workspace.get_iterator(), size_w,
+                                       index_t(1), size_w);
+  if (!trans_a && !trans_b) {
+    events = _gemm_stream_k_is_beta_zero<false, false, tile_t>(
+        ex, a, b, c, w, _alpha, _beta, _M, _N, _K, _lda, _ldb, _ldc, share,
+        num_work_groups);
+  } else if (!trans_a) {
+    events = _gemm_stream_k_is_beta_zero<false, true, tile_t>(
+        ex, a, b, c, w, _alpha, _beta, _M, _N, _K, _lda, _ldb, _ldc, share,
+        num_work_groups);
+  } else if (!trans_b) {
+    events = _gemm_stream_k_is_beta_zero<true, false, tile_t>(
+        ex, a, b, c, w, _alpha, _beta, _M, _N, _K, _lda, _ldb, _ldc, share,
+        num_work_groups);
+  } else {
+    events = _gemm_stream_k_is_beta_zero<true, true, tile_t>(
+        ex, a, b, c, w, _alpha, _beta, _M, _N, _K, _lda, _ldb, _ldc, share,
+        num_work_groups);
+  }
+  policy_handler.release_scratch(workspace, events);
+  return events;
+}
+
+/*!
+ * @brief Launches the GEMM of _gemm_ex and _gemm_scaled with its epilogue and
+ * prologue, with the configuration of the backend which takes them, see
+ * ex_launcher_t. When alpha is zero, or K is, the naive kernel only applies
+ * beta and the epilogue to C, without reading A and B.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename epilogue_t, typename prologue_t>
+typename executor_t::policy_t::event_t _gemm_ex_launch(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc, epilogue_t epilogue,
+    prologue_t prologue) {
+  constexpr int strided = static_cast<int>(gemm_batch_type_t::strided);
+  auto buffer_c = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  if (_K == 0 || _alpha == element_t{0}) {
+    auto buffer_a = make_matrix_view<col_major>(ex, a_, _M, index_t(0), _lda);
+    auto buffer_b = make_matrix_view<col_major>(ex, b_, index_t(0), _N, _ldb);
+    auto gemm = make_gemm<false, false, false, 64, Tile<8, 8, 8, 8>, _t_a,
+                          _t_b, static_cast<int>(gemm_memory_t::no_local),
+                          static_cast<int>(gemm_algorithm_t::naive),
+                          static_cast<int>(gemm_vectorization_t::none),
+                          is_beta_zero, 1, strided>(
+        buffer_a, buffer_b, buffer_c, _alpha, _beta, index_t(1), index_t(0),
+        index_t(0), index_t(0), epilogue, prologue);
+    return ex.execute(gemm);
+  }
+  return blas::gemm::backend::ex_launcher_t<_t_a, _t_b, is_beta_zero>::
+      template _select_gemm(ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                            _C, _ldc, epilogue, prologue);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename epilogue_t, typename prologue_t>
+typename executor_t::policy_t::event_t _gemm_ex_trans(
+    executor_t& ex, bool trans_a, bool trans_b, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, epilogue_t epilogue, prologue_t prologue) {
+  const bool beta_zero = _beta == element_t{0};
+  if (!trans_a && !trans_b) {
+    return beta_zero ? _gemm_ex_launch<false, false, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue)
+                     : _gemm_ex_launch<false, false, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue);
+  } else if (!trans_a) {
+    return beta_zero ? _gemm_ex_launch<false, true, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue)
+                     : _gemm_ex_launch<false, true, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue);
+  } else if (!trans_b) {
+    return beta_zero ? _gemm_ex_launch<true, false, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue)
+                     : _gemm_ex_launch<true, false, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue);
+  } else {
+    return beta_zero ? _gemm_ex_launch<true, true, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue)
+                     : _gemm_ex_launch<true, true, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc, epilogue, prologue);
+  }
+}
+
+/*!
+ * @brief GEMM with a fused epilogue: a bias broadcast along the rows or the
+ * columns of C is added and an activation is applied, in the registers of the
+ * GEMM kernel, instead of by two more kernels reading and writing C.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_ex(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, gemm_bias_t bias_type, container_3_t bias,
+    gemm_activation_t activation) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  typename executor_t::policy_t::event_t events;
+  if (_M == 0 || _N == 0) {
+    return events;
+  }
+  const bool trans_a = _TransA != 'n';
+  const bool trans_b = _TransB != 'n';
+  const index_t bias_size = (bias_type == gemm_bias_t::row)
+                                ? _M
+                                : (bias_type == gemm_bias_t::column)
+                                      ? _N
+                                      : index_t(1);
+  auto bias_view = make_vector_view(ex, bias, index_t(1), bias_size);
+  if (activation == gemm_activation_t::relu) {
+    return _gemm_ex_trans(
+        ex, trans_a, trans_b, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+        _C, _ldc, make_gemm_epilogue<ReluOperator>(bias_view, bias_type),
+        GemmNoPrologue());
+  } else if (activation == gemm_activation_t::gelu) {
+    return _gemm_ex_trans(
+        ex, trans_a, trans_b, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+        _C, _ldc, make_gemm_epilogue<GeluOperator>(bias_view, bias_type),
+        GemmNoPrologue());
+  } else {
+    return _gemm_ex_trans(
+        ex, trans_a, trans_b, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+        _C, _ldc, make_gemm_epilogue<IdentityOperator>(bias_view, bias_type),
+        GemmNoPrologue());
+  }
+}
+
+/*!
+ * @brief GEMM of operands scaled along their rows or columns. The scales are
+ * applied by the GEMM kernel as A and B are loaded, so the scaled operands are
+ * never written to memory.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_scaled(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    gemm_scale_t scale_a_type, container_3_t scale_a, container_1_t b_,
+    index_t _ldb, gemm_scale_t scale_b_type, container_3_t scale_b,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  typename executor_t::policy_t::event_t events;
+  if (_M == 0 || _N == 0) {
+    return events;
+  }
+  const index_t scale_a_size = (scale_a_type == gemm_scale_t::row)
+                                   ? _M
+                                   : (scale_a_type == gemm_scale_t::column)
+                                         ? _K
+                                         : index_t(1);
+  const index_t scale_b_size = (scale_b_type == gemm_scale_t::row)
+                                   ? _K
+                                   : (scale_b_type == gemm_scale_t::column)
+                                         ? _N
+                                         : index_t(1);
+  auto scale_a_view = make_vector_view(ex, scale_a, index_t(1), scale_a_size);
+  auto scale_b_view = make_vector_view(ex, scale_b, index_t(1), scale_b_size);
+  return _gemm_ex_trans(
+      ex, _TransA != 'n', _TransB != 'n', _M, _N, _K, _alpha, a_, _lda, b_,
+      _ldb, _beta, _C, _ldc, GemmNoEpilogue(),
+      make_gemm_prologue<IdentityOperator>(scale_a_view, scale_a_type,
+                                           scale_b_view, scale_b_type));
+}
+
+/*!
+ * @brief GEMM with alpha and beta read from device memory.
+ *
+ * The GEMM kernel computes op(A) * op(B) and its GemmDeviceScalars epilogue
+ * applies alpha and beta to each element of C before it is stored, comparing
+ * beta with zero in the kernel so that C is not read when it is zero.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename policy_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, BufferIterator<element_t, policy_t> _alpha, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb,
+    BufferIterator<element_t, policy_t> _beta, container_2_t _C,
+    index_t _ldc) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  typename executor_t::policy_t::event_t events;
+  if (_M == 0 || _N == 0) {
+    return events;
+  }
+  auto mC = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  return _gemm_ex_trans(
+      ex, _TransA != 'n', _TransB != 'n', _M, _N, _K, element_t{1}, a_, _lda,
+      b_, _ldb, element_t{0}, _C, _ldc,
+      make_gemm_device_scalars(make_scalar_operand(ex, _alpha),
+                               make_scalar_operand(ex, _beta), mC),
+      GemmNoPrologue());
+}
+
+/*!
+ * @brief Launches the GEMM of _gemm_mixed with the configuration the backend
+ * compiles for operands stored in a narrower type than the accumulator.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_mixed_launch(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  constexpr int strided = static_cast<int>(gemm_batch_type_t::strided);
+  if (_K == 0 || _alpha == element_t{0}) {
+    // The tiled kernels keep beta / alpha in their registers, so C = beta * C
+    // is computed by the naive kernel, which does not read A and B
+    auto buffer_a = make_matrix_view<col_major>(ex, a_, _M, index_t(0), _lda);
+    auto buffer_b = make_matrix_view<col_major>(ex, b_, index_t(0), _N, _ldb);
+    auto buffer_c = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+    auto gemm = make_gemm<false, false, false, 64, Tile<8, 8, 8, 8>, _t_a,
+                          _t_b, static_cast<int>(gemm_memory_t::no_local),
+                          static_cast<int>(gemm_algorithm_t::naive),
+                          static_cast<int>(gemm_vectorization_t::none),
+                          is_beta_zero, 1, strided>(
+        buffer_a, buffer_b, buffer_c, _alpha, _beta, index_t(1), index_t(0),
+        index_t(0), index_t(0));
+    return ex.execute(gemm);
+  }
+  return blas::gemm::backend::mixed_launcher_t<_t_a, _t_b, is_beta_zero>::
+      template _select_gemm(ex, _M, _N, _K, _alpha, a_, _lda,
+                            _lda * (_t_a ? _M : _K), b_, _ldb,
+                            _ldb * (_t_b ? _K : _N), _beta, _C, _ldc,
+                            _ldc * _N, index_t(1));
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_mixed(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  typename executor_t::policy_t::event_t events;
+  if (_M == 0 || _N == 0) {
+    return events;
+  }
+  const bool trans_a = _TransA != 'n';
+  const bool trans_b = _TransB != 'n';
+  const bool beta_zero = _beta == element_t{0};
+  if (!trans_a && !trans_b) {
+    return beta_zero ? _gemm_mixed_launch<false, false, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc)
+                     : _gemm_mixed_launch<false, false, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc);
+  } else if (!trans_a) {
+    return beta_zero ? _gemm_mixed_launch<false, true, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc)
+                     : _gemm_mixed_launch<false, true, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc);
+  } else if (!trans_b) {
+    return beta_zero ? _gemm_mixed_launch<true, false, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc)
+                     : _gemm_mixed_launch<true, false, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc);
+  } else {
+    return beta_zero ? _gemm_mixed_launch<true, true, true>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc)
+                     : _gemm_mixed_launch<true, true, false>(
+                           ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                           _C, _ldc);
+  }
+}
+
+/*!
+ * @brief GEMM of int8 operands accumulated in int32, whose results are
+ * requantized by the epilogue of the GEMM kernel as they are stored. Like
+ * _gemm_ex, it runs the local or the no local memory kernel depending on the
+ * device.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_s8(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    container_2_t _C, index_t _ldc, gemm_quantization_t quantization_type,
+    container_3_t scale, container_4_t zero_point) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  typename executor_t::policy_t::event_t events;
+  if (_M == 0 || _N == 0) {
+    return events;
+  }
+  using output_value_t = typename container_2_t::scalar_t;
+  const index_t channels =
+      (quantization_type == gemm_quantization_t::per_row)
+          ? _M
+          : (quantization_type == gemm_quantization_t::per_column)
+                ? _N
+                : index_t(1);
+  auto scale_view = make_vector_view(ex, scale, index_t(1), channels);
+  auto zero_point_view = make_vector_view(ex, zero_point, index_t(1), channels);
+  return _gemm_ex_trans(
+      ex, _TransA != 'n', _TransB != 'n', _M, _N, _K, int32_t(1), a_, _lda, b_,
+      _ldb, int32_t(0), _C, _ldc,
+      make_gemm_requantize<output_value_t>(scale_view, zero_point_view,
+                                           quantization_type),
+      GemmNoPrologue());
 }
 
 }  // namespace internal
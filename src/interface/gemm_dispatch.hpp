@@ -0,0 +1,240 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_dispatch.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GEMM_DISPATCH_HPP
+#define SYCL_BLAS_BLAS3_GEMM_DISPATCH_HPP
+
+#include "interface/gemm_dispatch_table.h"
+#include "interface/gemm_launcher.h"
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace blas {
+namespace gemm {
+
+/*!
+ * @brief Strided GEMM configuration which a GemmDispatchTable can select by
+ * name. The template parameters are the ones of Gemm_Launcher, which must be
+ * instantiated for the configuration (see add_gemm_configuration in
+ * cmake/CmakeFunctionHelper.cmake).
+ */
+template <int WgSize, bool DoubleBuffer, bool ConflictA, bool ConflictB,
+          int ClSize, typename TileT, int GemmMemoryType, int GemmAlgorithm,
+          int GemmVectorization, int VectorSize>
+struct DispatchConfig {
+  static const std::string& get_name() {
+    static const std::string name = get_gemm_config_name(
+        static_cast<gemm_memory_t>(GemmMemoryType),
+        static_cast<gemm_algorithm_t>(GemmAlgorithm),
+        static_cast<gemm_vectorization_t>(GemmVectorization), VectorSize,
+        ClSize, DoubleBuffer, ConflictA, ConflictB, TileT::item_rows,
+        TileT::item_cols, TileT::wg_rows, TileT::wg_cols);
+    return name;
+  }
+
+  /*!
+   * @brief Runs the GEMM and returns true if name is the name of this
+   * configuration. The tall and skinny configurations are not batched.
+   */
+  template <bool TransA, bool TransB, bool is_beta_zero, typename executor_t,
+            typename container_0_t, typename container_1_t,
+            typename container_2_t, typename element_t, typename index_t>
+  static bool launch(const std::string& name,
+                     typename executor_t::policy_t::event_t& events,
+                     executor_t& ex, index_t _M, index_t _N, index_t _K,
+                     element_t _alpha, container_0_t _a, index_t _lda,
+                     index_t _stridea, container_1_t _b, index_t _ldb,
+                     index_t _strideb, element_t _beta, container_2_t _c,
+                     index_t _ldc, index_t _stridec, index_t batch_size) {
+    if (name != get_name() ||
+        (static_cast<gemm_algorithm_t>(GemmAlgorithm) ==
+             gemm_algorithm_t::tall_skinny &&
+         batch_size != 1)) {
+      return false;
+    }
+    events = Gemm_Launcher<
+        WgSize, DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA,
+        TransB, GemmMemoryType, GemmAlgorithm, GemmVectorization, is_beta_zero,
+        VectorSize, static_cast<int>(gemm_batch_type_t::strided)>::
+        template _select_gemm(ex, _M, _N, _K, _alpha, _a, _lda, _stridea, _b,
+                              _ldb, _strideb, _beta, _c, _ldc, _stridec,
+                              batch_size);
+    return true;
+  }
+};
+
+/*!
+ * @brief The DispatchConfig a backend can select at runtime.
+ */
+template <typename... config_t>
+struct DispatchConfigList;
+
+template <>
+struct DispatchConfigList<> {
+  static void get_names(std::vector<std::string>&) {}
+
+  template <bool TransA, bool TransB, bool is_beta_zero, typename executor_t,
+            typename container_0_t, typename container_1_t,
+            typename container_2_t, typename element_t, typename index_t>
+  static bool launch(const std::string&,
+                     typename executor_t::policy_t::event_t&, executor_t&,
+                     index_t, index_t, index_t, element_t, container_0_t,
+                     index_t, index_t, container_1_t, index_t, index_t,
+                     element_t, container_2_t, index_t, index_t, index_t) {
+    return false;
+  }
+};
+
+template <typename first_t, typename... rest_t>
+struct DispatchConfigList<first_t, rest_t...> {
+  /*!
+   * @brief Appends the names of the configurations to names.
+   */
+  static void get_names(std::vector<std::string>& names) {
+    names.push_back(first_t::get_name());
+    DispatchConfigList<rest_t...>::get_names(names);
+  }
+
+  /*!
+   * @brief Runs the GEMM with the configuration called name. Returns false
+   * if there is no such configuration.
+   */
+  template <bool TransA, bool TransB, bool is_beta_zero, typename executor_t,
+            typename container_0_t, typename container_1_t,
+            typename container_2_t, typename element_t, typename index_t>
+  static bool launch(const std::string& name,
+                     typename executor_t::policy_t::event_t& events,
+                     executor_t& ex, index_t _M, index_t _N, index_t _K,
+                     element_t _alpha, container_0_t _a, index_t _lda,
+                     index_t _stridea, container_1_t _b, index_t _ldb,
+                     index_t _strideb, element_t _beta, container_2_t _c,
+                     index_t _ldc, index_t _stridec, index_t batch_size) {
+    return first_t::template launch<TransA, TransB, is_beta_zero>(
+               name, events, ex, _M, _N, _K, _alpha, _a, _lda, _stridea, _b,
+               _ldb, _strideb, _beta, _c, _ldc, _stridec, batch_size) ||
+           DispatchConfigList<rest_t...>::template launch<TransA, TransB,
+                                                          is_beta_zero>(
+               name, events, ex, _M, _N, _K, _alpha, _a, _lda, _stridea, _b,
+               _ldb, _strideb, _beta, _c, _ldc, _stridec, batch_size);
+  }
+};
+
+/*!
+ * @brief Times the configurations of configs_t on temporary operands of the
+ * shape of a GEMM and returns the name of the fastest one.
+ *
+ * The configurations run on a queue of their own, so that the kernels
+ * submitted meanwhile to the queue of the GEMM do not wait for them nor
+ * count in their times. The operands are zeroed, the GEMMs then keep C at
+ * zero.
+ */
+template <typename configs_t, bool TransA, bool TransB, bool is_beta_zero,
+          typename element_t, typename executor_t, typename index_t>
+std::string tune_online(executor_t ex, index_t _M, index_t _N, index_t _K,
+                        element_t _alpha, index_t _lda, index_t _ldb,
+                        element_t _beta, index_t _ldc, index_t batch_size) {
+  constexpr int repetitions = 4;
+  executor_t tuning_ex(executor_t::policy_t::make_side_queue(
+      ex.get_policy_handler().get_queue()));
+  auto policy_handler = tuning_ex.get_policy_handler();
+  const index_t stride_a = _lda * (TransA ? _M : _K);
+  const index_t stride_b = _ldb * (TransB ? _K : _N);
+  const index_t stride_c = _ldc * _N;
+  auto a = policy_handler.template acquire_zeroed_scratch<element_t>(
+      stride_a * batch_size);
+  auto b = policy_handler.template acquire_zeroed_scratch<element_t>(
+      stride_b * batch_size);
+  auto c = policy_handler.template acquire_zeroed_scratch<element_t>(
+      stride_c * batch_size);
+  std::vector<std::string> names;
+  configs_t::get_names(names);
+  std::string best_name;
+  double best_time = std::numeric_limits<double>::max();
+  typename executor_t::policy_t::event_t events;
+  for (const auto& name : names) {
+    auto run = [&]() {
+      return configs_t::template launch<TransA, TransB, is_beta_zero>(
+          name, events, tuning_ex, _M, _N, _K, _alpha, a.get_iterator(), _lda,
+          stride_a, b.get_iterator(), _ldb, stride_b, _beta, c.get_iterator(),
+          _ldc, stride_c, batch_size);
+    };
+    // The first run also builds the kernels
+    if (!run()) {
+      continue;
+    }
+    policy_handler.wait(events);
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+      run();
+      policy_handler.wait(events);
+    }
+    const std::chrono::duration<double> time =
+        std::chrono::steady_clock::now() - start;
+    if (time.count() < best_time) {
+      best_time = time.count();
+      best_name = name;
+    }
+  }
+  policy_handler.release_scratch(a, events);
+  policy_handler.release_scratch(b, events);
+  policy_handler.release_scratch(c, events);
+  return best_name;
+}
+
+/*!
+ * @brief Returns the configuration the online tuner chose for the shape of a
+ * GEMM, or an empty string. A new shape is queued for timing.
+ */
+template <typename configs_t, bool TransA, bool TransB, bool is_beta_zero,
+          typename element_t, typename executor_t, typename index_t>
+std::string find_online_config(executor_t& ex, const std::string& device,
+                               index_t _M, index_t _N, index_t _K,
+                               element_t _alpha, index_t _lda, index_t _ldb,
+                               element_t _beta, index_t _ldc,
+                               index_t batch_size) {
+  auto& tuner = GemmOnlineTuner::get_default();
+  if (!tuner.is_active()) {
+    return "";
+  }
+  const std::string key =
+      GemmOnlineTuner::get_key(device, TransA, TransB, _M, _N, _K,
+                               batch_size, sizeof(element_t));
+  bool must_tune = false;
+  const std::string config = tuner.find(key, must_tune);
+  if (must_tune) {
+    tuner.submit(key, [=]() {
+      return tune_online<configs_t, TransA, TransB, is_beta_zero>(
+          ex, _M, _N, _K, _alpha, _lda, _ldb, _beta, _ldc, batch_size);
+    });
+  }
+  return config;
+}
+
+}  // namespace gemm
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMM_DISPATCH_HPP
@@ -39,6 +39,34 @@ template <int WgSize, bool DoubleBuffer, bool ConflictA, bool ConflictB,
           bool is_beta_zero, int VectorSize, int BatchType>
 template <typename Executor, typename container_t0, typename container_t1,
           typename container_t2, typename element_t, typename index_t>
+typename Executor::policy_t::event_t Gemm_Launcher<
+    WgSize, DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA, TransB,
+    GemmMemoryType, GemmAlgorithm, GemmVectorization, is_beta_zero, VectorSize,
+    BatchType>::_select_gemm(Executor& ex, index_t _M, index_t _N, index_t _K,
+                             element_t _alpha, container_t0 a_, index_t _lda,
+                             index_t _stridea, container_t1 b_, index_t _ldb,
+                             index_t _strideb, element_t _beta,
+                             container_t2 _C, index_t _ldc, index_t _stridec,
+                             index_t batch_size) {
+  auto buffer_a = make_matrix_view<col_major>(ex, a_, _M, _K, _lda);
+  auto buffer_b = make_matrix_view<col_major>(ex, b_, _K, _N, _ldb);
+  auto buffer_c = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+
+  auto gemm = make_gemm<DoubleBuffer, ConflictA, ConflictB, ClSize, TileT,
+                        TransA, TransB, GemmMemoryType, GemmAlgorithm,
+                        GemmVectorization, is_beta_zero, VectorSize, BatchType>(
+      buffer_a, buffer_b, buffer_c, element_t(_alpha), element_t(_beta),
+      batch_size, _stridea, _strideb, _stridec);
+  return ex.execute(gemm);
+}
+
+template <int WgSize, bool DoubleBuffer, bool ConflictA, bool ConflictB,
+          int ClSize, typename TileT, bool TransA, bool TransB,
+          int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
+          bool is_beta_zero, int VectorSize, int BatchType>
+template <typename Executor, typename container_t0, typename container_t1,
+          typename container_t2, typename element_t, typename index_t,
+          typename epilogue_t, typename prologue_t>
 typename Executor::policy_t::event_t Gemm_Launcher<
     WgSize, DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA, TransB,
     GemmMemoryType, GemmAlgorithm, GemmVectorization, is_beta_zero, VectorSize,
@@ -46,7 +74,7 @@ typename Executor::policy_t::event_t Gemm_Launcher<
                              element_t _alpha, container_t0 a_, index_t _lda,
                              container_t1 b_, index_t _ldb, element_t _beta,
                              container_t2 _C, index_t _ldc,
-                             index_t batch_size) {
+                             epilogue_t epilogue, prologue_t prologue) {
   auto buffer_a = make_matrix_view<col_major>(ex, a_, _M, _K, _lda);
   auto buffer_b = make_matrix_view<col_major>(ex, b_, _K, _N, _ldb);
   auto buffer_c = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
@@ -55,7 +83,7 @@ typename Executor::policy_t::event_t Gemm_Launcher<
                         TransA, TransB, GemmMemoryType, GemmAlgorithm,
                         GemmVectorization, is_beta_zero, VectorSize, BatchType>(
       buffer_a, buffer_b, buffer_c, element_t(_alpha), element_t(_beta),
-      batch_size);
+      index_t(1), index_t(0), index_t(0), index_t(0), epilogue, prologue);
   return ex.execute(gemm);
 }
 
@@ -46,6 +46,10 @@ struct DetectScalar {
   static typename element_t::value_t get_scalar(element_t &opSCL) {
     return opSCL.eval(0);
   }
+  static void bind(element_t &opSCL, cl::sycl::handler &h) { opSCL.bind(h); }
+  static void adjust_access_displacement(element_t &opSCL) {
+    opSCL.adjust_access_displacement();
+  }
 };
 
 /*! DetectScalar.
@@ -55,6 +59,8 @@ template <>
 struct DetectScalar<int> {
   using element_t = int;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -64,6 +70,8 @@ template <>
 struct DetectScalar<float> {
   using element_t = float;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -73,6 +81,8 @@ template <>
 struct DetectScalar<double> {
   using element_t = double;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -82,6 +92,8 @@ template <>
 struct DetectScalar<std::complex<float>> {
   using element_t = std::complex<float>;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! DetectScalar.
@@ -91,6 +103,8 @@ template <>
 struct DetectScalar<std::complex<double>> {
   using element_t = std::complex<double>;
   static element_t get_scalar(element_t &scalar) { return scalar; }
+  static void bind(element_t &, cl::sycl::handler &) {}
+  static void adjust_access_displacement(element_t &) {}
 };
 
 /*! get_scalar.
@@ -101,6 +115,58 @@ auto get_scalar(element_t &scalar_)
     -> decltype(DetectScalar<element_t>::get_scalar(scalar_)) {
   return DetectScalar<element_t>::get_scalar(scalar_);
 }
+
+/*! make_scalar_operand.
+ * @brief Returns the scalar operand of a ScalarOp. Host scalars are used as
+ * they are, device scalars are read inside the kernel through a DeviceScalar.
+ */
+template <typename executor_t, typename element_t>
+inline element_t make_scalar_operand(executor_t &, element_t scalar_) {
+  return scalar_;
+}
+
+template <typename executor_t, typename element_t, typename policy_t>
+inline auto make_scalar_operand(executor_t &ex,
+                                BufferIterator<element_t, policy_t> scalar_)
+    -> DeviceScalar<decltype(make_vector_view(ex, scalar_, 1, 1))> {
+  auto view = make_vector_view(ex, scalar_, 1, 1);
+  return make_device_scalar(view);
+}
+
+/*! is_scalar_zero.
+ * @brief Whether a scalar is known on the host to be zero. Device scalars are
+ * never assumed to be zero.
+ */
+template <typename element_t>
+inline bool is_scalar_zero(element_t scalar_) {
+  return scalar_ == element_t{0};
+}
+
+template <typename element_t, typename policy_t>
+inline bool is_scalar_zero(BufferIterator<element_t, policy_t>) {
+  return false;
+}
+
+/*! RebaseIndex.
+ * @brief Makes the index of a reduction result relative to the first element
+ * of the block it was reduced from. Results without an index are unchanged.
+ */
+template <typename value_t>
+struct RebaseIndex {
+  template <typename index_t>
+  static SYCL_BLAS_INLINE value_t get(value_t val, index_t) {
+    return val;
+  }
+};
+
+template <typename ix_t, typename val_t>
+struct RebaseIndex<IndexValueTuple<ix_t, val_t>> {
+  using value_t = IndexValueTuple<ix_t, val_t>;
+  template <typename index_t>
+  static SYCL_BLAS_INLINE value_t get(value_t val, index_t first) {
+    return value_t(val.get_index() - first, val.val);
+  }
+};
 }  // namespace internal
 
 /** Join.
@@ -115,10 +181,16 @@ Join<lhs_t, rhs_t>::get_size() const {
   return rhs_.get_size();
 }
 
+template <typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool Join<lhs_t, rhs_t>::valid_thread(
+    typename Join<lhs_t, rhs_t>::index_t i) const {
+  return i < get_size();
+}
+
 template <typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE bool Join<lhs_t, rhs_t>::valid_thread(
     cl::sycl::nd_item<1> ndItem) const {
-  return ((ndItem.get_global_id(0) < Join<lhs_t, rhs_t>::get_size()));
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
 }
 
 template <typename lhs_t, typename rhs_t>
@@ -156,10 +228,16 @@ Assign<lhs_t, rhs_t>::get_size() const {
   return rhs_.get_size();
 }
 
+template <typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool Assign<lhs_t, rhs_t>::valid_thread(
+    typename Assign<lhs_t, rhs_t>::index_t i) const {
+  return i < get_size();
+}
+
 template <typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE bool Assign<lhs_t, rhs_t>::valid_thread(
     cl::sycl::nd_item<1> ndItem) const {
-  return ((ndItem.get_global_id(0) < Assign<lhs_t, rhs_t>::get_size()));
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
 }
 
 template <typename lhs_t, typename rhs_t>
@@ -202,12 +280,21 @@ SYCL_BLAS_INLINE
   return rhs_2_.get_size();
 }
 
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+SYCL_BLAS_INLINE bool
+DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::valid_thread(
+    typename DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::index_t i)
+    const {
+  return i < get_size();
+}
+
 template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
           typename rhs_2_t>
 SYCL_BLAS_INLINE bool
 DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::valid_thread(
     cl::sycl::nd_item<1> ndItem) const {
-  return ((ndItem.get_global_id(0) < get_size()));
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
 }
 
 template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
@@ -265,11 +352,16 @@ SYCL_BLAS_INLINE typename ScalarOp<operator_t, scalar_t, rhs_t>::index_t
 ScalarOp<operator_t, scalar_t, rhs_t>::get_size() const {
   return rhs_.get_size();
 }
+template <typename operator_t, typename scalar_t, typename rhs_t>
+SYCL_BLAS_INLINE bool ScalarOp<operator_t, scalar_t, rhs_t>::valid_thread(
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::index_t i) const {
+  return i < get_size();
+}
+
 template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE bool ScalarOp<operator_t, scalar_t, rhs_t>::valid_thread(
     cl::sycl::nd_item<1> ndItem) const {
-  return ((ndItem.get_global_id(0) <
-           ScalarOp<operator_t, scalar_t, rhs_t>::get_size()));
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
 }
 template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE typename ScalarOp<operator_t, scalar_t, rhs_t>::value_t
@@ -285,14 +377,57 @@ ScalarOp<operator_t, scalar_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
 template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void ScalarOp<operator_t, scalar_t, rhs_t>::bind(
     cl::sycl::handler &h) {
+  internal::DetectScalar<scalar_t>::bind(scalar_, h);
   rhs_.bind(h);
 }
 
 template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void
 ScalarOp<operator_t, scalar_t, rhs_t>::adjust_access_displacement() {
+  internal::DetectScalar<scalar_t>::adjust_access_displacement(scalar_);
   rhs_.adjust_access_displacement();
 }
+
+/*! DeviceScalar.
+ * @brief Leaf reading a scalar which lives in device memory.
+ */
+template <typename view_t>
+DeviceScalar<view_t>::DeviceScalar(view_t &_v) : view_(_v) {}
+
+template <typename view_t>
+SYCL_BLAS_INLINE typename DeviceScalar<view_t>::index_t
+DeviceScalar<view_t>::get_size() const {
+  return 1;
+}
+
+template <typename view_t>
+SYCL_BLAS_INLINE bool DeviceScalar<view_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename view_t>
+SYCL_BLAS_INLINE typename DeviceScalar<view_t>::value_t
+DeviceScalar<view_t>::eval(typename DeviceScalar<view_t>::index_t) {
+  return view_.eval(0);
+}
+
+template <typename view_t>
+SYCL_BLAS_INLINE typename DeviceScalar<view_t>::value_t
+DeviceScalar<view_t>::eval(cl::sycl::nd_item<1>) {
+  return view_.eval(0);
+}
+
+template <typename view_t>
+SYCL_BLAS_INLINE void DeviceScalar<view_t>::bind(cl::sycl::handler &h) {
+  view_.bind(h);
+}
+
+template <typename view_t>
+SYCL_BLAS_INLINE void DeviceScalar<view_t>::adjust_access_displacement() {
+  view_.adjust_access_displacement();
+}
+
 /*! UnaryOp.
  * Implements a Unary Operation ( operator_t(z), e.g. z++), with z a vector.
  */
@@ -305,10 +440,16 @@ UnaryOp<operator_t, rhs_t>::get_size() const {
   return rhs_.get_size();
 }
 
+template <typename operator_t, typename rhs_t>
+SYCL_BLAS_INLINE bool UnaryOp<operator_t, rhs_t>::valid_thread(
+    typename UnaryOp<operator_t, rhs_t>::index_t i) const {
+  return i < get_size();
+}
+
 template <typename operator_t, typename rhs_t>
 SYCL_BLAS_INLINE bool UnaryOp<operator_t, rhs_t>::valid_thread(
     cl::sycl::nd_item<1> ndItem) const {
-  return ((ndItem.get_global_id(0) < UnaryOp<operator_t, rhs_t>::get_size()));
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
 }
 
 template <typename operator_t, typename rhs_t>
@@ -344,10 +485,16 @@ SYCL_BLAS_INLINE typename BinaryOp<operator_t, lhs_t, rhs_t>::index_t
 BinaryOp<operator_t, lhs_t, rhs_t>::get_size() const {
   return rhs_.get_size();
 }
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool BinaryOp<operator_t, lhs_t, rhs_t>::valid_thread(
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::index_t i) const {
+  return i < get_size();
+}
+
 template <typename operator_t, typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE bool BinaryOp<operator_t, lhs_t, rhs_t>::valid_thread(
     cl::sycl::nd_item<1> ndItem) const {
-  return ((ndItem.get_global_id(0) < get_size()));
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
 }
 
 template <typename operator_t, typename lhs_t, typename rhs_t>
@@ -387,10 +534,16 @@ SYCL_BLAS_INLINE typename TupleOp<rhs_t>::index_t TupleOp<rhs_t>::get_size()
   return rhs_.get_size();
 }
 
+template <typename rhs_t>
+SYCL_BLAS_INLINE bool TupleOp<rhs_t>::valid_thread(
+    typename TupleOp<rhs_t>::index_t i) const {
+  return i < get_size();
+}
+
 template <typename rhs_t>
 SYCL_BLAS_INLINE bool TupleOp<rhs_t>::valid_thread(
     cl::sycl::nd_item<1> ndItem) const {
-  return ((ndItem.get_global_id(0) < get_size()));
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
 }
 template <typename rhs_t>
 SYCL_BLAS_INLINE typename TupleOp<rhs_t>::value_t TupleOp<rhs_t>::eval(
@@ -524,6 +677,304 @@ AssignReduction<operator_t, lhs_t, rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/*! AssignReductionSinglePass.
+ * @brief Implements the reduction operation for assignments (in the form y
+ * = x) with y a scalar and x a subexpression tree, in a single kernel launch.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t>
+AssignReductionSinglePass<operator_t, lhs_t, rhs_t, sync_t>::
+    AssignReductionSinglePass(lhs_t &_l, rhs_t &_r, lhs_t &_partials,
+                              sync_t &_sync, index_t _syncOffset,
+                              index_t _blqS, index_t _grdS)
+    : lhs_(_l),
+      rhs_(_r),
+      partials_(_partials),
+      sync_(_sync),
+      sync_offset_(_syncOffset),
+      local_num_thread_(_blqS),
+      global_num_thread_(_grdS){};
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t>
+SYCL_BLAS_INLINE typename AssignReductionSinglePass<operator_t, lhs_t, rhs_t,
+                                                   sync_t>::index_t
+AssignReductionSinglePass<operator_t, lhs_t, rhs_t, sync_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t>
+SYCL_BLAS_INLINE bool
+AssignReductionSinglePass<operator_t, lhs_t, rhs_t, sync_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename AssignReductionSinglePass<operator_t, lhs_t, rhs_t,
+                                                   sync_t>::value_t
+AssignReductionSinglePass<operator_t, lhs_t, rhs_t, sync_t>::eval(
+    sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+  index_t nWG = ndItem.get_group_range(0);
+
+  index_t vecS = rhs_.get_size();
+  index_t frs_thrd = 2 * groupid * localSz + localid;
+
+  // Reduction across the grid
+  static constexpr value_t init_val = operator_t::template init<rhs_t>();
+  value_t val = init_val;
+  for (index_t k = frs_thrd; k < vecS; k += 2 * global_num_thread_) {
+    val = operator_t::eval(val, rhs_.eval(k));
+    if ((k + local_num_thread_ < vecS)) {
+      val = operator_t::eval(val, rhs_.eval(k + local_num_thread_));
+    }
+  }
+
+  scratch[localid] = val;
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Reduction inside the block
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + offset]);
+    }
+    // This barrier is mandatory to be sure the data are on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+  if (localid == 0) {
+    partials_.eval(groupid) = scratch[localid];
+    // The partial result must be visible to the other work groups before the
+    // ticket is taken
+    ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+    int ticket = sync_[sync_offset_].fetch_add(1);
+    sync_[sync_offset_ + 1 + groupid].store(ticket);
+  }
+  // Every thread of the block needs the ticket taken by the thread 0
+  ndItem.barrier(cl::sycl::access::fence_space::global_and_local);
+  const bool is_last_group =
+      (sync_[sync_offset_ + 1 + groupid].load() == static_cast<int>(nWG - 1));
+  // Every thread of the block must have read the ticket before it is cleared,
+  // so that the block of counters is handed back zeroed
+  ndItem.barrier(cl::sycl::access::fence_space::global_and_local);
+  if (localid == 0) {
+    sync_[sync_offset_ + 1 + groupid].store(0);
+  }
+  if (!is_last_group) {
+    return scratch[0];
+  }
+
+  // The last block reduces the partial results of all the blocks
+  ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+  val = init_val;
+  for (index_t k = localid; k < nWG; k += localSz) {
+    val = operator_t::eval(val, partials_.eval(k));
+  }
+  scratch[localid] = val;
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + offset]);
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+  if (localid == 0) {
+    lhs_.eval(0) = scratch[localid];
+    // Leave the counter ready for the next reduction
+    sync_[sync_offset_].store(0);
+  }
+  return scratch[0];
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t>
+SYCL_BLAS_INLINE void
+AssignReductionSinglePass<operator_t, lhs_t, rhs_t, sync_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+  partials_.bind(h);
+  h.require(sync_);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t, typename sync_t>
+SYCL_BLAS_INLINE void AssignReductionSinglePass<
+    operator_t, lhs_t, rhs_t, sync_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+  partials_.adjust_access_displacement();
+}
+
+/*! VectorBatch.
+ * @brief Presents a batch of strided vectors as a single vector.
+ */
+template <typename vector_t>
+VectorBatch<vector_t>::VectorBatch(vector_t &_vector, index_t _vector_size,
+                                   index_t _inc, index_t _stride,
+                                   index_t _batch_size)
+    : vector_(_vector),
+      vector_size_(_vector_size),
+      inc_(_inc),
+      stride_(_stride),
+      batch_size_(_batch_size) {}
+
+template <typename vector_t>
+SYCL_BLAS_INLINE typename VectorBatch<vector_t>::index_t
+VectorBatch<vector_t>::get_size() const {
+  return vector_size_ * batch_size_;
+}
+
+template <typename vector_t>
+SYCL_BLAS_INLINE bool VectorBatch<vector_t>::valid_thread(
+    typename VectorBatch<vector_t>::index_t i) const {
+  return i < get_size();
+}
+
+template <typename vector_t>
+SYCL_BLAS_INLINE bool VectorBatch<vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return valid_thread(static_cast<index_t>(ndItem.get_global_id(0)));
+}
+
+template <typename vector_t>
+SYCL_BLAS_INLINE typename VectorBatch<vector_t>::value_t &
+VectorBatch<vector_t>::eval(index_t i) {
+  const index_t batch = i / vector_size_;
+  const index_t k = i - batch * vector_size_;
+  // As in BLAS, a negative increment goes through the vector backwards from
+  // its last element
+  const index_t first = (inc_ > 0) ? 0 : (1 - vector_size_) * inc_;
+  return vector_.template eval<true>(batch * stride_ + first + k * inc_);
+}
+
+template <typename vector_t>
+SYCL_BLAS_INLINE typename VectorBatch<vector_t>::value_t &
+VectorBatch<vector_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename vector_t>
+SYCL_BLAS_INLINE void VectorBatch<vector_t>::bind(cl::sycl::handler &h) {
+  vector_.bind(h);
+}
+
+template <typename vector_t>
+SYCL_BLAS_INLINE void VectorBatch<vector_t>::adjust_access_displacement() {
+  vector_.adjust_access_displacement();
+}
+
+/*! AssignBatchedReduction.
+ * @brief Reduces each block of vector_size_ elements of the right hand side
+ * into one element of the left hand side.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t>
+AssignBatchedReduction<operator_t, lhs_t, rhs_t>::AssignBatchedReduction(
+    lhs_t &_l, rhs_t &_r, index_t _vector_size)
+    : lhs_(_l), rhs_(_r), vector_size_(_vector_size) {}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE
+    typename AssignBatchedReduction<operator_t, lhs_t, rhs_t>::index_t
+    AssignBatchedReduction<operator_t, lhs_t, rhs_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+/*!
+ * @brief On the host, index i reduces the block i.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool
+AssignBatchedReduction<operator_t, lhs_t, rhs_t>::valid_thread(
+    typename AssignBatchedReduction<operator_t, lhs_t, rhs_t>::index_t i)
+    const {
+  return i < get_size();
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool
+AssignBatchedReduction<operator_t, lhs_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+/*!
+ * @brief Reduces the block i on its own, as done on the host.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE
+    typename AssignBatchedReduction<operator_t, lhs_t, rhs_t>::value_t
+    AssignBatchedReduction<operator_t, lhs_t, rhs_t>::eval(index_t i) {
+  static constexpr value_t init_val = operator_t::template init<rhs_t>();
+  const index_t first = i * vector_size_;
+  value_t val = init_val;
+  for (index_t k = 0; k < vector_size_; ++k) {
+    val = operator_t::eval(val, rhs_.eval(first + k));
+  }
+  lhs_.eval(i) = internal::RebaseIndex<value_t>::get(val, first);
+  return val;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE
+    typename AssignBatchedReduction<operator_t, lhs_t, rhs_t>::value_t
+    AssignBatchedReduction<operator_t, lhs_t, rhs_t>::eval(
+        cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE
+    typename AssignBatchedReduction<operator_t, lhs_t, rhs_t>::value_t
+    AssignBatchedReduction<operator_t, lhs_t, rhs_t>::eval(
+        sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t batch = ndItem.get_group(0);
+  const index_t first = batch * vector_size_;
+
+  // The work items of the group stride through the block
+  static constexpr value_t init_val = operator_t::template init<rhs_t>();
+  value_t val = init_val;
+  for (index_t k = localid; k < vector_size_; k += localSz) {
+    val = operator_t::eval(val, rhs_.eval(first + k));
+  }
+
+  scratch[localid] = val;
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Reduction inside the block, localSz is a power of 2
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + offset]);
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+  if (localid == 0) {
+    lhs_.eval(batch) = internal::RebaseIndex<value_t>::get(
+        static_cast<value_t>(scratch[localid]), first);
+  }
+  return scratch[0];
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void AssignBatchedReduction<operator_t, lhs_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void AssignBatchedReduction<
+    operator_t, lhs_t, rhs_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_HPP
@@ -82,6 +82,186 @@ SYCL_BLAS_INLINE void SumMatrixColumns<rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE QuantizedMatrix<bits, weights_t, scales_t>::QuantizedMatrix(
+    weights_t &_weights, scales_t &_scales, index_t _rows, index_t _cols,
+    index_t _ld)
+    : weights_(_weights),
+      scales_(_scales),
+      rows_(_rows),
+      cols_(_cols),
+      ld_(_ld) {}
+
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE
+    typename QuantizedMatrix<bits, weights_t, scales_t>::index_t
+    QuantizedMatrix<bits, weights_t, scales_t>::get_size() const {
+  return rows_ * cols_;
+}
+
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE
+    typename QuantizedMatrix<bits, weights_t, scales_t>::index_t
+    QuantizedMatrix<bits, weights_t, scales_t>::get_size_row() const {
+  return rows_;
+}
+
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE
+    typename QuantizedMatrix<bits, weights_t, scales_t>::index_t
+    QuantizedMatrix<bits, weights_t, scales_t>::get_size_col() const {
+  return cols_;
+}
+
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE
+    typename QuantizedMatrix<bits, weights_t, scales_t>::index_t
+    QuantizedMatrix<bits, weights_t, scales_t>::getSizeL() const {
+  return ld_;
+}
+
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE
+    typename QuantizedMatrix<bits, weights_t, scales_t>::value_t
+    QuantizedMatrix<bits, weights_t, scales_t>::eval(index_t index,
+                                                     index_t row) {
+  int weight;
+  if (bits == 8) {
+    weight = weights_.template eval<true>(index);
+  } else {
+    // ld_ is even, so the parity of the index is the parity of the row. The
+    // low nibble is moved to the top of the byte, and both nibbles are sign
+    // extended by the arithmetic shift.
+    const int packed = weights_.template eval<true>(index >> 1);
+    weight = ((index & 1) ? packed : int(int8_t(packed << 4))) >> 4;
+  }
+  return scales_.template eval<true>(row) * static_cast<value_t>(weight);
+}
+
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE void QuantizedMatrix<bits, weights_t, scales_t>::bind(
+    cl::sycl::handler &h) {
+  weights_.bind(h);
+  scales_.bind(h);
+}
+
+template <int bits, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE void
+QuantizedMatrix<bits, weights_t, scales_t>::adjust_access_displacement() {
+  weights_.adjust_access_displacement();
+  scales_.adjust_access_displacement();
+}
+
+/*!
+ * @brief Loads the element of the matrix operand of a Gemv at the given
+ * position, whose row is only needed by quantized matrices.
+ */
+template <typename matrix_t, typename index_t>
+SYCL_BLAS_INLINE typename std::remove_cv<typename matrix_t::value_t>::type
+gemv_load(matrix_t &matrix, index_t index, index_t) {
+  return matrix.template eval<true>(index);
+}
+
+template <int bits, typename weights_t, typename scales_t, typename index_t>
+SYCL_BLAS_INLINE
+    typename QuantizedMatrix<bits, weights_t, scales_t>::value_t
+    gemv_load(QuantizedMatrix<bits, weights_t, scales_t> &matrix,
+              index_t index, index_t row) {
+  return matrix.eval(index, row);
+}
+
+template <int bits, typename matrix_t, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE
+GemvQuantizeWeights<bits, matrix_t, weights_t, scales_t>::GemvQuantizeWeights(
+    matrix_t &_matrix, weights_t &_weights, scales_t &_scales, index_t _ld)
+    : matrix_(_matrix), weights_(_weights), scales_(_scales), ld_(_ld) {}
+
+template <int bits, typename matrix_t, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE typename GemvQuantizeWeights<bits, matrix_t, weights_t,
+                                              scales_t>::index_t
+GemvQuantizeWeights<bits, matrix_t, weights_t, scales_t>::get_size() const {
+  return (matrix_.get_size_row() + rows_per_byte - 1) / rows_per_byte;
+}
+
+template <int bits, typename matrix_t, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE bool
+GemvQuantizeWeights<bits, matrix_t, weights_t, scales_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Quantizes the rows sharing the bytes number ndItem of the columns.
+ * Consecutive work items read consecutive rows, so both passes over the
+ * columns are coalesced.
+ */
+template <int bits, typename matrix_t, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE typename GemvQuantizeWeights<bits, matrix_t, weights_t,
+                                              scales_t>::value_t
+GemvQuantizeWeights<bits, matrix_t, weights_t, scales_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  constexpr int max_weight = (1 << (bits - 1)) - 1;
+  constexpr int mask = (1 << bits) - 1;
+  const index_t byte_id = ndItem.get_global_id(0);
+  const index_t first_row = byte_id * rows_per_byte;
+  const index_t m = matrix_.get_size_row();
+  const index_t n = matrix_.get_size_col();
+  const index_t lda = matrix_.getSizeL();
+  const index_t ld_bytes = ld_ / rows_per_byte;
+
+  value_t inv_scales[rows_per_byte];
+#pragma unroll
+  for (int r = 0; r < rows_per_byte; ++r) {
+    const index_t row = first_row + r;
+    value_t max_abs = value_t(0);
+    if (row < m) {
+      for (index_t j = 0; j < n; ++j) {
+        const value_t value = matrix_.template eval<true>(row + j * lda);
+        max_abs = cl::sycl::fmax(max_abs, cl::sycl::fabs(value));
+      }
+      scales_.template eval<true>(row) = max_abs / value_t(max_weight);
+    }
+    inv_scales[r] =
+        (max_abs > value_t(0)) ? value_t(max_weight) / max_abs : value_t(0);
+  }
+
+  for (index_t j = 0; j < n; ++j) {
+    int packed = 0;
+#pragma unroll
+    for (int r = 0; r < rows_per_byte; ++r) {
+      const index_t row = first_row + r;
+      // The rows past the end of the matrix fill the last byte with zeros
+      const value_t value =
+          (row < m) ? matrix_.template eval<true>(row + j * lda) : value_t(0);
+      const int weight =
+          static_cast<int>(cl::sycl::rint(value * inv_scales[r]));
+      packed |= (cl::sycl::clamp(weight, -max_weight, max_weight) & mask)
+                << (r * bits);
+    }
+    weights_.template eval<true>(byte_id + j * ld_bytes) =
+        static_cast<int8_t>(packed);
+  }
+  return value_t(0);
+}
+
+template <int bits, typename matrix_t, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE void
+GemvQuantizeWeights<bits, matrix_t, weights_t, scales_t>::bind(
+    cl::sycl::handler &h) {
+  matrix_.bind(h);
+  weights_.bind(h);
+  scales_.bind(h);
+}
+
+template <int bits, typename matrix_t, typename weights_t, typename scales_t>
+SYCL_BLAS_INLINE void
+GemvQuantizeWeights<bits, matrix_t, weights_t,
+                    scales_t>::adjust_access_displacement() {
+  matrix_.adjust_access_displacement();
+  weights_.adjust_access_displacement();
+  scales_.adjust_access_displacement();
+}
+
 /*!
  * @brief Constructor for the Gemv class. See blas2_trees.h for details on the
  * parameters.
@@ -133,41 +313,47 @@ SYCL_BLAS_INLINE
   const index_t local_id = ndItem.get_local_id(0);
   const index_t group_id = ndItem.get_group(0);
   const index_t group_range = ndItem.get_group_range(0);
-  const index_t contract_dim =
-      is_transposed ? matrix_a_.get_size_row() : matrix_a_.get_size_col();
   const index_t non_contract_dim =
       is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
   const index_t group_stride = group_range * local_range;
-  const index_t lda = matrix_a_.getSizeL();
 
   const index_t thread_id = group_id * local_range + local_id;
 
-  const index_t non_contract_local_thread_stride = is_transposed ? lda : 1;
-  const index_t contract_stride = is_transposed ? 1 : lda;
-  value_t sum = 0;
-
-  index_t non_contract_dim_index = thread_id * non_contract_local_thread_stride;
-  const index_t non_contract_dim_index_stride =
-      group_stride * non_contract_local_thread_stride;
+  for (index_t row_id = thread_id; row_id < non_contract_dim;
+       row_id += group_stride) {
+    lhs_.eval(row_id) = compute_row(row_id);
+  }
 
-  for (index_t row_id = 0; row_id < non_contract_dim; row_id += group_stride) {
-    if (thread_id + row_id >= non_contract_dim) {
-      return 0;
-    }
+  return 0;
+}
 
-    sum = 0;
-    for (index_t col_id = 0; col_id < contract_dim; ++col_id) {
-      sum = cl::sycl::mad(matrix_a_.template eval<true>(non_contract_dim_index),
-                          vector_x_.eval(col_id), sum);
-      non_contract_dim_index += contract_stride;
-    }
+/*!
+ * @brief Dot product of a whole row of op(A) with x.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_transposed, int cache_line_size,
+          int work_per_thread>
+SYCL_BLAS_INLINE
+    typename Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed,
+                  cache_line_size, work_per_thread>::value_t
+    Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
+         work_per_thread>::compute_row(index_t nc_dim_index) {
+  const index_t contract_dim =
+      is_transposed ? matrix_a_.get_size_row() : matrix_a_.get_size_col();
+  const index_t lda = matrix_a_.getSizeL();
 
-    non_contract_dim_index += non_contract_dim_index_stride;
+  const index_t non_contract_local_thread_stride = is_transposed ? lda : 1;
+  const index_t contract_stride = is_transposed ? 1 : lda;
+  value_t sum = 0;
 
-    lhs_.eval(thread_id + row_id) = sum;
+  index_t mat_index = nc_dim_index * non_contract_local_thread_stride;
+  for (index_t col_id = 0; col_id < contract_dim; ++col_id) {
+    const index_t row = is_transposed ? col_id : nc_dim_index;
+    sum = cl::sycl::mad(gemv_load(matrix_a_, mat_index, row),
+                        vector_x_.eval(col_id), sum);
+    mat_index += contract_stride;
   }
-
-  return 0;
+  return sum;
 }
 
 /*!
@@ -183,20 +369,51 @@ SYCL_BLAS_INLINE
     Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
          work_per_thread>::eval(local_memory_t local_mem,
                                 cl::sycl::nd_item<1> ndItem) {
-  const index_t local_id = ndItem.get_local_id(0);
   const index_t group_id = ndItem.get_group(0);
-  const index_t group_range = ndItem.get_group_range(0);
-  const index_t lda = matrix_a_.getSizeL();
   const index_t nc_dim =
       is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
-  const index_t c_dim =
-      is_transposed ? matrix_a_.get_size_row() : matrix_a_.get_size_col();
 
   // ID of the group in the non-contracting dimension of the global grid of WGs
   const index_t nc_group_id = group_id / wgs_per_c_;
   // ID of the group in the contracting dimension in the global grid of WGs
   const index_t c_group_id = group_id - nc_group_id * wgs_per_c_;
 
+  const value_t sum =
+      compute_block(local_mem, ndItem, nc_group_id, c_group_id);
+
+  // Non-contracting dimension index
+  const index_t nc_dim_index =
+      ndItem.get_local_id(0) + nc_group_id * local_range;
+  if (nc_dim_index < nc_dim) {
+    const index_t out_index = nc_dim_index + (c_group_id * nc_dim);
+    lhs_.eval(out_index) = sum;
+  }
+  return sum;
+}
+
+/*!
+ * @brief Partial dot products of a block of rows of op(A) with a block of x,
+ * using local memory.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_transposed, int cache_line_size,
+          int work_per_thread>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE
+    typename Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed,
+                  cache_line_size, work_per_thread>::value_t
+    Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
+         work_per_thread>::compute_block(local_memory_t local_mem,
+                                         cl::sycl::nd_item<1> ndItem,
+                                         index_t nc_group_id,
+                                         index_t c_group_id) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t lda = matrix_a_.getSizeL();
+  const index_t nc_dim =
+      is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
+  const index_t c_dim =
+      is_transposed ? matrix_a_.get_size_row() : matrix_a_.get_size_col();
+
   value_t *vector_scratch = local_mem.localAcc.get_pointer();
 
   // Threads pre-fetch portions of X into local group-shared memory
@@ -216,9 +433,9 @@ SYCL_BLAS_INLINE
   // In the non transposed case
   if (!is_transposed) {
     // Make sure nc_dim_index is within bounds
-    // This closes threads that would be calculating beyond the final row
+    // This skips threads that would be calculating beyond the final row
     if (nc_dim_index >= nc_dim) {
-      return 0;
+      return sum;
     }
 
     // Calculate the matrix index
@@ -229,13 +446,11 @@ SYCL_BLAS_INLINE
 
     // Computes the partial dot product for a row
     for (index_t c_dim_id = 0; c_dim_id < last_c_dim_id; ++c_dim_id) {
-      sum = cl::sycl::mad(matrix_a_.template eval<true>(mat_index),
+      sum = cl::sycl::mad(gemv_load(matrix_a_, mat_index, nc_dim_index),
                           vector_scratch[c_dim_id], sum);
       mat_index += lda;
     }
-
-    const index_t out_index = nc_dim_index + (c_group_id * nc_dim);
-    return lhs_.eval(out_index) = sum;
+    return sum;
   } else {  // In the transposed case
 
     constexpr int cl_elems = cache_line_size / sizeof(value_t);
@@ -248,7 +463,8 @@ SYCL_BLAS_INLINE
 
     for (index_t c_tile_id = 0; c_tile_id < tile_c_loops; ++c_tile_id) {
       // Extract a matrix block from global memory
-      extract_input_block(matrix_scratch, local_id, group_id, lda, c_tile_id);
+      extract_input_block(matrix_scratch, local_id, nc_group_id, c_group_id,
+                          lda, c_tile_id);
 
       // Ensure memory synchronization within work group
       ndItem.barrier(cl::sycl::access::fence_space::local_space);
@@ -266,11 +482,6 @@ SYCL_BLAS_INLINE
       ndItem.barrier(cl::sycl::access::fence_space::local_space);
     }
 
-    const index_t out_index = nc_dim_index + (c_group_id * nc_dim);
-
-    if (nc_dim_index < nc_dim) {
-      lhs_.eval(out_index) = sum;
-    }
     return sum;
   }
 }
@@ -287,7 +498,8 @@ SYCL_BLAS_INLINE void
 Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
      work_per_thread>::extract_input_block(ScratchPointerType matrix_scratch,
                                            const index_t &local_id,
-                                           const index_t &group_id,
+                                           const index_t &nc_group_id,
+                                           const index_t &c_group_id,
                                            const index_t &lda,
                                            index_t c_tile_id) {
   constexpr int cl_elems = cache_line_size / sizeof(value_t);
@@ -297,10 +509,6 @@ Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
   const index_t c_dim =
       is_transposed ? matrix_a_.get_size_row() : matrix_a_.get_size_col();
 
-  // Group indices within global grid
-  const index_t nc_group_id = group_id / wgs_per_c_;
-  const index_t c_group_id = group_id - nc_group_id * wgs_per_c_;
-
   // Tile dimensions
   constexpr int tile_dim_nc = local_range / cl_elems;
   constexpr int tile_dim_c = cl_elems;
@@ -336,7 +544,7 @@ Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
     // beyond bounds
     matrix_scratch[scratch_index + local_nc_index] =
         in_c_range && grid_nc_index < nc_dim
-            ? matrix_a_.template eval<true>(mat_index)
+            ? gemv_load(matrix_a_, mat_index, grid_c_index)
             : 0;
 
     // Move to loading the next tile
@@ -368,6 +576,173 @@ Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
   vector_x_.adjust_access_displacement();
 }
 
+/**** GEMV IN A SINGLE KERNEL ****/
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+SYCL_BLAS_INLINE
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t, sync_t>::
+    GemvSinglePass(gemv_t &_gemv, lhs_t &_l, alpha_t _alpha, beta_t _beta,
+                   sync_t &_sync, index_t _sync_offset,
+                   index_t _c_blocks_per_wg)
+    : gemv_(_gemv),
+      lhs_(_l),
+      alpha_(_alpha),
+      beta_(_beta),
+      sync_(_sync),
+      sync_offset_(_sync_offset),
+      c_blocks_per_wg_(_c_blocks_per_wg) {}
+
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+SYCL_BLAS_INLINE typename GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t,
+                                         beta_t, sync_t>::index_t
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t,
+               sync_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+SYCL_BLAS_INLINE bool
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t,
+               sync_t>::valid_thread(cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+SYCL_BLAS_INLINE void
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t,
+               sync_t>::write_result(index_t i, value_t dot_product) {
+  const value_t alpha_dot = internal::get_scalar(alpha_) * dot_product;
+  // y is not read when beta is zero, so that NaNs in y are not propagated.
+  // A device beta is only known here
+  const value_t beta = is_beta_zero ? value_t(0) : internal::get_scalar(beta_);
+  lhs_.eval(i) = (beta == value_t(0))
+                     ? alpha_dot
+                     : cl::sycl::mad(beta, lhs_.eval(i), alpha_dot);
+}
+
+/*!
+ * @brief Without local memory, each work item computes whole rows.
+ */
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+SYCL_BLAS_INLINE typename GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t,
+                                         beta_t, sync_t>::value_t
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t, sync_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  const index_t nc_dim = lhs_.get_size();
+  const index_t stride = ndItem.get_global_range(0);
+  for (index_t i = ndItem.get_global_id(0); i < nc_dim; i += stride) {
+    write_result(i, gemv_.compute_row(i));
+  }
+  return 0;
+}
+
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t,
+                                         beta_t, sync_t>::value_t
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t, sync_t>::eval(
+    local_memory_t local_mem, cl::sycl::nd_item<1> ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t local_range = ndItem.get_local_range(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t wgs_per_c = gemv_.wgs_per_c_;
+  const index_t nc_dim = lhs_.get_size();
+  const index_t num_c_blocks =
+      (gemv_.vector_x_.get_size() - 1) / local_range + 1;
+
+  const index_t nc_group_id = group_id / wgs_per_c;
+  const index_t c_group_id = group_id - nc_group_id * wgs_per_c;
+  const index_t nc_dim_index = nc_group_id * local_range + local_id;
+
+  const index_t first_c_block = c_group_id * c_blocks_per_wg_;
+  const index_t last_c_block =
+      cl::sycl::min(num_c_blocks, first_c_block + c_blocks_per_wg_);
+  value_t sum = 0;
+  for (index_t c_block = first_c_block; c_block < last_c_block; ++c_block) {
+    if (c_block > first_c_block) {
+      // The previous block of x must be consumed before it is overwritten
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+    sum += gemv_.compute_block(local_mem, ndItem, nc_group_id, c_block);
+  }
+
+  if (wgs_per_c == 1) {
+    if (nc_dim_index < nc_dim) {
+      write_result(nc_dim_index, sum);
+    }
+    return sum;
+  }
+
+  // The partial dot products must be visible to the other work groups before
+  // the ticket is taken
+  if (nc_dim_index < nc_dim) {
+    gemv_.lhs_.eval(nc_dim_index + c_group_id * nc_dim) = sum;
+  }
+  ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+  ndItem.barrier(cl::sycl::access::fence_space::global_and_local);
+
+  // Local memory is free again, it is used to share the ticket of the group
+  value_t *is_last_group = local_mem.localAcc.get_pointer();
+  if (local_id == 0) {
+    const int ticket = sync_[sync_offset_ + nc_group_id].fetch_add(1);
+    const bool is_last = (ticket == static_cast<int>(wgs_per_c - 1));
+    if (is_last) {
+      // Leave the counter ready for the next call
+      sync_[sync_offset_ + nc_group_id].store(0);
+    }
+    is_last_group[0] = is_last ? value_t(1) : value_t(0);
+  }
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  if (is_last_group[0] == value_t(0)) {
+    return sum;
+  }
+
+  // The last work group of the block of rows finishes the dot products
+  ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+  if (nc_dim_index < nc_dim) {
+    value_t dot_product = 0;
+    for (index_t c = 0; c < wgs_per_c; ++c) {
+      dot_product += gemv_.lhs_.eval(nc_dim_index + c * nc_dim);
+    }
+    write_result(nc_dim_index, dot_product);
+  }
+  return sum;
+}
+
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+SYCL_BLAS_INLINE void
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t, sync_t>::bind(
+    cl::sycl::handler &h) {
+  gemv_.matrix_a_.bind(h);
+  gemv_.vector_x_.bind(h);
+  // The partial dot products are only used when x is split, the Gemv tree
+  // may otherwise be built on y itself
+  if (gemv_.wgs_per_c_ > 1) {
+    gemv_.lhs_.bind(h);
+  }
+  lhs_.bind(h);
+  internal::DetectScalar<alpha_t>::bind(alpha_, h);
+  internal::DetectScalar<beta_t>::bind(beta_, h);
+  h.require(sync_);
+}
+
+template <bool is_beta_zero, typename gemv_t, typename lhs_t, typename alpha_t,
+          typename beta_t, typename sync_t>
+SYCL_BLAS_INLINE void
+GemvSinglePass<is_beta_zero, gemv_t, lhs_t, alpha_t, beta_t,
+               sync_t>::adjust_access_displacement() {
+  gemv_.adjust_access_displacement();
+  lhs_.adjust_access_displacement();
+  internal::DetectScalar<alpha_t>::adjust_access_displacement(alpha_);
+  internal::DetectScalar<beta_t>::adjust_access_displacement(beta_);
+}
+
 /**** GEMV BY ROWS M ROWS x N BLOCK ****/
 /**
  * @struct GemvRow
@@ -760,13 +1135,20 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
 
   index_t dimR = matrix_.get_size_row();
   index_t dimC = matrix_.get_size_col();
-  index_t colSz = (dimC + nWG_col_ - 1) / nWG_col_;
-
-  index_t idWFR = (groupid % nWG_row_);
-  index_t idWFC = (groupid / nWG_row_);
   index_t dimWFR =
       (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
 
+  index_t idWFR, idWFC, colSz;
+  if (is_triangular) {
+    // Only the blocks touching the triangle are launched, on a square grid
+    TriangularBlocks::get_block<Upper>(groupid, idWFR, idWFC);
+    colSz = dimWFR;
+  } else {
+    idWFR = (groupid % nWG_row_);
+    idWFC = (groupid / nWG_row_);
+    colSz = (dimC + nWG_col_ - 1) / nWG_col_;
+  }
+
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
 
@@ -803,6 +1185,16 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
       lhs_.eval(rowid, idWFC) = val;
     }
   }
+  if (is_triangular && idWFR != idWFC) {
+    // The mirrored block is not launched, its partial sums are cleared here
+    // as every column of lhs_ is added up afterwards
+    auto zero = AdditionIdentity::eval(vector_.eval(0));
+    index_t frs_mirror = idWFC * dimWFR + localid;
+    index_t lst_mirror = std::min(dimR, frs_mirror + dimWFR);
+    for (index_t rowid = frs_mirror; rowid < lst_mirror; rowid += localSz) {
+      lhs_.eval(rowid, idWFR) = zero;
+    }
+  }
 
   return lhs_.eval(frs_row, idWFC);
 }
@@ -822,13 +1214,20 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
 
   index_t dimR = matrix_.get_size_row();
   index_t dimC = matrix_.get_size_col();
-
-  index_t colSz = (dimC + nWG_col_ - 1) / nWG_col_;
-  index_t idWFR = (groupid % nWG_row_);
-  index_t idWFC = (groupid / nWG_row_);
   index_t dimWFR =
       (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
 
+  index_t idWFR, idWFC, colSz;
+  if (is_triangular) {
+    // Only the blocks touching the triangle are launched, on a square grid
+    TriangularBlocks::get_block<Upper>(groupid, idWFR, idWFC);
+    colSz = dimWFR;
+  } else {
+    idWFR = (groupid % nWG_row_);
+    idWFC = (groupid / nWG_row_);
+    colSz = (dimC + nWG_col_ - 1) / nWG_col_;
+  }
+
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
 
@@ -890,6 +1289,16 @@ GemvCol<Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
       }
     }
   }
+  if (is_triangular && idWFR != idWFC) {
+    // The mirrored block is not launched, its partial sums are cleared here
+    // as every column of lhs_ is added up afterwards
+    auto zero = AdditionIdentity::eval(vector_.eval(0));
+    index_t frs_mirror = idWFC * dimWFR + localid;
+    index_t lst_mirror = std::min(dimR, frs_mirror + dimWFR);
+    for (index_t rowid = frs_mirror; rowid < lst_mirror; rowid += localSz) {
+      lhs_.eval(rowid, idWFR) = zero;
+    }
+  }
   return lhs_.eval(frs_row, idWFC);
 }
 template <bool Lower, bool Diag, bool Upper, bool Unit, typename lhs_t,
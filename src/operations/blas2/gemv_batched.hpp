@@ -0,0 +1,178 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_batched.hpp
+ *
+ **************************************************************************/
+
+#ifndef GEMV_BATCHED_HPP
+#define GEMV_BATCHED_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas3_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t,
+                             matrix_t, vector_t, alpha_t, beta_t>::
+    GemvBatched(lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+                alpha_t _alpha, beta_t _beta, index_t _m, index_t _n,
+                index_t _lda, index_t _stride_a, index_t _inc_x,
+                index_t _stride_x, index_t _inc_y, index_t _stride_y,
+                index_t _batch_size)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta),
+      m_(_m),
+      n_(_n),
+      lda_(_lda),
+      stride_a_(_stride_a),
+      inc_x_(_inc_x),
+      stride_x_(_stride_x),
+      inc_y_(_inc_y),
+      stride_y_(_stride_y),
+      batch_size_(_batch_size) {}
+
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE
+    typename GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t,
+                         matrix_t, vector_t, alpha_t, beta_t>::index_t
+    GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t,
+                vector_t, alpha_t, beta_t>::get_size() const {
+  return (is_transposed ? n_ : m_) * batch_size_;
+}
+
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE bool
+GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t, vector_t,
+            alpha_t, beta_t>::valid_thread(cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE
+    typename GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t,
+                         matrix_t, vector_t, alpha_t, beta_t>::index_t
+    GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t,
+                vector_t, alpha_t, beta_t>::get_position(index_t batch,
+                                                         index_t offset,
+                                                         index_t stride) const {
+  return (batch_type == static_cast<int>(gemm_batch_type_t::interleaved))
+             ? offset * batch_size_ + batch
+             : batch * stride + offset;
+}
+
+/*!
+ * @brief Computes the element i of the vectors y_b taken one after the other
+ * (strided) or of the batch taken element by element (interleaved).
+ */
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE
+    typename GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t,
+                         matrix_t, vector_t, alpha_t, beta_t>::value_t
+    GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t,
+                vector_t, alpha_t, beta_t>::eval(index_t i) {
+  const index_t nc_dim = is_transposed ? n_ : m_;
+  const index_t c_dim = is_transposed ? m_ : n_;
+  const bool is_interleaved =
+      batch_type == static_cast<int>(gemm_batch_type_t::interleaved);
+  const index_t row = is_interleaved ? i / batch_size_ : i % nc_dim;
+  const index_t batch = is_interleaved ? i % batch_size_ : i / nc_dim;
+
+  // As in BLAS, a negative increment goes through the vector backwards from
+  // its last element
+  const index_t x_start = (inc_x_ > 0) ? 0 : (1 - c_dim) * inc_x_;
+  const index_t y_start = (inc_y_ > 0) ? 0 : (1 - nc_dim) * inc_y_;
+  const index_t a_row_stride = is_transposed ? lda_ : 1;
+  const index_t a_col_stride = is_transposed ? 1 : lda_;
+
+  value_t dot_product = 0;
+  for (index_t k = 0; k < c_dim; ++k) {
+    const value_t a = matrix_.template eval<true>(get_position(
+        batch, row * a_row_stride + k * a_col_stride, stride_a_));
+    const value_t x = vector_.template eval<true>(
+        get_position(batch, x_start + k * inc_x_, stride_x_));
+    dot_product = cl::sycl::mad(a, x, dot_product);
+  }
+
+  auto &y = lhs_.template eval<true>(
+      get_position(batch, y_start + row * inc_y_, stride_y_));
+  const value_t alpha_dot = internal::get_scalar(alpha_) * dot_product;
+  // y is not read when beta is zero, so that NaNs in y are not propagated
+  y = is_beta_zero
+          ? alpha_dot
+          : cl::sycl::mad(internal::get_scalar(beta_), value_t(y), alpha_dot);
+  return y;
+}
+
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE
+    typename GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t,
+                         matrix_t, vector_t, alpha_t, beta_t>::value_t
+    GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t,
+                vector_t, alpha_t, beta_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE void
+GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t, vector_t,
+            alpha_t, beta_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+  internal::DetectScalar<alpha_t>::bind(alpha_, h);
+  internal::DetectScalar<beta_t>::bind(beta_, h);
+}
+
+template <bool is_transposed, bool is_beta_zero, int batch_type,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE void
+GemvBatched<is_transposed, is_beta_zero, batch_type, lhs_t, matrix_t, vector_t,
+            alpha_t, beta_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+  internal::DetectScalar<alpha_t>::adjust_access_displacement(alpha_);
+  internal::DetectScalar<beta_t>::adjust_access_displacement(beta_);
+}
+
+}  // namespace blas
+#endif
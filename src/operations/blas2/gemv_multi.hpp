@@ -0,0 +1,216 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_multi.hpp
+ *
+ **************************************************************************/
+
+#ifndef GEMV_MULTI_HPP
+#define GEMV_MULTI_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t, beta_t>::GemvMulti(lhs_t &_l,
+                                                       matrix_t &_matrix,
+                                                       rhs_t &_r,
+                                                       alpha_t _alpha,
+                                                       beta_t _beta)
+    : lhs_(_l), matrix_(_matrix), rhs_(_r), alpha_(_alpha), beta_(_beta) {}
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE typename GemvMulti<local_range, max_vectors, is_transposed,
+                                    is_beta_zero, lhs_t, matrix_t, rhs_t,
+                                    alpha_t, beta_t>::index_t
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t, beta_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE bool
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t,
+          beta_t>::valid_thread(cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE typename GemvMulti<local_range, max_vectors, is_transposed,
+                                    is_beta_zero, lhs_t, matrix_t, rhs_t,
+                                    alpha_t, beta_t>::index_t
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t, beta_t>::get_num_work_groups(index_t
+                                                                     nc_dim) {
+  return is_transposed ? nc_dim : (nc_dim - 1) / local_range + 1;
+}
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE void
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t, beta_t>::write_result(index_t row,
+                                                          index_t col,
+                                                          value_t
+                                                              dot_product) {
+  const value_t alpha_dot = internal::get_scalar(alpha_) * dot_product;
+  lhs_.eval(row, col) =
+      is_beta_zero ? alpha_dot
+                   : cl::sycl::mad(internal::get_scalar(beta_),
+                                   lhs_.eval(row, col), alpha_dot);
+}
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvMulti<local_range, max_vectors, is_transposed,
+                                    is_beta_zero, lhs_t, matrix_t, rhs_t,
+                                    alpha_t, beta_t>::value_t
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t, beta_t>::eval(local_memory_t local_mem,
+                                                  cl::sycl::nd_item<1>
+                                                      ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t nc_dim = lhs_.get_size_row();
+  const index_t c_dim = rhs_.get_size_row();
+  const index_t num_vectors = lhs_.get_size_col();
+  value_t *scratch = local_mem.localAcc.get_pointer();
+
+  value_t dot_products[max_vectors];
+#pragma unroll
+  for (int j = 0; j < max_vectors; ++j) {
+    dot_products[j] = value_t(0);
+  }
+
+  if (!is_transposed) {
+    const index_t row = ndItem.get_group(0) * local_range + local_id;
+    for (index_t c_start = 0; c_start < c_dim; c_start += local_range) {
+      // The block of X is stored vector by vector, the work items then all
+      // read the same element at the same time
+      const index_t c = c_start + local_id;
+#pragma unroll
+      for (int j = 0; j < max_vectors; ++j) {
+        scratch[j * local_range + local_id] =
+            (c < c_dim && j < num_vectors) ? rhs_.eval(c, j) : value_t(0);
+      }
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+      const index_t block_size =
+          cl::sycl::min(index_t(local_range), c_dim - c_start);
+      if (row < nc_dim) {
+        for (index_t k = 0; k < block_size; ++k) {
+          const value_t a = matrix_.eval(row, c_start + k);
+#pragma unroll
+          for (int j = 0; j < max_vectors; ++j) {
+            dot_products[j] = cl::sycl::mad(a, scratch[j * local_range + k],
+                                            dot_products[j]);
+          }
+        }
+      }
+      // The block must be consumed before the next one overwrites it
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    if (row < nc_dim) {
+      for (index_t j = 0; j < num_vectors; ++j) {
+        write_result(row, j, dot_products[j]);
+      }
+    }
+    return value_t(0);
+  }
+
+  // The row of op(A) is the column of A, read by the whole work group
+  const index_t row = ndItem.get_group(0);
+  for (index_t c = local_id; c < c_dim; c += local_range) {
+    const value_t a = matrix_.eval(c, row);
+#pragma unroll
+    for (int j = 0; j < max_vectors; ++j) {
+      if (j < num_vectors) {
+        dot_products[j] = cl::sycl::mad(a, rhs_.eval(c, j), dot_products[j]);
+      }
+    }
+  }
+
+  // Tree reduction of the partial dot products, local_range is a power of 2
+#pragma unroll
+  for (int j = 0; j < max_vectors; ++j) {
+    scratch[j * local_range + local_id] = dot_products[j];
+  }
+  for (index_t offset = local_range / 2; offset > 0; offset /= 2) {
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    if (local_id < offset) {
+      for (index_t j = 0; j < num_vectors; ++j) {
+        scratch[j * local_range + local_id] +=
+            scratch[j * local_range + local_id + offset];
+      }
+    }
+  }
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  if (local_id < num_vectors) {
+    write_result(row, local_id, scratch[local_id * local_range]);
+  }
+  return value_t(0);
+}
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE void GemvMulti<local_range, max_vectors, is_transposed,
+                                is_beta_zero, lhs_t, matrix_t, rhs_t, alpha_t,
+                                beta_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  rhs_.bind(h);
+  internal::DetectScalar<alpha_t>::bind(alpha_, h);
+  internal::DetectScalar<beta_t>::bind(beta_, h);
+}
+
+template <uint32_t local_range, int max_vectors, bool is_transposed,
+          bool is_beta_zero, typename lhs_t, typename matrix_t, typename rhs_t,
+          typename alpha_t, typename beta_t>
+SYCL_BLAS_INLINE void
+GemvMulti<local_range, max_vectors, is_transposed, is_beta_zero, lhs_t,
+          matrix_t, rhs_t, alpha_t, beta_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+  internal::DetectScalar<alpha_t>::adjust_access_displacement(alpha_);
+  internal::DetectScalar<beta_t>::adjust_access_displacement(beta_);
+}
+
+}  // namespace blas
+#endif
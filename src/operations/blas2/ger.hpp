@@ -337,13 +337,22 @@ GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>::eval(
   index_t dimR = lhs_.get_size_row();
   index_t dimC = lhs_.get_size_col();
 
-  index_t colSz = (dimR < localSz) ? localSz : (dimC + nWG_col_ - 1) / nWG_col_;
-
-  index_t idWFR = groupid % nWG_row_;  // row bloq id of the current workgroup
-  index_t idWFC = groupid / nWG_row_;  // col blq id of the current workgroup
   index_t dimWFR =
       (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
 
+  index_t idWFR;  // row bloq id of the current workgroup
+  index_t idWFC;  // col blq id of the current workgroup
+  index_t colSz;
+  if (is_triangular) {
+    // Only the blocks touching the triangle are launched, on a square grid
+    TriangularBlocks::get_block<Upper>(groupid, idWFR, idWFC);
+    colSz = dimWFR;
+  } else {
+    idWFR = groupid % nWG_row_;
+    idWFC = groupid / nWG_row_;
+    colSz = (dimR < localSz) ? localSz : (dimC + nWG_col_ - 1) / nWG_col_;
+  }
+
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
 
@@ -399,16 +408,26 @@ GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t>::eval(
   index_t dimR = lhs_.get_size_row();
   index_t dimC = lhs_.get_size_col();
 
-  index_t colSz = (dimR < localSz) ? localSz : (dimC + nWG_col_ - 1) / nWG_col_;
-
-  index_t idWFR = groupid % nWG_row_;  // row bloq id of the current workgroup
   index_t dimWFR =
       (dimR + (localSz * nWG_row_) - 1) / (localSz * nWG_row_) * localSz;
 
+  index_t idWFR;  // row bloq id of the current workgroup
+  index_t idWFC;  // col blq id of the current workgroup
+  index_t colSz;
+  if (is_triangular) {
+    // Only the blocks touching the triangle are launched, on a square grid
+    TriangularBlocks::get_block<Upper>(groupid, idWFR, idWFC);
+    colSz = dimWFR;
+  } else {
+    idWFR = groupid % nWG_row_;
+    idWFC = groupid / nWG_row_;
+    colSz = (dimR < localSz) ? localSz : (dimC + nWG_col_ - 1) / nWG_col_;
+  }
+
   index_t frs_row = idWFR * dimWFR + localid;
   index_t lst_row = std::min(dimR, frs_row + dimWFR);
 
-  index_t frs_col = (groupid / nWG_row_) * colSz;
+  index_t frs_col = idWFC * colSz;
   index_t lst_col = std::min(dimC, frs_col + colSz);
   // PROBLEM IF ONLY SOME THREADS OF A WORKGROUP ARE CANCELED
   // TO SOLVE IT, USE GLOBAL VALUES OF frs_row AND lst_row
@@ -0,0 +1,161 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename symv.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYMV_HPP
+#define SYMV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+
+namespace blas {
+
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::Symv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      num_blocks_((_matrix.get_size_row() - 1) / tile_size + 1) {}
+
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE
+    typename Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::index_t
+    Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::get_size() const {
+  return matrix_.get_size_row();
+}
+
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE bool
+Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE
+    typename Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::index_t
+    Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::get_num_work_groups(
+        index_t n) {
+  const index_t num_blocks = (n - 1) / tile_size + 1;
+  return TriangularBlocks::get_num_blocks(num_blocks);
+}
+
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE
+    typename Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::value_t
+    Symv<tile_size, is_upper, lhs_t, matrix_t, vector_t>::eval(
+        local_memory_t local_mem, cl::sycl::nd_item<1> ndItem) {
+  constexpr index_t ld_tile = tile_size + 1;
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t n = matrix_.get_size_row();
+
+  // Blocks of rows and columns of the stored tile
+  index_t block_row, block_col;
+  TriangularBlocks::get_block<is_upper>(index_t(ndItem.get_group(0)),
+                                        block_row, block_col);
+  const index_t row = block_row * tile_size + local_id;
+  const index_t col = block_col * tile_size + local_id;
+
+  // The tile is stored column-major with one element of padding per column,
+  // so that reading it by rows and by columns is free of bank conflicts
+  value_t *tile = local_mem.localAcc.get_pointer();
+  value_t *x_row = tile + ld_tile * tile_size;
+  value_t *x_col = x_row + tile_size;
+
+  x_row[local_id] = row < n ? vector_.eval(row) : value_t(0);
+  x_col[local_id] = col < n ? vector_.eval(col) : value_t(0);
+
+  // Each work item loads a row of the tile, the accesses of the work group
+  // to a column of the matrix are contiguous
+  const index_t col_start = block_col * tile_size;
+  const index_t num_cols = cl::sycl::min(index_t(tile_size), n - col_start);
+  for (index_t j = 0; j < tile_size; ++j) {
+    tile[local_id + j * ld_tile] = (row < n && j < num_cols)
+                                       ? matrix_.eval(row, col_start + j)
+                                       : value_t(0);
+  }
+
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  value_t sum = 0;
+  if (block_row == block_col) {
+    // Diagonal tile, the missing triangle is read from its mirror
+    for (index_t j = 0; j < tile_size; ++j) {
+      const bool stored = is_upper ? local_id <= j : local_id >= j;
+      const value_t a =
+          stored ? tile[local_id + j * ld_tile] : tile[j + local_id * ld_tile];
+      sum = cl::sycl::mad(a, x_col[j], sum);
+    }
+    if (row < n) {
+      lhs_.eval(row, block_row) = sum;
+    }
+    return sum;
+  }
+
+  // A_ij * x_j for the rows of block i
+  for (index_t j = 0; j < tile_size; ++j) {
+    sum = cl::sycl::mad(tile[local_id + j * ld_tile], x_col[j], sum);
+  }
+  // A_ij^T * x_i for the rows of block j
+  value_t sum_t = 0;
+  for (index_t i = 0; i < tile_size; ++i) {
+    sum_t = cl::sycl::mad(tile[i + local_id * ld_tile], x_row[i], sum_t);
+  }
+
+  if (row < n) {
+    lhs_.eval(row, block_col) = sum;
+  }
+  if (col < n) {
+    lhs_.eval(col, block_row) = sum_t;
+  }
+  return sum;
+}
+
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE void Symv<tile_size, is_upper, lhs_t, matrix_t,
+                           vector_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <int tile_size, bool is_upper, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE void Symv<tile_size, is_upper, lhs_t, matrix_t,
+                           vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
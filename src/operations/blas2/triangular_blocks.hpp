@@ -0,0 +1,57 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename triangular_blocks.hpp
+ *
+ **************************************************************************/
+
+#ifndef TRIANGULAR_BLOCKS_HPP
+#define TRIANGULAR_BLOCKS_HPP
+#include "operations/blas2_trees.h"
+
+namespace blas {
+
+template <typename index_t>
+SYCL_BLAS_INLINE index_t TriangularBlocks::get_num_blocks(index_t num_blocks) {
+  return num_blocks * (num_blocks + 1) / 2;
+}
+
+template <bool is_upper, typename index_t>
+SYCL_BLAS_INLINE void TriangularBlocks::get_block(index_t id,
+                                                  index_t &block_row,
+                                                  index_t &block_col) {
+  // id = hi * (hi + 1) / 2 + lo with lo <= hi
+  index_t hi = static_cast<index_t>(
+      (cl::sycl::sqrt(8.f * static_cast<float>(id) + 1.f) - 1.f) / 2.f);
+  // The square root is only accurate to a few ulps for large ids
+  while (hi * (hi + 1) / 2 > id) {
+    --hi;
+  }
+  while ((hi + 1) * (hi + 2) / 2 <= id) {
+    ++hi;
+  }
+  const index_t lo = id - hi * (hi + 1) / 2;
+  block_row = is_upper ? lo : hi;
+  block_col = is_upper ? hi : lo;
+}
+
+}  // namespace blas
+#endif
@@ -26,7 +26,11 @@
 #ifndef SYCL_BLAS_BLAS2_TREES_HPP
 #define SYCL_BLAS_BLAS2_TREES_HPP
 
+#include "blas2/triangular_blocks.hpp"
 #include "blas2/gemv.hpp"
+#include "blas2/gemv_batched.hpp"
+#include "blas2/gemv_multi.hpp"
 #include "blas2/ger.hpp"
+#include "blas2/symv.hpp"
 
 #endif  // BLAS2_TREES_HPP
@@ -28,6 +28,7 @@
 #include "operations/blas3_trees.h"
 #include "views/view.h"
 #include <CL/sycl.hpp>
+#include <limits>
 #include <string>
 #include <type_traits>
 
@@ -46,6 +47,8 @@ struct type_string {
 
 ENABLE_TYPE_STRING(float)
 ENABLE_TYPE_STRING(double)
+ENABLE_TYPE_STRING(int8_t)
+ENABLE_TYPE_STRING(int32_t)
 
 #undef ENABLE_TYPE_STRING
 
@@ -69,6 +72,242 @@ Tile<ItemRows, ItemCols, WgRows, WgCols, TlRows, TlCols, ItemBatchs,
   return str.str();
 }
 
+template <typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t GemmNoEpilogue::eval(value_t value, index_t,
+                                              index_t) noexcept {
+  return value;
+}
+
+SYCL_BLAS_INLINE void GemmNoEpilogue::bind(cl::sycl::handler&) {}
+
+SYCL_BLAS_INLINE void GemmNoEpilogue::adjust_access_displacement() {}
+
+template <typename operator_t, typename bias_t>
+SYCL_BLAS_INLINE GemmEpilogue<operator_t, bias_t>::GemmEpilogue(
+    bias_t bias, gemm_bias_t bias_type)
+    : bias_(bias), bias_type_(bias_type) {}
+
+template <typename operator_t, typename bias_t>
+template <typename index_t>
+SYCL_BLAS_INLINE typename GemmEpilogue<operator_t, bias_t>::value_t
+GemmEpilogue<operator_t, bias_t>::eval(value_t value, index_t row,
+                                       index_t col) noexcept {
+  // The bias type is the same for all the items, so this does not diverge
+  if (bias_type_ == gemm_bias_t::row) {
+    value += bias_.template eval<true>(row);
+  } else if (bias_type_ == gemm_bias_t::column) {
+    value += bias_.template eval<true>(col);
+  }
+  return operator_t::eval(value);
+}
+
+template <typename operator_t, typename bias_t>
+SYCL_BLAS_INLINE void GemmEpilogue<operator_t, bias_t>::bind(
+    cl::sycl::handler& h) {
+  bias_.bind(h);
+}
+
+template <typename operator_t, typename bias_t>
+SYCL_BLAS_INLINE void
+GemmEpilogue<operator_t, bias_t>::adjust_access_displacement() {
+  bias_.adjust_access_displacement();
+}
+
+template <typename output_value_t, typename scale_t, typename zero_point_t>
+SYCL_BLAS_INLINE
+GemmRequantize<output_value_t, scale_t, zero_point_t>::GemmRequantize(
+    scale_t scale, zero_point_t zero_point,
+    gemm_quantization_t quantization_type)
+    : scale_(scale),
+      zero_point_(zero_point),
+      quantization_type_(quantization_type) {}
+
+/*!
+ * @brief Rounds a requantized value to the nearest integer and saturates it to
+ * the range of the integer output type.
+ */
+template <typename output_value_t, typename value_t>
+SYCL_BLAS_INLINE typename std::enable_if<
+    std::is_integral<output_value_t>::value, value_t>::type
+requantize_round(value_t value) noexcept {
+  return cl::sycl::fmin(
+      cl::sycl::fmax(cl::sycl::rint(value),
+                     value_t(std::numeric_limits<output_value_t>::lowest())),
+      value_t(std::numeric_limits<output_value_t>::max()));
+}
+
+template <typename output_value_t, typename value_t>
+SYCL_BLAS_INLINE typename std::enable_if<
+    !std::is_integral<output_value_t>::value, value_t>::type
+requantize_round(value_t value) noexcept {
+  return value;
+}
+
+template <typename output_value_t, typename scale_t, typename zero_point_t>
+template <typename acc_t, typename index_t>
+SYCL_BLAS_INLINE typename GemmRequantize<output_value_t, scale_t,
+                                         zero_point_t>::value_t
+GemmRequantize<output_value_t, scale_t, zero_point_t>::eval(
+    acc_t value, index_t row, index_t col) noexcept {
+  // The quantization type is the same for all the items, so this does not
+  // diverge
+  const index_t channel =
+      (quantization_type_ == gemm_quantization_t::per_row)
+          ? row
+          : (quantization_type_ == gemm_quantization_t::per_column)
+                ? col
+                : index_t(0);
+  return requantize_round<output_value_t>(
+      value_t(value) * scale_.template eval<true>(channel) +
+      value_t(zero_point_.template eval<true>(channel)));
+}
+
+template <typename output_value_t, typename scale_t, typename zero_point_t>
+SYCL_BLAS_INLINE void
+GemmRequantize<output_value_t, scale_t, zero_point_t>::bind(
+    cl::sycl::handler& h) {
+  scale_.bind(h);
+  zero_point_.bind(h);
+}
+
+template <typename output_value_t, typename scale_t, typename zero_point_t>
+SYCL_BLAS_INLINE void
+GemmRequantize<output_value_t, scale_t,
+               zero_point_t>::adjust_access_displacement() {
+  scale_.adjust_access_displacement();
+  zero_point_.adjust_access_displacement();
+}
+
+template <typename scalar_t, typename output_t>
+SYCL_BLAS_INLINE GemmDeviceScalars<scalar_t, output_t>::GemmDeviceScalars(
+    scalar_t alpha, scalar_t beta, output_t c)
+    : alpha_(alpha), beta_(beta), c_(c) {}
+
+template <typename scalar_t, typename output_t>
+template <typename index_t>
+SYCL_BLAS_INLINE typename GemmDeviceScalars<scalar_t, output_t>::value_t
+GemmDeviceScalars<scalar_t, output_t>::eval(value_t value, index_t row,
+                                            index_t col) noexcept {
+  // The element is read by the item storing it, before it is stored
+  const value_t beta = beta_.eval(index_t(0));
+  const value_t alpha_value = alpha_.eval(index_t(0)) * value;
+  return (beta == value_t(0))
+             ? alpha_value
+             : cl::sycl::mad(beta, c_.eval(row, col), alpha_value);
+}
+
+template <typename scalar_t, typename output_t>
+SYCL_BLAS_INLINE void GemmDeviceScalars<scalar_t, output_t>::bind(
+    cl::sycl::handler& h) {
+  alpha_.bind(h);
+  beta_.bind(h);
+  c_.bind(h);
+}
+
+template <typename scalar_t, typename output_t>
+SYCL_BLAS_INLINE void
+GemmDeviceScalars<scalar_t, output_t>::adjust_access_displacement() {
+  alpha_.adjust_access_displacement();
+  beta_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+}
+
+/*!
+ * @brief Type of the elements of C once they have been passed through the
+ * epilogue of a GEMM accumulating in element_t. It is element_t unless the
+ * epilogue converts them, as GemmRequantize does.
+ */
+template <typename epilogue_t, typename element_t, typename index_t>
+struct EpilogueValueType {
+  using type = decltype(std::declval<epilogue_t&>().eval(
+      std::declval<element_t>(), index_t(0), index_t(0)));
+};
+
+template <typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t GemmNoPrologue::eval_a(value_t value, index_t,
+                                                index_t) noexcept {
+  return value;
+}
+
+template <typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t GemmNoPrologue::eval_b(value_t value, index_t,
+                                                index_t) noexcept {
+  return value;
+}
+
+SYCL_BLAS_INLINE void GemmNoPrologue::bind(cl::sycl::handler&) {}
+
+SYCL_BLAS_INLINE void GemmNoPrologue::adjust_access_displacement() {}
+
+template <typename operator_t, typename scale_t>
+SYCL_BLAS_INLINE GemmPrologue<operator_t, scale_t>::GemmPrologue(
+    scale_t scale_a, gemm_scale_t scale_a_type, scale_t scale_b,
+    gemm_scale_t scale_b_type)
+    : scale_a_(scale_a),
+      scale_b_(scale_b),
+      scale_a_type_(scale_a_type),
+      scale_b_type_(scale_b_type) {}
+
+template <typename operator_t, typename scale_t>
+template <typename index_t>
+SYCL_BLAS_INLINE typename GemmPrologue<operator_t, scale_t>::value_t
+GemmPrologue<operator_t, scale_t>::eval_a(value_t value, index_t row,
+                                          index_t col) noexcept {
+  value = operator_t::eval(value);
+  if (scale_a_type_ == gemm_scale_t::row) {
+    value *= scale_a_.template eval<true>(row);
+  } else if (scale_a_type_ == gemm_scale_t::column) {
+    value *= scale_a_.template eval<true>(col);
+  }
+  return value;
+}
+
+template <typename operator_t, typename scale_t>
+template <typename index_t>
+SYCL_BLAS_INLINE typename GemmPrologue<operator_t, scale_t>::value_t
+GemmPrologue<operator_t, scale_t>::eval_b(value_t value, index_t row,
+                                          index_t col) noexcept {
+  value = operator_t::eval(value);
+  if (scale_b_type_ == gemm_scale_t::row) {
+    value *= scale_b_.template eval<true>(row);
+  } else if (scale_b_type_ == gemm_scale_t::column) {
+    value *= scale_b_.template eval<true>(col);
+  }
+  return value;
+}
+
+template <typename operator_t, typename scale_t>
+SYCL_BLAS_INLINE void GemmPrologue<operator_t, scale_t>::bind(
+    cl::sycl::handler& h) {
+  scale_a_.bind(h);
+  scale_b_.bind(h);
+}
+
+template <typename operator_t, typename scale_t>
+SYCL_BLAS_INLINE void
+GemmPrologue<operator_t, scale_t>::adjust_access_displacement() {
+  scale_a_.adjust_access_displacement();
+  scale_b_.adjust_access_displacement();
+}
+
+/*!
+ * @brief Multiply-add of the GEMM kernels, c + a * b. cl::sycl::mad is only
+ * defined for floating point types, so integers are multiplied and added.
+ */
+template <typename value_t>
+SYCL_BLAS_INLINE typename std::enable_if<!std::is_integral<value_t>::value,
+                                         value_t>::type
+gemm_mad(value_t a, value_t b, value_t c) noexcept {
+  return cl::sycl::mad(a, b, c);
+}
+
+template <typename value_t>
+SYCL_BLAS_INLINE
+    typename std::enable_if<std::is_integral<value_t>::value, value_t>::type
+    gemm_mad(value_t a, value_t b, value_t c) noexcept {
+  return a * b + c;
+}
+
 /*!
  * Optionally avoid evaluating the expression given as input.
  *
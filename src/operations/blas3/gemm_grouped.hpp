@@ -0,0 +1,137 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_grouped.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GROUPED_GEMM_HPP
+#define SYCL_BLAS_BLAS3_GROUPED_GEMM_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE GemmGrouped<gemm_t, desc_t>::GemmGrouped(
+    gemm_t gemm, desc_t desc, index_t group_count, index_t num_work_groups)
+    : gemm_(gemm),
+      desc_(desc),
+      group_count_(group_count),
+      num_work_groups_(num_work_groups) {}
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE typename GemmGrouped<gemm_t, desc_t>::index_t
+GemmGrouped<gemm_t, desc_t>::get_num_work_groups(index_t m,
+                                                 index_t n) noexcept {
+  return ((m + block_rows - 1) / block_rows) *
+         ((n + block_cols - 1) / block_cols);
+}
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE typename GemmGrouped<gemm_t, desc_t>::index_t
+GemmGrouped<gemm_t, desc_t>::get_size() const {
+  return num_work_groups_ * wg_size;
+}
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE bool GemmGrouped<gemm_t, desc_t>::valid_thread(
+    const cl::sycl::nd_item<1>& ndItem) const {
+  return true;
+}
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE typename GemmGrouped<gemm_t, desc_t>::index_t
+GemmGrouped<gemm_t, desc_t>::get_problem(index_t wg_id) noexcept {
+  // The first work groups of the problems are sorted, the problem is the last
+  // one starting at or before wg_id. Problems without any work group start
+  // where the next one does, so they are never selected.
+  index_t low = 0;
+  index_t high = group_count_;
+  while (high - low > 1) {
+    const index_t mid = (low + high) / 2;
+    if (desc_.template eval<true>(mid) <= wg_id) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+template <typename gemm_t, typename desc_t>
+template <typename... scratch_t>
+SYCL_BLAS_INLINE void GemmGrouped<gemm_t, desc_t>::compute_block(
+    const cl::sycl::nd_item<1>& id, scratch_t... scratch) noexcept {
+  const index_t wg_id = id.get_group(0);
+  const index_t problem = get_problem(wg_id);
+
+  const index_t fields = group_count_ + 1 + problem * num_problem_fields;
+  const index_t m = desc_.template eval<true>(fields + field_m);
+  const index_t n = desc_.template eval<true>(fields + field_n);
+  const index_t k = desc_.template eval<true>(fields + field_k);
+  const index_t lda = desc_.template eval<true>(fields + field_lda);
+  const index_t ldb = desc_.template eval<true>(fields + field_ldb);
+  const index_t ldc = desc_.template eval<true>(fields + field_ldc);
+  const index_t offset_a = desc_.template eval<true>(fields + field_offset_a);
+  const index_t offset_b = desc_.template eval<true>(fields + field_offset_b);
+  const index_t offset_c = desc_.template eval<true>(fields + field_offset_c);
+
+  // Blocks go down the columns of C_p first
+  const index_t block_id = wg_id - desc_.template eval<true>(problem);
+  const index_t row_blocks = (m + block_rows - 1) / block_rows;
+  const index_t wg_row = (block_id % row_blocks) * block_rows;
+  const index_t wg_col = (block_id / row_blocks) * block_cols;
+
+  // Every problem is a batch of one
+  gemm_.compute_block(scratch..., id, m, n, k, lda, ldb, ldc, wg_row, wg_col,
+                      offset_a, offset_b, offset_c, index_t(1), index_t(0),
+                      index_t(1));
+}
+
+template <typename gemm_t, typename desc_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void GemmGrouped<gemm_t, desc_t>::eval(
+    local_memory_t scratch, const cl::sycl::nd_item<1>& id) noexcept {
+  compute_block(id, scratch);
+}
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE void GemmGrouped<gemm_t, desc_t>::eval(
+    cl::sycl::nd_item<1> id) noexcept {
+  compute_block(id);
+}
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE void GemmGrouped<gemm_t, desc_t>::bind(cl::sycl::handler& h) {
+  gemm_.bind(h);
+  desc_.bind(h);
+}
+
+template <typename gemm_t, typename desc_t>
+SYCL_BLAS_INLINE void
+GemmGrouped<gemm_t, desc_t>::adjust_access_displacement() {
+  gemm_.adjust_access_displacement();
+  desc_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GROUPED_GEMM_HPP
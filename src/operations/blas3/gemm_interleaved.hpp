@@ -156,8 +156,14 @@ class Gemm<input_t, output_t, /* DoubleBuffer = */ false, /* NbcA = */ false,
   const index_t ldb_;
   const index_t ldc_;
   const index_t batch_size_;
+  /*!
+   * @brief The batch is the fastest moving dimension of the interleaved
+   * matrices, so the strides between the matrices of a strided batch are
+   * ignored.
+   */
   SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
-                        element_t beta, index_t batch_size)
+                        element_t beta, index_t batch_size, index_t, index_t,
+                        index_t)
       : a_(A),
         b_(B),
         c_(C),
@@ -27,6 +27,40 @@
 
 namespace blas {
 
+/*! @brief Type of the elements a pointer to global memory points to, which
+ * differs from the type the GEMM computes in for mixed precision and
+ * integer operands.
+ */
+template <typename pointer_t>
+struct PointeeType {
+  using type = typename std::remove_cv<typename std::remove_reference<decltype(
+      *std::declval<pointer_t>())>::type>::type;
+};
+
+/*! @brief Applies the prologue of a GEMM to the elements of a packet of A or B
+ * as it is loaded from global memory. The element at lane l of the packet is
+ * at (row_ + l, col_) of op(A) or op(B) when lanes_in_rows is true, and at
+ * (row_, col_ + l) otherwise.
+ * @tparam operand_a True for a packet of A, false for a packet of B.
+ * @tparam lanes_in_rows Whether the lanes of the packet are consecutive rows.
+ * @tparam prologue_t GemmNoPrologue or GemmPrologue.
+ */
+template <bool operand_a, bool lanes_in_rows, typename prologue_t,
+          typename index_t>
+struct PacketPrologue {
+  static constexpr bool is_identity = prologue_t::is_identity;
+  prologue_t &prologue_;
+  const index_t row_;
+  const index_t col_;
+  template <typename value_t>
+  SYCL_BLAS_INLINE value_t operator()(index_t lane, value_t value) const {
+    const index_t row = lanes_in_rows ? row_ + lane : row_;
+    const index_t col = lanes_in_rows ? col_ : col_ + lane;
+    return operand_a ? prologue_.eval_a(value, row, col)
+                     : prologue_.eval_b(value, row, col);
+  }
+};
+
 /*! @brief Contains static methods for loading and storing vector packets
 from/to non-vectorized memory as well as some constants for the vector type and
 packet size. SFINAE is used to select the appropriate method when called.
@@ -61,14 +95,17 @@ struct Packetize {
    * @tparam internal True if the current block is internal and no bounds
    * checking is required.
    * @tparam ld The leading dimension of the destination memory.
+   * @param transform Applied to the element if it is in range, see
+   * PacketPrologue.
    */
 
   template <bool trans, bool internal, int ld, typename SrcPointerType,
-            typename DestPointerType, typename EdgePredicate>
+            typename DestPointerType, typename EdgePredicate,
+            typename Transform>
   static SYCL_BLAS_INLINE typename std::enable_if<!internal>::type load(
       const bool in_range, SrcPointerType src, DestPointerType dest,
-      EdgePredicate) {
-    *(dest) = in_range ? *(src) : value_t{0};
+      EdgePredicate, Transform transform) {
+    *(dest) = in_range ? transform(0, value_t(*(src))) : value_t{0};
   }
   /*! @brief Performs a vectorised load using sycl::vec::load when the current
    * block is internal. In the case where k < the
@@ -77,26 +114,95 @@ struct Packetize {
    * @tparam trans Whether the source matrix is transposed or not.
    * @tparam internal True if the current block is internal and no bounds
    * checking is required.
-   * @tparam ld The leading dimension of the destination memory. */
+   * @tparam ld The leading dimension of the destination memory.
+   * @param transform Applied to the elements of the packet which are in range,
+   * see PacketPrologue. */
   template <bool trans, bool internal, index_t ld, typename SrcPointerType,
-            typename DestPointerType, typename EdgePredicate>
+            typename DestPointerType, typename EdgePredicate,
+            typename Transform>
   static SYCL_BLAS_INLINE typename std::enable_if<internal>::type load(
       const bool in_range, SrcPointerType src, DestPointerType dest,
-      EdgePredicate edge_in_range) {
+      EdgePredicate edge_in_range, Transform transform) {
     PacketType packet{0};
 
     if (in_range) {
-      using address_t = cl::sycl::access::address_space;
-      packet.template load<address_t::global_space>(0, src);
+      load_global(packet, src);
+      transform_packet(packet, transform);
     } else {
 #pragma unroll
       for (index_t i = 0; i < packet_size; i++) {
         reinterpret_cast<value_t *>(&packet)[i] =
-            edge_in_range(i) ? *(src + i) : 0;
+            edge_in_range(i) ? transform(i, value_t(*(src + i))) : value_t{0};
       }
     }
     store<trans, ld>(packet, dest);
   }
+
+  /*! @brief Loads a packet from global memory holding elements of type
+   * value_t. */
+  template <int size, typename SrcPointerType>
+  static SYCL_BLAS_INLINE typename std::enable_if<std::is_same<
+      typename PointeeType<SrcPointerType>::type, value_t>::value>::type
+  load_global(cl::sycl::vec<value_t, size> &packet, SrcPointerType src) {
+    using address_t = cl::sycl::access::address_space;
+    packet.template load<address_t::global_space>(0, src);
+  }
+
+  /*! @brief Loads a packet from global memory holding elements of another
+   * type, such as half operands of a GEMM accumulating in float. The packet is
+   * loaded in the storage type and converted in registers. */
+  template <int size, typename SrcPointerType>
+  static SYCL_BLAS_INLINE typename std::enable_if<!std::is_same<
+      typename PointeeType<SrcPointerType>::type, value_t>::value>::type
+  load_global(cl::sycl::vec<value_t, size> &packet, SrcPointerType src) {
+    using address_t = cl::sycl::access::address_space;
+    cl::sycl::vec<typename PointeeType<SrcPointerType>::type, size> stored;
+    stored.template load<address_t::global_space>(0, src);
+    packet = stored.template convert<value_t>();
+  }
+
+  /*! @brief Stores a packet to global memory holding elements of the type
+   * of the packet. The packet holds value_t elements, or the output type of
+   * the epilogue of the GEMM. */
+  template <typename packet_value_t, int size, typename DestPointerType>
+  static SYCL_BLAS_INLINE typename std::enable_if<std::is_same<
+      typename PointeeType<DestPointerType>::type, packet_value_t>::value>::type
+  store_global(const cl::sycl::vec<packet_value_t, size> &packet,
+               DestPointerType dest) {
+    using address_t = cl::sycl::access::address_space;
+    packet.template store<address_t::global_space>(0, dest);
+  }
+
+  /*! @brief Stores a packet to global memory holding elements of another
+   * type, converting it first. */
+  template <typename packet_value_t, int size, typename DestPointerType>
+  static SYCL_BLAS_INLINE typename std::enable_if<!std::is_same<
+      typename PointeeType<DestPointerType>::type, packet_value_t>::value>::type
+  store_global(const cl::sycl::vec<packet_value_t, size> &packet,
+               DestPointerType dest) {
+    using address_t = cl::sycl::access::address_space;
+    packet
+        .template convert<typename PointeeType<DestPointerType>::type>()
+        .template store<address_t::global_space>(0, dest);
+  }
+
+  /*! @brief Applies an identity transform to a loaded packet, which leaves it
+   * untouched so that the vector load is not split into element accesses. */
+  template <int size, typename Transform>
+  static SYCL_BLAS_INLINE typename std::enable_if<Transform::is_identity>::type
+  transform_packet(cl::sycl::vec<value_t, size> &, Transform) {}
+
+  /*! @brief Applies a transform to each element of a loaded packet.
+   * @tparam size The number of elements of the packet. */
+  template <int size, typename Transform>
+  static SYCL_BLAS_INLINE typename std::enable_if<!Transform::is_identity>::type
+  transform_packet(cl::sycl::vec<value_t, size> &packet, Transform transform) {
+#pragma unroll
+    for (index_t i = 0; i < size; i++) {
+      reinterpret_cast<value_t *>(&packet)[i] =
+          transform(i, reinterpret_cast<value_t *>(&packet)[i]);
+    }
+  }
   /*! @brief Store a vector packet into local memory when the source is
    * transposed. This will untranspose the elements individually when storing so
    * the data in local memory is always consistent.
@@ -59,26 +59,38 @@ namespace blas {
  *                   level tiles to use, see Tile
  * @tparam TransA  iff true, matrix A will be transposed on the fly
  * @tparam TransB  iff true, matrix B will be transposed on the fly
- * @tparam element_t  type of matrix elements
+ * @tparam element_t  type the products are accumulated in, which A, B and C
+ *                    are converted from and to when they are stored in
+ *                    another type
  * @tparam is_beta_zero True if beta == 0.
  * @tparam VectorSize The packet size to be used for vectorization.
  * @tparam batch_type the type of batch strideded /interleaved
+ * @tparam epilogue_t applied to the results in registers before they are
+ *                    stored, see GemmEpilogue
+ * @tparam prologue_t applied to the elements of A and B as they are copied
+ *                    from global to local memory, see GemmPrologue
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename TileType, bool TransA, bool TransB,
-          typename element_t, bool is_beta_zero, int VectorSize>
+          typename element_t, bool is_beta_zero, int VectorSize,
+          typename epilogue_t, typename prologue_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
            TransA, TransB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::local),
            static_cast<int>(gemm_algorithm_t::standard),
            static_cast<int>(gemm_vectorization_t::full), VectorSize,
-           static_cast<int>(gemm_batch_type_t::strided)> {
+           static_cast<int>(gemm_batch_type_t::strided), epilogue_t,
+           prologue_t> {
  public:
   using tile_type = TileType;
   using value_t = element_t;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
   using packetize_t = Packetize<VectorSize, value_t, index_t>;
   using vector_t = typename packetize_t::PacketType;
+  using epilogue_value_t =
+      typename EpilogueValueType<epilogue_t, element_t, index_t>::type;
+  using output_vector_t =
+      cl::sycl::vec<epilogue_value_t, packetize_t::packet_size>;
   using address_t = cl::sycl::access::address_space;
 
   // enable easier access to tile dimensions
@@ -150,15 +162,28 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   const element_t alpha_;
   const element_t beta_;
   index_t batch_size_;
+  const index_t stride_a_;
+  const index_t stride_b_;
+  const index_t stride_c_;
+  epilogue_t epilogue_;
+  prologue_t prologue_;
 
   SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
-                        element_t beta, index_t batch_size)
+                        element_t beta, index_t batch_size, index_t stride_a,
+                        index_t stride_b, index_t stride_c,
+                        epilogue_t epilogue = epilogue_t(),
+                        prologue_t prologue = prologue_t())
       : a_(A),
         b_(B),
         c_(C),
         alpha_(alpha),
         beta_(beta / alpha),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        stride_a_(stride_a),
+        stride_b_(stride_b),
+        stride_c_(stride_c),
+        epilogue_(epilogue),
+        prologue_(prologue) {}
 
   /*!
    * @brief Get the type of this GemmFactory as a human readable string.
@@ -235,13 +260,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   template <typename local_memory_t>
   SYCL_BLAS_INLINE void eval(local_memory_t scratch_acc,
                              const cl::sycl::nd_item<1> &id) noexcept {
-    index_t m = a_.get_size_row();
-    index_t n = b_.get_size_col();
-    index_t k = a_.get_size_col();
-
-    const index_t lda = a_.getSizeL();
-    const index_t ldb = b_.getSizeL();
-    const index_t ldc = c_.getSizeL();
+    const index_t m = a_.get_size_row();
+    const index_t n = b_.get_size_col();
     // The batch index that each workgroup should start working with
     const index_t wg_batch_id = id.get_group(0) / get_workgroup_cluster();
     // This will disable all workgroups that dont have any batch to work on
@@ -251,23 +271,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     const index_t batch_stride =
         id.get_group_range(0) / get_workgroup_cluster();
 
-    auto scratch = scratch_acc.localAcc.get_pointer();
-    using ScratchPointerType = decltype(scratch);
     // The number of work-group required to executed each batch efficiently
     const index_t wg_id = id.get_group(0) % get_workgroup_cluster();
-
-    const index_t a_size = trans_a ? m * lda : k * lda;
-    const index_t b_size = trans_b ? ldb * k : n * ldb;
-    const index_t c_size = ldc * n;
-
-    auto ptr_A = a_.get_data().get_pointer() + a_.get_access_displacement() +
-                 (wg_batch_id * a_size);
-    auto ptr_B = b_.get_data().get_pointer() + b_.get_access_displacement() +
-                 (wg_batch_id * b_size);
-    auto ptr_C = c_.get_data().get_pointer() + c_.get_access_displacement() +
-                 (wg_batch_id * c_size);
-
-    const index_t item_id = id.get_local_id(0);
     const index_t tile_id = wg_id / tile_size;
     const index_t tile_local_id = wg_id % tile_size;
     const index_t tiles_per_col = (m - 1) / big_tile_rows + 1;
@@ -275,6 +280,40 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     const index_t tile_col = (tile_id / tiles_per_col) * tl_cols;
     const index_t wg_row = (tile_row + tile_local_id % tl_rows) * block_rows;
     const index_t wg_col = (tile_col + tile_local_id / tl_rows) * block_rows;
+
+    compute_block(scratch_acc, id, m, n, a_.get_size_col(), a_.getSizeL(),
+                  b_.getSizeL(), c_.getSizeL(), wg_row, wg_col,
+                  wg_batch_id * stride_a_, wg_batch_id * stride_b_,
+                  wg_batch_id * stride_c_, batch_stride, wg_batch_id,
+                  batch_size_);
+  }
+
+  /*!
+   * @brief Computes the block of C of the work group, starting at row wg_row
+   * and column wg_col, for a GEMM of m by n by k elements whose matrices start
+   * offset_a, offset_b and offset_c elements into a_, b_ and c_. The batches
+   * from wg_batch_id to batch_size are computed batch_stride apart.
+   *
+   * Besides eval, GemmGrouped and GemmStreamK compute their blocks with it.
+   * The positions given to the epilogue and the prologue are relative to the
+   * sizes of a_ and b_, so such trees use the identity ones.
+   */
+  template <typename local_memory_t>
+  SYCL_BLAS_INLINE void compute_block(
+      local_memory_t scratch_acc, const cl::sycl::nd_item<1> &id, index_t m,
+      index_t n, index_t k, index_t lda, index_t ldb, index_t ldc,
+      index_t wg_row, index_t wg_col, index_t offset_a, index_t offset_b,
+      index_t offset_c, index_t batch_stride, index_t wg_batch_id,
+      index_t batch_size) noexcept {
+    auto scratch = scratch_acc.localAcc.get_pointer();
+    auto ptr_A = a_.get_data().get_pointer() + a_.get_access_displacement() +
+                 offset_a;
+    auto ptr_B = b_.get_data().get_pointer() + b_.get_access_displacement() +
+                 offset_b;
+    auto ptr_C = c_.get_data().get_pointer() + c_.get_access_displacement() +
+                 offset_c;
+
+    const index_t item_id = id.get_local_id(0);
     const bool out_of_range = (wg_row >= m || wg_col >= n);
     const bool internal = m - wg_row >= block_rows && n - wg_col >= block_cols;
     const index_t vector_offset = internal ? packetize_t::packet_size : 1;
@@ -319,14 +358,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 
     if (internal) {
       compute_panel_gemm<double_buffer, false, false>(
-          id, item_id, m, n, k, mc, nc, a_size, b_size, c_size, ptr_A, lda,
-          ptr_B, ldb, ptr_C, ldc, s1, s2, s3, s4, reg_a, reg_b, out_of_range,
-          batch_stride, wg_batch_id, batch_size_);
+          id, item_id, m, n, k, mc, nc, ptr_A, lda, ptr_B, ldb, ptr_C, ldc, s1,
+          s2, s3, s4, reg_a, reg_b, out_of_range, batch_stride, wg_batch_id,
+          batch_size);
     } else {
       compute_panel_gemm<double_buffer, true, true>(
-          id, item_id, m, n, k, mc, nc, a_size, b_size, c_size, ptr_A, lda,
-          ptr_B, ldb, ptr_C, ldc, s1, s2, s3, s4, reg_a, reg_b, out_of_range,
-          batch_stride, wg_batch_id, batch_size_);
+          id, item_id, m, n, k, mc, nc, ptr_A, lda, ptr_B, ldb, ptr_C, ldc, s1,
+          s2, s3, s4, reg_a, reg_b, out_of_range, batch_stride, wg_batch_id,
+          batch_size);
     }
   }
 
@@ -334,11 +373,15 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     a_.bind(h);
     b_.bind(h);
     c_.bind(h);
+    epilogue_.bind(h);
+    prologue_.bind(h);
   }
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
     c_.adjust_access_displacement();
+    epilogue_.adjust_access_displacement();
+    prologue_.adjust_access_displacement();
   }
   SYCL_BLAS_INLINE bool valid_thread(const cl::sycl::nd_item<1> &ndItem) const {
     return true;
@@ -369,7 +412,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 #pragma unroll
           for (index_t l = 0; l < offset; ++l) {
             reg_res[i * item_rows + j * offset + l] =
-                beta_ * *(C + j * (wg_rows * offset) + l);
+                beta_ * element_t(*(C + j * (wg_rows * offset) + l));
           }
         }
       }
@@ -407,8 +450,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   SYCL_BLAS_INLINE void compute_panel_gemm(
       const cl::sycl::nd_item<1> &id, const index_t &item_id, const index_t &m,
       const index_t &n, const index_t &orig_k, const index_t &mc,
-      const index_t &nc, const index_t &a_size, const index_t &b_size,
-      const index_t &c_size, InputPointerType orig_A, const index_t &lda,
+      const index_t &nc, InputPointerType orig_A, const index_t &lda,
       InputPointerType orig_B, const index_t &ldb, OutputPointerType orig_C,
       const index_t &ldc, ScratchPointerType s1, ScratchPointerType s2,
       ScratchPointerType s3, ScratchPointerType s4, element_t *reg_a,
@@ -451,9 +493,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
       // store the output
       store_output_block<check_m_limit, check_n_limit>(item_id, mc, nc, C, ldc,
                                                        reg_res, out_of_range);
-      orig_A += (a_size * batch_stride);
-      orig_B += (b_size * batch_stride);
-      orig_C += (c_size * batch_stride);
+      orig_A += (stride_a_ * batch_stride);
+      orig_B += (stride_b_ * batch_stride);
+      orig_C += (stride_c_ * batch_stride);
       // batch_size_ must be signed as the negative value has meaning here.
       batch_size -= batch_stride;
     } while (batch_size > wg_batch_id);
@@ -462,20 +504,42 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   template <bool internal, index_t p_size = packetize_t::packet_size,
             typename OutputPointerType>
   SYCL_BLAS_INLINE typename std::enable_if<!internal>::type store_packet(
-      element_t *reg, OutputPointerType out_ptr) {
-    *out_ptr = alpha_ * (*reg);
+      element_t *reg, OutputPointerType out_ptr, index_t row, index_t col) {
+    *out_ptr = epilogue_.eval(alpha_ * (*reg), row, col);
   }
 
   template <bool internal, index_t p_size = packetize_t::packet_size,
             typename OutputPointerType>
   SYCL_BLAS_INLINE typename std::enable_if<internal>::type store_packet(
-      element_t *reg, OutputPointerType out_ptr) {
-    vector_t out_vec{0};
+      element_t *reg, OutputPointerType out_ptr, index_t row, index_t col) {
+    output_vector_t out_vec{0};
+
+    load_output_packet(out_vec, reg, row, col);
 
+    packetize_t::store_global(out_vec, out_ptr);
+  }
+
+  /*!
+   * @brief Loads a packet of results scaled by alpha in out_vec. The packet
+   * holds consecutive rows of column col of C, starting at row.
+   */
+  template <bool identity = epilogue_t::is_identity>
+  SYCL_BLAS_INLINE typename std::enable_if<identity>::type load_output_packet(
+      output_vector_t &out_vec, element_t *reg, index_t, index_t) {
     out_vec.template load<address_t::private_space>(0, reg);
     out_vec *= alpha_;
+  }
 
-    out_vec.template store<address_t::global_space>(0, out_ptr);
+  template <bool identity = epilogue_t::is_identity>
+  SYCL_BLAS_INLINE typename std::enable_if<!identity>::type load_output_packet(
+      output_vector_t &out_vec, element_t *reg, index_t row, index_t col) {
+    // The epilogue works on single elements, and its results may be of another
+    // type than the registers, such as requantized integers
+#pragma unroll
+    for (index_t l = 0; l < packetize_t::packet_size; ++l) {
+      reinterpret_cast<epilogue_value_t *>(&out_vec)[l] =
+          epilogue_.eval(alpha_ * reg[l], row + l, col);
+    }
   }
   /*!
    * @brief Store the computed gemm result to the C matrix
@@ -505,6 +569,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     }
     constexpr index_t offset =
         (!check_m_limit && !check_n_limit) ? packetize_t::packet_size : 1;
+    // Position in C of the first element of the item, for the epilogue
+    const index_t row = a_.get_size_row() - mc;
+    const index_t col = b_.get_size_col() - nc;
 #pragma unroll
     for (index_t i = 0; i < item_cols; ++i) {
 #pragma unroll
@@ -515,7 +582,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 
         if (in_range) {
           store_packet<!check_m_limit && !check_n_limit>(
-              reg_res, C + j * (wg_rows * offset));
+              reg_res, C + j * (wg_rows * offset),
+              row + j * (wg_rows * offset), col + i);
         }
         reg_res += offset;
       }
@@ -538,18 +606,32 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
       return;
     }
 
+    // The position lambdas give the row and the column in op(A) and op(B) of
+    // the elements checked by the predicates, for the prologue
     extract_block<!check_m_limit && !check_n_limit, check_m_limit,
-                  check_k_limit, trans_a, block_rows, cl_elems, ldsa>(
+                  check_k_limit, trans_a, block_rows, cl_elems, ldsa, true>(
         item_id, A, lda, sA,
         [&](index_t ir, index_t cr) SYCL_BLAS_ALWAYS_INLINE { return cr < m; },
         [&](index_t ic, index_t cc)
-            SYCL_BLAS_ALWAYS_INLINE { return cc < k - ic; });
+            SYCL_BLAS_ALWAYS_INLINE { return cc < k - ic; },
+        [&](index_t ir, index_t cr) SYCL_BLAS_ALWAYS_INLINE {
+          return a_.get_size_row() - m + cr;
+        },
+        [&](index_t ic, index_t cc) SYCL_BLAS_ALWAYS_INLINE {
+          return a_.get_size_col() - k + ic + cc;
+        });
     extract_block<!check_m_limit && !check_n_limit, check_k_limit,
-                  check_n_limit, trans_b, cl_elems, block_cols, ldsb>(
+                  check_n_limit, trans_b, cl_elems, block_cols, ldsb, false>(
         item_id, B, ldb, sB,
         [&](index_t ir, index_t cr)
             SYCL_BLAS_ALWAYS_INLINE { return cr < k - ir; },
-        [&](index_t ic, index_t cc) SYCL_BLAS_ALWAYS_INLINE { return cc < n; });
+        [&](index_t ic, index_t cc) SYCL_BLAS_ALWAYS_INLINE { return cc < n; },
+        [&](index_t ir, index_t cr) SYCL_BLAS_ALWAYS_INLINE {
+          return b_.get_size_row() - k + ir + cr;
+        },
+        [&](index_t ic, index_t cc) SYCL_BLAS_ALWAYS_INLINE {
+          return b_.get_size_col() - n + cc;
+        });
   }
 
   /*!
@@ -569,8 +651,11 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
    * @tparam InputPointerType  pointer type of the input matrix
    * @tparam ScratchPointerType  pointer type of the memory used to store
    * the extracted block
+   * @tparam operand_a  true when the block is extracted from A, false for B
    * @tparam RowPredicate  row out-of-bound condition type
    * @tparam ColPredicate  column out-of-bound condition type
+   * @tparam RowPosition  row position type
+   * @tparam ColPosition  column position type
    *
    * @param item_id  id of the work item which called this method
    * @param ptr  pointer to the input matrix with proper item-dependent
@@ -583,14 +668,20 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
    *                matrix bounds
    * @param in_col  a predicate which checks whether a col index is within
    *                matrix bounds
+   * @param row_pos  gives the row of an element in op(A) or op(B), taking
+   *                 the same arguments as in_row
+   * @param col_pos  gives the column of an element in op(A) or op(B), taking
+   *                 the same arguments as in_col
    */
   template <bool internal, bool check_row_limit, bool check_col_limit,
             bool trans, index_t rows, index_t cols, index_t lds,
-            typename InputPointerType, typename ScratchPointerType,
-            typename RowPredicate, typename ColPredicate>
+            bool operand_a, typename InputPointerType,
+            typename ScratchPointerType, typename RowPredicate,
+            typename ColPredicate, typename RowPosition, typename ColPosition>
   SYCL_BLAS_INLINE typename std::enable_if<!trans>::type extract_block(
       index_t item_id, InputPointerType ptr, index_t ld,
-      ScratchPointerType scratch, RowPredicate in_row, ColPredicate in_col) {
+      ScratchPointerType scratch, RowPredicate in_row, ColPredicate in_col,
+      RowPosition row_pos, ColPosition col_pos) {
     constexpr index_t bs = rows * cols;
     constexpr index_t multiplier = internal ? packetize_t::packet_size : 1;
 #pragma unroll
@@ -605,21 +696,27 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
           do_check<check_col_limit>(
               in_col((item_id * multiplier / rows), col_ofs));
 
+      const PacketPrologue<operand_a, true, prologue_t, index_t> prologue{
+          prologue_, row_pos((item_id * multiplier) % rows, 0),
+          col_pos((item_id * multiplier) / rows, col_ofs)};
       packetize_t::template load<trans, internal, lds>(
           in_range, ptr + col_ofs * ld, scratch + col_ofs * lds,
           [&](const index_t &ofs) {
             return in_row((item_id * multiplier) % rows, ofs) &&
                    in_col((item_id * multiplier) / rows, col_ofs);
-          });
+          },
+          prologue);
     }
   }
   template <bool internal, bool check_row_limit, bool check_col_limit,
             bool trans, index_t rows, index_t cols, index_t lds,
-            typename InputPointerType, typename ScratchPointerType,
-            typename RowPredicate, typename ColPredicate>
+            bool operand_a, typename InputPointerType,
+            typename ScratchPointerType, typename RowPredicate,
+            typename ColPredicate, typename RowPosition, typename ColPosition>
   SYCL_BLAS_INLINE typename std::enable_if<trans>::type extract_block(
       index_t item_id, InputPointerType ptr, index_t ld,
-      ScratchPointerType scratch, RowPredicate in_row, ColPredicate in_col) {
+      ScratchPointerType scratch, RowPredicate in_row, ColPredicate in_col,
+      RowPosition row_pos, ColPosition col_pos) {
     const index_t bs = rows * cols;
     constexpr index_t multiplier = internal ? packetize_t::packet_size : 1;
 #pragma unroll
@@ -633,12 +730,16 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
                             do_check<check_col_limit>(in_col(
                                 (item_id * multiplier) % cols, multiplier - 1));
 
+      const PacketPrologue<operand_a, false, prologue_t, index_t> prologue{
+          prologue_, row_pos((item_id * multiplier) / cols, row_ofs),
+          col_pos((item_id * multiplier) % cols, 0)};
       packetize_t::template load<trans, internal, lds>(
           in_range, ptr + row_ofs * ld, scratch + row_ofs,
           [&](const index_t &ofs) SYCL_BLAS_ALWAYS_INLINE {
             return in_col((item_id * multiplier) % cols, ofs) &&
                    in_row((item_id * multiplier) / cols, row_ofs);
-          });
+          },
+          prologue);
     }
   }
 
@@ -682,7 +783,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 #pragma unroll
         for (index_t l = 0; l < item_rows; ++l) {
           reg_res[j * item_rows + l] =
-              cl::sycl::mad(reg_a[l], reg_b, reg_res[j * item_rows + l]);
+              gemm_mad(reg_a[l], reg_b, reg_res[j * item_rows + l]);
         }
       }
       A = A + ldsa;
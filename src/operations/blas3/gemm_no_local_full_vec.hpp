@@ -50,22 +50,33 @@ namespace blas {
  *                   level tiles to use, see Tile
  * @tparam TransA  iff true, matrix A will be transposed on the fly
  * @tparam TransB  iff true, matrix B will be transposed on the fly
- * @tparam element_t  type of matrix elements
+ * @tparam element_t  type the products are accumulated in, A, B and C are
+ *                    converted from and to it when they are stored in
+ *                    another type
+ * @tparam epilogue_t  applied to the results in registers before they are
+ *                     stored, see GemmEpilogue
+ * @tparam prologue_t  applied to the elements of A and B as they are loaded
+ *                     into registers, see GemmPrologue
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
-          typename element_t, bool is_beta_zero, int VectorSize>
+          typename element_t, bool is_beta_zero, int VectorSize,
+          typename epilogue_t, typename prologue_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::no_local),
            static_cast<int>(gemm_algorithm_t::standard),
            static_cast<int>(gemm_vectorization_t::full), VectorSize,
-           static_cast<int>(gemm_batch_type_t::strided)> {
+           static_cast<int>(gemm_batch_type_t::strided), epilogue_t,
+           prologue_t> {
  public:
   using value_t = element_t;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
   using address_t = cl::sycl::access::address_space;
   using packetize_t = Packetize<VectorSize, value_t, index_t>;
+  /*! @brief The type of the results once passed through the epilogue */
+  using epilogue_value_t =
+      typename EpilogueValueType<epilogue_t, element_t, index_t>::type;
   static constexpr int local_memory_size = 0;
   /*! @brief The number of rows processed by each work item */
   static constexpr index_t item_rows = tile_type::item_rows;
@@ -106,14 +117,27 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   const element_t alpha_;
   const element_t beta_;
   index_t batch_size_;
+  const index_t stride_a_;
+  const index_t stride_b_;
+  const index_t stride_c_;
+  epilogue_t epilogue_;
+  prologue_t prologue_;
   SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
-                        element_t beta, index_t batch_size)
+                        element_t beta, index_t batch_size, index_t stride_a,
+                        index_t stride_b, index_t stride_c,
+                        epilogue_t epilogue = epilogue_t(),
+                        prologue_t prologue = prologue_t())
       : a_(A),
         b_(B),
         c_(C),
         alpha_(alpha),
         beta_(beta / alpha_),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        stride_a_(stride_a),
+        stride_b_(stride_b),
+        stride_c_(stride_c),
+        epilogue_(epilogue),
+        prologue_(prologue) {}
 
   /*!
    * @brief Get the type of this Gemm as a human readable string.
@@ -170,14 +194,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   }
 
   SYCL_BLAS_INLINE void eval(cl::sycl::nd_item<1> id) noexcept {
-    index_t m = a_.get_size_row();
-    index_t n = b_.get_size_col();
-    const index_t original_m = m;
-    const index_t original_n = n;
-    const index_t k = a_.get_size_col();
-    const index_t lda = a_.getSizeL();
-    const index_t ldb = b_.getSizeL();
-    const index_t ldc = c_.getSizeL();
+    const index_t m = a_.get_size_row();
+    const index_t n = b_.get_size_col();
 
     // The batch index that each workgroup should start working with
     const index_t wg_batch_id = id.get_group(0) / get_workgroup_cluster();
@@ -189,20 +207,10 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     const index_t batch_stride =
         id.get_group_range(0) / get_workgroup_cluster();
 
-    const index_t a_size = trans_a ? m * lda : k * lda;
-    const index_t b_size = trans_b ? ldb * k : n * ldb;
-    const index_t c_size = ldc * n;
-
-    auto orig_A = a_.get_pointer() + (wg_batch_id * a_size);
-    auto orig_B = b_.get_pointer() + (wg_batch_id * b_size);
-    auto orig_C = c_.get_pointer() + (wg_batch_id * c_size);
-
     const index_t number_of_block_per_row = ((m - 1) / block_rows) + 1;
     /* linear work group id The number of work-group required to executed each
      * batch efficiently*/
     const index_t wg_id = id.get_group(0) % get_workgroup_cluster();
-    /* linear work item id */
-    const index_t item_id = id.get_local_id(0);
     /* row tile id  per work group */
     const index_t tile_id_row = wg_id % number_of_block_per_row;
     /* column tile id per work group */
@@ -211,6 +219,35 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     const index_t wg_row = tile_id_row * block_rows;
     /* the start position of the tile-column per work group */
     const index_t wg_col = tile_id_col * block_cols;
+
+    compute_block(id, m, n, a_.get_size_col(), a_.getSizeL(), b_.getSizeL(),
+                  c_.getSizeL(), wg_row, wg_col, wg_batch_id * stride_a_,
+                  wg_batch_id * stride_b_, wg_batch_id * stride_c_,
+                  batch_stride, wg_batch_id, batch_size_);
+  }
+
+  /*!
+   * @brief Computes the block of C of the work group, starting at row wg_row
+   * and column wg_col, for a GEMM of m by n by k elements whose matrices start
+   * offset_a, offset_b and offset_c elements into a_, b_ and c_. The batches
+   * from wg_batch_id to batch_size are computed batch_stride apart.
+   *
+   * Besides eval, GemmGrouped and GemmStreamK compute their blocks with it.
+   */
+  SYCL_BLAS_INLINE void compute_block(
+      const cl::sycl::nd_item<1> &id, index_t m, index_t n, const index_t k,
+      const index_t lda, const index_t ldb, const index_t ldc,
+      const index_t wg_row, const index_t wg_col, const index_t offset_a,
+      const index_t offset_b, const index_t offset_c,
+      const index_t batch_stride, const index_t wg_batch_id,
+      const index_t batch_size) noexcept {
+    const index_t original_m = m;
+    const index_t original_n = n;
+    auto orig_A = a_.get_pointer() + offset_a;
+    auto orig_B = b_.get_pointer() + offset_b;
+    auto orig_C = c_.get_pointer() + offset_c;
+    /* linear work item id */
+    const index_t item_id = id.get_local_id(0);
     /*!
      * @brief is_internal_block is used to distinguish
      * the internal block. Therefore, work items using these blocks don't need
@@ -274,10 +311,10 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
      */
     if ((is_internal_block == true)) {
       compute_gemm_no_shared_pannel<false, packetize_t::packet_size>(
-          orig_A, orig_B, orig_C, a_size, b_size, c_size, a_.get_size_col(), k,
-          dim_m_a_start, dim_n_b_start, A_ptr_index, B_ptr_index,
-          boundary_check_m, boundary_check_n, boundary_check_c, out_of_range,
-          batch_stride, wg_batch_id, batch_size_, lda, ldb, ldc
+          orig_A, orig_B, orig_C, k, k, dim_m_a_start, dim_n_b_start,
+          A_ptr_index, B_ptr_index, boundary_check_m, boundary_check_n,
+          boundary_check_c, out_of_range, batch_stride, wg_batch_id,
+          batch_size, lda, ldb, ldc
 #ifdef ARM_GPU
           ,
           id
@@ -285,10 +322,10 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       );
     } else {
       compute_gemm_no_shared_pannel<true, 1>(
-          orig_A, orig_B, orig_C, a_size, b_size, c_size, a_.get_size_col(), k,
-          dim_m_a_start, dim_n_b_start, A_ptr_index, B_ptr_index,
-          boundary_check_m, boundary_check_n, boundary_check_c, out_of_range,
-          batch_stride, wg_batch_id, batch_size_, lda, ldb, ldc
+          orig_A, orig_B, orig_C, k, k, dim_m_a_start, dim_n_b_start,
+          A_ptr_index, B_ptr_index, boundary_check_m, boundary_check_n,
+          boundary_check_c, out_of_range, batch_stride, wg_batch_id,
+          batch_size, lda, ldb, ldc
 #ifdef ARM_GPU
           ,
           id
@@ -317,8 +354,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
                 dim_m_c_start + j * wg_rows, dim_n_c_start + i * wg_cols))) {
           cl::sycl::vec<element_t, packet_size> out_vec{0};
 
-          out_vec.template load<address_t::global_space>(
-              0, C + j * wg_rows * packet_size);
+          packetize_t::load_global(out_vec, C + j * wg_rows * packet_size);
           out_vec *= beta_;
 
           out_vec.template store<address_t::private_space>(
@@ -345,8 +381,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
             typename B_t, typename C_t, typename check_boundary_m_t,
             typename check_boundary_n_t, typename check_boundary_c_t>
   SYCL_BLAS_INLINE void compute_gemm_no_shared_pannel(
-      A_t orig_A, B_t orig_B, C_t orig_C, const index_t &a_size,
-      const index_t &b_size, const index_t &c_size, index_t orig_k, index_t k,
+      A_t orig_A, B_t orig_B, C_t orig_C, index_t orig_k, index_t k,
       const index_t &dim_m_a_start, const index_t &dim_n_b_start,
       const index_t &A_ptr_index, const index_t &B_ptr_index,
       const check_boundary_m_t &boundary_check_m,
@@ -377,7 +412,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       while (k >= packet_size) {
         load_and_compute_block<packet_size, need_check_boundary, false>(
             A, B, boundary_check_m, boundary_check_n, A_ptr_index, B_ptr_index,
-            lda, ldb, k, reg_a, reg_b, reg_res, out_of_range
+            lda, ldb, k, dim_m_a_start, dim_n_b_start, orig_k - k, reg_a,
+            reg_b, reg_res, out_of_range
 #ifdef ARM_GPU
             ,
             id
@@ -393,7 +429,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       if (k > 0) {
         load_and_compute_block<packet_size, need_check_boundary, true>(
             A, B, boundary_check_m, boundary_check_n, A_ptr_index, B_ptr_index,
-            lda, ldb, k, reg_a, reg_b, reg_res, out_of_range
+            lda, ldb, k, dim_m_a_start, dim_n_b_start, orig_k - k, reg_a,
+            reg_b, reg_res, out_of_range
 #ifdef ARM_GPU
             ,
             id
@@ -407,9 +444,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
                                               dim_n_b_start, boundary_check_c,
                                               out_of_range, ldc);
 
-      orig_A += (a_size * batch_stride);
-      orig_B += (b_size * batch_stride);
-      orig_C += (c_size * batch_stride);
+      orig_A += (stride_a_ * batch_stride);
+      orig_B += (stride_b_ * batch_stride);
+      orig_C += (stride_c_ * batch_stride);
       k = orig_k;
       // batch_size_ must be signed as the negative value has meaning here.
       batch_size -= batch_stride;
@@ -423,12 +460,16 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     a_.bind(h);
     b_.bind(h);
     c_.bind(h);
+    epilogue_.bind(h);
+    prologue_.bind(h);
   }
 
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
     c_.adjust_access_displacement();
+    epilogue_.adjust_access_displacement();
+    prologue_.adjust_access_displacement();
   }
 
  private:
@@ -453,6 +494,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
    * @param ldb : leading dimension of B
    * @param k : the current value of K from the main loop which calls this
    * method.
+   * @param dim_m_a_start : the first row of op(A) loaded by the work item.
+   * @param dim_n_b_start : the first column of op(B) loaded by the work item.
+   * @param dim_k_start : the first column of op(A) and row of op(B) loaded.
    * @param reg_a : Pointer to private register for A.
    * @param reg_b : Pointer to private register for B.
    * @param reg_res : Pointer to private register for result.
@@ -465,8 +509,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       PointerType A, PointerType B, BoundaryCheckM boundary_check_m,
       BoundaryCheckN boundary_check_n, const index_t &A_ptr_index,
       const index_t &B_ptr_index, const index_t &lda, const index_t &ldb,
-      const index_t &k, element_t *reg_a, element_t *reg_b, element_t *reg_res,
-      bool out_of_range
+      const index_t &k, const index_t &dim_m_a_start,
+      const index_t &dim_n_b_start, const index_t &dim_k_start,
+      element_t *reg_a, element_t *reg_b, element_t *reg_res, bool out_of_range
 #ifdef ARM_GPU
       ,
       const cl::sycl::nd_item<1> &id
@@ -479,7 +524,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
                  check_k, packet_size, trans_a>(
         A, reg_a, A_ptr_index, lda, boundary_check_m,
         [=](const index_t &idx) SYCL_BLAS_ALWAYS_INLINE { return idx < k; },
-        out_of_range);
+        dim_m_a_start, dim_k_start, out_of_range);
 #ifdef ARM_GPU
     id.barrier(cl::sycl::access::fence_space::local_space);
 #endif
@@ -496,7 +541,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
         load_single_b<check_k, check_boundary, packet_size, trans_b>(
             B + ofs, reg_b, j, col_ofs,
             [=](const index_t &idx) SYCL_BLAS_ALWAYS_INLINE { return idx < k; },
-            boundary_check_n, out_of_range);
+            boundary_check_n, dim_k_start,
+            dim_n_b_start + col_ofs + (trans_b ? 0 : j * wg_cols),
+            out_of_range);
 
         /*
          * Computing a partial GEMM for the loaded block of reg_a and partial
@@ -541,6 +588,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
    * direction.
    * @param is_valid_col : function which checks the boundary in the col
    * direction.
+   * @param row : the row in op(A) of the element at ptr.
+   * @param col : the column in op(A) of the element at ptr.
    * @param out_of_range: exits the function early if block is out of range.
    */
 
@@ -550,7 +599,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   SYCL_BLAS_INLINE typename std::enable_if<!trans>::type load_block_a(
       PointerType ptr, element_t *reg, const index_t &ptr_next,
       const index_t &ld, const RowCheckType &is_valid_row,
-      const ColCheckType &is_valid_col, const bool out_of_range) noexcept {
+      const ColCheckType &is_valid_col, const index_t &row, const index_t &col,
+      const bool out_of_range) noexcept {
     if (out_of_range) {
       return;
     }
@@ -559,22 +609,26 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
 #pragma unroll
       for (int j = 0; j < rows / work_per_load; j++) {
         // Check that the last element of the packet loaded is in range
-        bool in_range = do_check<check_row>(is_valid_row(work_per_load - 1)) &&
+        bool in_range = do_check<check_row>(is_valid_row(
+                            j * next_element + work_per_load - 1)) &&
                         do_check<check_col>(is_valid_col(i));
+        const PacketPrologue<true, true, prologue_t, index_t> prologue{
+            prologue_, row + j * next_element, col + i};
 
         cl::sycl::vec<element_t, work_per_load> in_vec{0};
         if (in_range) {
           // if in range perform a vectorised load
-          in_vec.template load<address_t::global_space>(0, ptr + j * ptr_next);
+          packetize_t::load_global(in_vec, ptr + j * ptr_next);
+          packetize_t::transform_packet(in_vec, prologue);
         } else {
           // if not in range perform element-wise load checking boundaries at
           // each load.
 #pragma unroll
           for (int l = 0; l < work_per_load; l++) {
-            if (do_check<check_row>(is_valid_row(l)) &&
+            if (do_check<check_row>(is_valid_row(j * next_element + l)) &&
                 do_check<check_col>(is_valid_col(i))) {
               reinterpret_cast<element_t *>(&in_vec)[l] =
-                  *(ptr + j * ptr_next + l);
+                  prologue(l, element_t(*(ptr + j * ptr_next + l)));
             }
           }
         }
@@ -615,6 +669,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
    * direction.
    * @param is_valid_col : function which checks the boundary in the col
    * direction.
+   * @param row : the row in op(A) of the element at ptr.
+   * @param col : the column in op(A) of the element at ptr.
    * @param out_of_range: exits the function early if block is out of range.
    */
   template <index_t rows, index_t cols, index_t next_element, bool check_row,
@@ -623,7 +679,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   SYCL_BLAS_INLINE typename std::enable_if<trans>::type load_block_a(
       PointerType ptr, element_t *reg, const index_t &ptr_next,
       const index_t &ld, const RowCheckType &is_valid_row,
-      const ColCheckType &is_valid_col, const bool out_of_range) noexcept {
+      const ColCheckType &is_valid_col, const index_t &row, const index_t &col,
+      const bool out_of_range) noexcept {
     if (out_of_range) {
       return;
     }
@@ -635,11 +692,13 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
         bool in_range =
             do_check<check_row>(is_valid_row(i * next_element + j)) &&
             do_check<check_col>(is_valid_col(work_per_load - 1));
+        const PacketPrologue<true, false, prologue_t, index_t> prologue{
+            prologue_, row + i * next_element + j, col};
         cl::sycl::vec<element_t, work_per_load> in_vec{0};
         if (in_range) {
           // if in range perform a vectorised load
-          in_vec.template load<address_t::global_space>(0, ptr + j * ld);
-
+          packetize_t::load_global(in_vec, ptr + j * ld);
+          packetize_t::transform_packet(in_vec, prologue);
         } else {
           // if not in range perform element-wise load checking boundaries at
           // each load.
@@ -647,7 +706,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
           for (int l = 0; l < work_per_load; l++) {
             if (do_check<check_row>(is_valid_row(i * next_element + j)) &&
                 do_check<check_col>(is_valid_col(l))) {
-              reinterpret_cast<element_t *>(&in_vec)[l] = *(ptr + j * ld + l);
+              reinterpret_cast<element_t *>(&in_vec)[l] =
+                  prologue(l, element_t(*(ptr + j * ld + l)));
             }
           }
         }
@@ -691,6 +751,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
    * direction.
    * @param is_valid_col : function which checks the boundary in the col
    * direction.
+   * @param row : the row in op(B) of the element at ptr.
+   * @param col : the column in op(B) of the element at ptr.
    * @param out_of_range: exits the function early if block is out of range.
    */
   template <bool check_row, bool check_col, index_t work_per_load, bool trans,
@@ -698,7 +760,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   SYCL_BLAS_INLINE typename std::enable_if<!trans>::type load_single_b(
       PointerType ptr, element_t *reg, const index_t &row_ofs,
       const index_t &col_ofs, const RowCheckType &is_valid_row,
-      const ColCheckType &is_valid_col, const bool out_of_range) noexcept {
+      const ColCheckType &is_valid_col, const index_t &row, const index_t &col,
+      const bool out_of_range) noexcept {
     if (out_of_range) {
       return;
     }
@@ -706,18 +769,22 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     // Check that the last element of the packet loaded is in range
     bool in_range = do_check<check_row>(is_valid_row(work_per_load - 1)) &&
                     do_check<check_col>(is_valid_col(col_ofs));
+    const PacketPrologue<false, true, prologue_t, index_t> prologue{
+        prologue_, row, col};
 
     cl::sycl::vec<element_t, work_per_load> in_vec{0};
     if (in_range) {
       // If in range perform a vectorised load.
-      in_vec.template load<address_t::global_space>(0, ptr);
+      packetize_t::load_global(in_vec, ptr);
+      packetize_t::transform_packet(in_vec, prologue);
     } else {
       // Otherwise perform an element-wise load, checking boundaries each load.
 #pragma unroll
       for (int k = 0; k < work_per_load; k++) {
         if (do_check<check_row>(is_valid_row(k)) &&
             do_check<check_col>(is_valid_col(col_ofs))) {
-          reinterpret_cast<element_t *>(&in_vec)[k] = *(ptr + k);
+          reinterpret_cast<element_t *>(&in_vec)[k] =
+              prologue(k, element_t(*(ptr + k)));
         }
       }
     }
@@ -751,6 +818,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
    * direction.
    * @param is_valid_col : function which checks the boundary in the col
    * direction.
+   * @param row : the row in op(B) of the element at ptr.
+   * @param col : the column in op(B) of the element at ptr.
    * @param out_of_range: exits the function early if block is out of range.
    */
   template <bool check_row, bool check_col, index_t work_per_load, bool trans,
@@ -758,26 +827,32 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   SYCL_BLAS_INLINE typename std::enable_if<trans>::type load_single_b(
       PointerType ptr, element_t *reg, const index_t &row_ofs,
       const index_t &col_ofs, const RowCheckType &is_valid_row,
-      const ColCheckType &is_valid_col, const bool out_of_range) noexcept {
+      const ColCheckType &is_valid_col, const index_t &row, const index_t &col,
+      const bool out_of_range) noexcept {
     if (out_of_range) {
       return;
     }
 
     // Check that the last element of the packet loaded is in range
-    bool in_range = do_check<check_row>(is_valid_row(row_ofs)) &&
-                    do_check<check_col>(is_valid_col(work_per_load - 1));
+    bool in_range =
+        do_check<check_row>(is_valid_row(row_ofs)) &&
+        do_check<check_col>(is_valid_col(col_ofs + work_per_load - 1));
+    const PacketPrologue<false, false, prologue_t, index_t> prologue{
+        prologue_, row + row_ofs, col};
 
     cl::sycl::vec<element_t, work_per_load> in_vec{0};
     if (in_range) {
       // If in range perform a vectorised load.
-      in_vec.template load<address_t::global_space>(0, ptr);
+      packetize_t::load_global(in_vec, ptr);
+      packetize_t::transform_packet(in_vec, prologue);
     } else {
       // Otherwise perform an element-wise load, checking boundaries each load.
 #pragma unroll
       for (int k = 0; k < work_per_load; k++) {
         if (do_check<check_row>(is_valid_row(row_ofs)) &&
-            do_check<check_col>(is_valid_col(k))) {
-          reinterpret_cast<element_t *>(&in_vec)[k] = *(ptr + k);
+            do_check<check_col>(is_valid_col(col_ofs + k))) {
+          reinterpret_cast<element_t *>(&in_vec)[k] =
+              prologue(k, element_t(*(ptr + k)));
         }
       }
     }
@@ -804,7 +879,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     for (int k = 0; k < packet_size; k++) {
 #pragma unroll
       for (int j = 0; j < item_rows; j++) {
-        reg_res[j] = cl::sycl::mad(reg_a[j], *reg_b, reg_res[j]);
+        reg_res[j] = gemm_mad(reg_a[j], *reg_b, reg_res[j]);
       }
       reg_a += item_rows;
       reg_b += 1;
@@ -833,7 +908,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
 #pragma unroll
       for (int j = 0; j < item_rows; j++) {
         reg_res[i * item_rows + j] =
-            cl::sycl::mad(reg_a[j], reg_b[i], reg_res[i * item_rows + j]);
+            gemm_mad(reg_a[j], reg_b[i], reg_res[i * item_rows + j]);
       }
     }
   }
@@ -856,7 +931,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     reg_res += iteration * item_rows;
 #pragma unroll
     for (int j = 0; j < item_rows; j++) {
-      reg_res[j] = cl::sycl::mad(reg_a[j], *reg_b, reg_res[j]);
+      reg_res[j] = gemm_mad(reg_a[j], *reg_b, reg_res[j]);
     }
   }
 
@@ -891,23 +966,50 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     if (out_of_range) {
       return;
     }
+    constexpr index_t col_step =
+        (check_block || !trans_b) ? wg_cols : item_cols / packet_size;
 #pragma unroll
     for (int i = 0; i < item_cols; i++) {
 #pragma unroll
       for (int j = 0; j < item_rows / packet_size; j++) {
         if (do_check<check_block>(chk_boundary(dim_m_c_start + j * wg_rows,
                                                dim_n_c_start + i * wg_cols))) {
-          cl::sycl::vec<element_t, packet_size> out_vec{0};
+          cl::sycl::vec<epilogue_value_t, packet_size> out_vec{0};
 
-          out_vec.template load<address_t::private_space>(
-              0, reg_res + i * item_rows + j * packet_size);
-          out_vec *= alpha_;
+          load_output_packet<packet_size>(
+              out_vec, reg_res + i * item_rows + j * packet_size,
+              dim_m_c_start + j * wg_rows * packet_size,
+              dim_n_c_start + i * col_step);
 
-          out_vec.template store<address_t::global_space>(
-              0, C + j * wg_rows * packet_size);
+          packetize_t::store_global(out_vec, C + j * wg_rows * packet_size);
         }
       }
-      C += ldc * (check_block || !trans_b ? wg_cols : item_cols / packet_size);
+      C += ldc * col_step;
+    }
+  }
+
+  /*!
+   * @brief Loads the results of reg in out_vec, scaled by alpha and passed
+   * through the epilogue.
+   * @param row the row of C of the first element of the packet
+   * @param col the column of C of the packet
+   */
+  template <index_t packet_size, bool identity = epilogue_t::is_identity>
+  SYCL_BLAS_INLINE typename std::enable_if<identity>::type load_output_packet(
+      cl::sycl::vec<epilogue_value_t, packet_size> &out_vec, element_t *reg,
+      index_t, index_t) noexcept {
+    out_vec.template load<address_t::private_space>(0, reg);
+    out_vec *= alpha_;
+  }
+
+  template <index_t packet_size, bool identity = epilogue_t::is_identity>
+  SYCL_BLAS_INLINE typename std::enable_if<!identity>::type load_output_packet(
+      cl::sycl::vec<epilogue_value_t, packet_size> &out_vec, element_t *reg,
+      index_t row, index_t col) noexcept {
+#pragma unroll
+    for (index_t l = 0; l < packet_size; ++l) {
+      reinterpret_cast<epilogue_value_t *>(&out_vec)[l] =
+          epilogue_.eval(alpha_ * reg[l], row + l, col);
     }
   }
 };
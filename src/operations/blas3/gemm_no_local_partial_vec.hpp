@@ -102,14 +102,21 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   const element_t alpha_;
   const element_t beta_;
   index_t batch_size_;
+  const index_t stride_a_;
+  const index_t stride_b_;
+  const index_t stride_c_;
   SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
-                        element_t beta, index_t batch_size)
+                        element_t beta, index_t batch_size, index_t stride_a,
+                        index_t stride_b, index_t stride_c)
       : a_(A),
         b_(B),
         c_(C),
         alpha_(alpha),
         beta_(beta / alpha_),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        stride_a_(stride_a),
+        stride_b_(stride_b),
+        stride_c_(stride_c) {}
 
   /*!
    * @brief Get the type of this NoLocalGemmFactory as a human readable string.
@@ -183,13 +190,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     const index_t batch_stride =
         id.get_group_range(0) / get_workgroup_cluster();
 
-    const index_t a_size = trans_a ? m * lda : k * lda;
-    const index_t b_size = trans_b ? ldb * k : n * ldb;
-    const index_t c_size = ldc * n;
-
-    auto orig_A = a_.get_pointer() + (wg_batch_id * a_size);
-    auto orig_B = b_.get_pointer() + (wg_batch_id * b_size);
-    auto orig_C = c_.get_pointer() + (wg_batch_id * c_size);
+    auto orig_A = a_.get_pointer() + (wg_batch_id * stride_a_);
+    auto orig_B = b_.get_pointer() + (wg_batch_id * stride_b_);
+    auto orig_C = c_.get_pointer() + (wg_batch_id * stride_c_);
 
     const index_t number_of_block_per_row = ((m - 1) / block_rows) + 1;
     /* linear work group id The number of work-group required to executed each
@@ -271,10 +274,10 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
      */
     if ((is_internal_block == true)) {
       compute_gemm_no_shared_pannel<false, a_packet_size, b_packet_size>(
-          orig_A, orig_B, orig_C, a_size, b_size, c_size, a_.get_size_col(), k,
-          dim_m_a_start, dim_n_b_start, A_ptr_index, B_ptr_index,
-          boundary_check_m, boundary_check_n, boundary_check_c, reg_a, reg_b,
-          out_of_range, batch_stride, wg_batch_id, batch_size_, lda, ldb, ldc
+          orig_A, orig_B, orig_C, a_.get_size_col(), k, dim_m_a_start,
+          dim_n_b_start, A_ptr_index, B_ptr_index, boundary_check_m,
+          boundary_check_n, boundary_check_c, reg_a, reg_b, out_of_range,
+          batch_stride, wg_batch_id, batch_size_, lda, ldb, ldc
 #ifdef ARM_GPU
           ,
           id
@@ -282,10 +285,10 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       );
     } else {
       compute_gemm_no_shared_pannel<true, 1, 1>(
-          orig_A, orig_B, orig_C, a_size, b_size, c_size, a_.get_size_col(), k,
-          dim_m_a_start, dim_n_b_start, A_ptr_index, B_ptr_index,
-          boundary_check_m, boundary_check_n, boundary_check_c, reg_a, reg_b,
-          out_of_range, batch_stride, wg_batch_id, batch_size_, lda, ldb, ldc
+          orig_A, orig_B, orig_C, a_.get_size_col(), k, dim_m_a_start,
+          dim_n_b_start, A_ptr_index, B_ptr_index, boundary_check_m,
+          boundary_check_n, boundary_check_c, reg_a, reg_b, out_of_range,
+          batch_stride, wg_batch_id, batch_size_, lda, ldb, ldc
 #ifdef ARM_GPU
           ,
           id
@@ -340,8 +343,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
             typename check_boundary_m_t, typename check_boundary_n_t,
             typename check_boundary_c_t>
   SYCL_BLAS_INLINE void compute_gemm_no_shared_pannel(
-      A_t orig_A, B_t orig_B, C_t orig_C, const index_t &a_size,
-      const index_t &b_size, const index_t &c_size, index_t orig_k, index_t k,
+      A_t orig_A, B_t orig_B, C_t orig_C, index_t orig_k, index_t k,
       const index_t &dim_m_a_start, const index_t &dim_n_b_start,
       const index_t &A_ptr_index, const index_t &B_ptr_index,
       const check_boundary_m_t &boundary_check_m,
@@ -403,9 +405,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
           C, reg_res, dim_m_a_start, dim_n_b_start, boundary_check_c,
           out_of_range, ldc);
 
-      orig_A += (a_size * batch_stride);
-      orig_B += (b_size * batch_stride);
-      orig_C += (c_size * batch_stride);
+      orig_A += (stride_a_ * batch_stride);
+      orig_B += (stride_b_ * batch_stride);
+      orig_C += (stride_c_ * batch_stride);
       k = orig_k;
       // batch_size_ must be signed as the negative value has meaning here.
       batch_size -= batch_stride;
@@ -48,13 +48,17 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize, BatchType>::
+     GemmVectorization, VectorSize, BatchType, epilogue_t, prologue_t>::
     Gemm(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
-         typename std::make_signed<typename input_t::index_t>::type batch_size)
+         typename std::make_signed<typename input_t::index_t>::type batch_size,
+         typename std::make_signed<typename input_t::index_t>::type stride_a,
+         typename std::make_signed<typename input_t::index_t>::type stride_b,
+         typename std::make_signed<typename input_t::index_t>::type stride_c,
+         epilogue_t epilogue, prologue_t prologue)
     : a_(A),
       b_(B),
       c_(C),
@@ -66,16 +70,22 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
       lda_(a_.getSizeL()),
       ldb_(b_.getSizeL()),
       ldc_(c_.getSizeL()),
-      batch_size_(batch_size) {}
+      batch_size_(batch_size),
+      stride_a_(stride_a),
+      stride_b_(stride_b),
+      stride_c_(stride_c),
+      epilogue_(epilogue),
+      prologue_(prologue) {}
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE std::string
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize, BatchType>::get_type_string() noexcept {
+     GemmVectorization, VectorSize, BatchType,
+     epilogue_t, prologue_t>::get_type_string() noexcept {
   std::ostringstream str{};
   str << "ReferenceGemmFactory<" << wg_size << ", "
       << type_string<value_t>::get_value() << ">";
@@ -90,15 +100,15 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE typename Gemm<
     input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
     TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-    GemmVectorization, VectorSize, BatchType>::index_t
+    GemmVectorization, VectorSize, BatchType, epilogue_t, prologue_t>::index_t
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize, BatchType>::get_workgroup_cluster() const
-    noexcept {
+     GemmVectorization, VectorSize, BatchType,
+     epilogue_t, prologue_t>::get_workgroup_cluster() const noexcept {
   return ((m_ * n_ - 1) / wg_size + 1);
 }
 /*!
@@ -112,23 +122,23 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE
     typename Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                   tile_type, TransA, TransB, element_t, is_beta_zero,
                   GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
-                  BatchType>::index_t
+                  BatchType, epilogue_t, prologue_t>::index_t
     Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
          TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-         GemmVectorization, VectorSize,
-         BatchType>::get_num_workgroup_cluster(index_t compute_units) const
-    noexcept {
+         GemmVectorization, VectorSize, BatchType, epilogue_t,
+         prologue_t>::get_num_workgroup_cluster(index_t compute_units)
+        const noexcept {
   constexpr index_t num_gemm_per_compute_units = 4;
   return ((num_gemm_per_compute_units * compute_units - 1) /
               Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                    tile_type, TransA, TransB, element_t, is_beta_zero,
                    GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
-                   BatchType>::get_workgroup_cluster() +
+                   BatchType, epilogue_t, prologue_t>::get_workgroup_cluster() +
           1);
 }
 
@@ -136,21 +146,21 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE cl::sycl::nd_range<1>
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize,
-     BatchType>::get_nd_range(index_t compute_units) const noexcept {
+     GemmVectorization, VectorSize, BatchType, epilogue_t,
+     prologue_t>::get_nd_range(index_t compute_units) const noexcept {
   const cl::sycl::range<1> nwg(
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm, GemmVectorization, VectorSize,
-           BatchType>::get_workgroup_cluster() *
+           GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+           epilogue_t, prologue_t>::get_workgroup_cluster() *
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm, GemmVectorization, VectorSize,
-           BatchType>::get_num_workgroup_cluster(compute_units));
+           GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+           epilogue_t, prologue_t>::get_num_workgroup_cluster(compute_units));
   const cl::sycl::range<1> wgs(wg_size);
   return cl::sycl::nd_range<1>(nwg * wgs, wgs);
 }
@@ -158,15 +168,16 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE
     typename Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                   tile_type, TransA, TransB, element_t, is_beta_zero,
                   GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
-                  BatchType>::index_t
+                  BatchType, epilogue_t, prologue_t>::index_t
     Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
          TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-         GemmVectorization, VectorSize, BatchType>::get_size() const {
+         GemmVectorization, VectorSize, BatchType, epilogue_t,
+         prologue_t>::get_size() const {
   return m_ * n_;
 }
 
@@ -174,12 +185,12 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE bool
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize,
-     BatchType>::valid_thread(const cl::sycl::nd_item<1>& ndItem) const {
+     GemmVectorization, VectorSize, BatchType, epilogue_t,
+     prologue_t>::valid_thread(const cl::sycl::nd_item<1>& ndItem) const {
   return true;
 }
 
@@ -187,12 +198,12 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize, BatchType>::eval(cl::sycl::nd_item<1>
-                                                         id) noexcept {
+     GemmVectorization, VectorSize, BatchType,
+     epilogue_t, prologue_t>::eval(cl::sycl::nd_item<1> id) noexcept {
   const index_t wg_batch_id = id.get_group(0) / get_workgroup_cluster();
   // This will disable all workgroups that dont have any batch to work on
   if (wg_batch_id >= batch_size_) {
@@ -200,13 +211,9 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
   }
   const index_t batch_stride = id.get_group_range(0) / get_workgroup_cluster();
 
-  const index_t a_size = trans_a ? m_ * lda_ : k_ * lda_;
-  const index_t b_size = trans_b ? ldb_ * k_ : n_ * ldb_;
-  const index_t c_size = ldc_ * n_;
-
-  auto orig_A = a_.get_pointer() + (wg_batch_id * a_size);
-  auto orig_B = b_.get_pointer() + (wg_batch_id * b_size);
-  auto orig_C = c_.get_pointer() + (wg_batch_id * c_size);
+  auto orig_A = a_.get_pointer() + (wg_batch_id * stride_a_);
+  auto orig_B = b_.get_pointer() + (wg_batch_id * stride_b_);
+  auto orig_C = c_.get_pointer() + (wg_batch_id * stride_c_);
 
   index_t item_id =
       (id.get_group(0) % get_workgroup_cluster()) * (id.get_local_range(0)) +
@@ -228,7 +235,9 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
     auto C = orig_C;
     value_t reg_res = {};
     while (k_ > 0) {
-      reg_res = cl::sycl::mad(A[0], B[0], reg_res);
+      const index_t l = a_.get_size_col() - k_;
+      reg_res = gemm_mad(prologue_.eval_a(value_t(A[0]), row, l),
+                         prologue_.eval_b(value_t(B[0]), l, col), reg_res);
       --k_;
       A = A + (trans_a ? 1 : lda_);
       B = B + (trans_b ? ldb_ : 1);
@@ -236,14 +245,15 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
     // when C is uninitialized the element of the C can be NaN, and Nan*0
     // will be NaN
     if (is_beta_zero) {
-      C[0] = alpha_ * reg_res;
+      C[0] = epilogue_.eval(alpha_ * reg_res, row, col);
     } else {
-      C[0] = alpha_ * reg_res + beta_ * C[0];
+      C[0] = epilogue_.eval(alpha_ * reg_res + beta_ * value_t(C[0]), row,
+                            col);
     }
 
-    orig_A += (a_size * batch_stride);
-    orig_B += (b_size * batch_stride);
-    orig_C += (c_size * batch_stride);
+    orig_A += (stride_a_ * batch_stride);
+    orig_B += (stride_b_ * batch_stride);
+    orig_C += (stride_c_ * batch_stride);
     k_ = a_.get_size_col();
     // batch_size_ must be signed as the negative value has meaning here.
     batch_size_ -= batch_stride;
@@ -254,28 +264,34 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize, BatchType>::bind(cl::sycl::handler& h) {
+     GemmVectorization, VectorSize, BatchType,
+     epilogue_t, prologue_t>::bind(cl::sycl::handler& h) {
   a_.bind(h);
   b_.bind(h);
   c_.bind(h);
+  epilogue_.bind(h);
+  prologue_.bind(h);
 }
 
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t, typename prologue_t>
 SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-     GemmVectorization, VectorSize, BatchType>::adjust_access_displacement() {
+     GemmVectorization, VectorSize, BatchType,
+     epilogue_t, prologue_t>::adjust_access_displacement() {
   a_.adjust_access_displacement();
   b_.adjust_access_displacement();
   c_.adjust_access_displacement();
+  epilogue_.adjust_access_displacement();
+  prologue_.adjust_access_displacement();
 }
 
 }  // namespace blas
@@ -0,0 +1,221 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_stream_k.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_STREAM_K_GEMM_HPP
+#define SYCL_BLAS_BLAS3_STREAM_K_GEMM_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename gemm_t, typename partial_gemm_t>
+SYCL_BLAS_INLINE GemmStreamK<gemm_t, partial_gemm_t>::GemmStreamK(
+    gemm_t gemm, partial_gemm_t partial_gemm, index_t m, index_t n, index_t k,
+    index_t lda, index_t ldb, index_t ldc, index_t share,
+    index_t num_work_groups)
+    : gemm_(gemm),
+      partial_gemm_(partial_gemm),
+      m_(m),
+      n_(n),
+      k_(k),
+      lda_(lda),
+      ldb_(ldb),
+      ldc_(ldc),
+      share_(share),
+      num_work_groups_(num_work_groups) {}
+
+template <typename gemm_t, typename partial_gemm_t>
+SYCL_BLAS_INLINE typename GemmStreamK<gemm_t, partial_gemm_t>::index_t
+GemmStreamK<gemm_t, partial_gemm_t>::get_num_blocks(index_t m,
+                                                    index_t n) noexcept {
+  return ((m + block_rows - 1) / block_rows) *
+         ((n + block_cols - 1) / block_cols);
+}
+
+template <typename gemm_t, typename partial_gemm_t>
+SYCL_BLAS_INLINE typename GemmStreamK<gemm_t, partial_gemm_t>::index_t
+GemmStreamK<gemm_t, partial_gemm_t>::get_size() const {
+  return num_work_groups_ * wg_size;
+}
+
+template <typename gemm_t, typename partial_gemm_t>
+SYCL_BLAS_INLINE bool GemmStreamK<gemm_t, partial_gemm_t>::valid_thread(
+    const cl::sycl::nd_item<1>& ndItem) const {
+  return true;
+}
+
+template <typename gemm_t, typename partial_gemm_t>
+template <typename... scratch_t>
+SYCL_BLAS_INLINE void GemmStreamK<gemm_t, partial_gemm_t>::compute_iterations(
+    const cl::sycl::nd_item<1>& id, scratch_t... scratch) noexcept {
+  const index_t wg_id = id.get_group(0);
+  const index_t row_blocks = (m_ + block_rows - 1) / block_rows;
+
+  const index_t first_iter = wg_id * share_;
+  const index_t end_iter =
+      cl::sycl::min(first_iter + share_, get_num_blocks(m_, n_) * k_);
+  // Every block the range goes through is a segment of K, only the first and
+  // the last ones can be incomplete
+  for (index_t iter = first_iter; iter < end_iter;) {
+    const index_t block_id = iter / k_;
+    const index_t k_begin = iter - block_id * k_;
+    const index_t k_end = cl::sycl::min(k_, k_begin + (end_iter - iter));
+    const index_t row = (block_id % row_blocks) * block_rows;
+    const index_t col = (block_id / row_blocks) * block_cols;
+    // The segment is the GEMM of the rows of op(A) and the columns of op(B)
+    // from the block onwards, over [k_begin, k_end). Only its first block is
+    // computed, as a batch of one.
+    const index_t m = m_ - row;
+    const index_t n = n_ - col;
+    const index_t k = k_end - k_begin;
+    const index_t offset_a =
+        trans_a ? k_begin + row * lda_ : row + k_begin * lda_;
+    const index_t offset_b =
+        trans_b ? col + k_begin * ldb_ : k_begin + col * ldb_;
+    if (k == k_) {
+      gemm_.compute_block(scratch..., id, m, n, k, lda_, ldb_, ldc_,
+                          index_t(0), index_t(0), offset_a, offset_b,
+                          row + col * ldc_, index_t(1), index_t(0),
+                          index_t(1));
+    } else {
+      const index_t slot = wg_id * 2 + ((iter == first_iter) ? 0 : 1);
+      partial_gemm_.compute_block(
+          scratch..., id, m, n, k, lda_, ldb_, index_t(block_rows),
+          index_t(0), index_t(0), offset_a, offset_b,
+          slot * block_rows * block_cols, index_t(1), index_t(0), index_t(1));
+    }
+    iter += k;
+  }
+}
+
+template <typename gemm_t, typename partial_gemm_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void GemmStreamK<gemm_t, partial_gemm_t>::eval(
+    local_memory_t scratch, const cl::sycl::nd_item<1>& id) noexcept {
+  compute_iterations(id, scratch);
+}
+
+template <typename gemm_t, typename partial_gemm_t>
+SYCL_BLAS_INLINE void GemmStreamK<gemm_t, partial_gemm_t>::eval(
+    cl::sycl::nd_item<1> id) noexcept {
+  compute_iterations(id);
+}
+
+template <typename gemm_t, typename partial_gemm_t>
+SYCL_BLAS_INLINE void GemmStreamK<gemm_t, partial_gemm_t>::bind(
+    cl::sycl::handler& h) {
+  gemm_.bind(h);
+  partial_gemm_.bind(h);
+}
+
+template <typename gemm_t, typename partial_gemm_t>
+SYCL_BLAS_INLINE void
+GemmStreamK<gemm_t, partial_gemm_t>::adjust_access_displacement() {
+  gemm_.adjust_access_displacement();
+  partial_gemm_.adjust_access_displacement();
+}
+
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t>
+SYCL_BLAS_INLINE
+GemmStreamKFixup<is_beta_zero, tile_type, output_t, element_t>::
+    GemmStreamKFixup(output_t C, output_t workspace, element_t alpha,
+                     element_t beta, index_t m, index_t n, index_t k,
+                     index_t ldc, index_t share)
+    : c_(C),
+      workspace_(workspace),
+      alpha_(alpha),
+      beta_(beta),
+      m_(m),
+      n_(n),
+      k_(k),
+      ldc_(ldc),
+      share_(share) {}
+
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t>
+SYCL_BLAS_INLINE typename GemmStreamKFixup<is_beta_zero, tile_type, output_t,
+                                           element_t>::index_t
+GemmStreamKFixup<is_beta_zero, tile_type, output_t, element_t>::get_size()
+    const {
+  return m_ * n_;
+}
+
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t>
+SYCL_BLAS_INLINE bool
+GemmStreamKFixup<is_beta_zero, tile_type, output_t, element_t>::valid_thread(
+    const cl::sycl::nd_item<1>& ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t>
+SYCL_BLAS_INLINE void
+GemmStreamKFixup<is_beta_zero, tile_type, output_t, element_t>::eval(
+    cl::sycl::nd_item<1> id) noexcept {
+  const index_t idx = id.get_global_id(0);
+  const index_t row = idx % m_;
+  const index_t col = idx / m_;
+  const index_t row_blocks = (m_ + block_rows - 1) / block_rows;
+  const index_t block_id = (row / block_rows) + (col / block_cols) * row_blocks;
+  const index_t first_iter = block_id * k_;
+  const index_t first_wg = first_iter / share_;
+  const index_t last_wg = (first_iter + k_ - 1) / share_;
+  if (first_wg == last_wg) {
+    return;
+  }
+  const index_t offset = (row % block_rows) + (col % block_cols) * block_rows;
+  element_t sum = element_t(0);
+  for (index_t wg = first_wg; wg <= last_wg; ++wg) {
+    const index_t slot = wg * 2 + ((wg * share_ >= first_iter) ? 0 : 1);
+    sum += workspace_.template eval<true>(slot * block_rows * block_cols +
+                                          offset);
+  }
+  auto& out = c_.template eval<true>(row + col * ldc_);
+  out = is_beta_zero ? alpha_ * sum
+                     : cl::sycl::mad(beta_, element_t(out), alpha_ * sum);
+}
+
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t>
+SYCL_BLAS_INLINE void
+GemmStreamKFixup<is_beta_zero, tile_type, output_t, element_t>::bind(
+    cl::sycl::handler& h) {
+  c_.bind(h);
+  workspace_.bind(h);
+}
+
+template <bool is_beta_zero, typename tile_type, typename output_t,
+          typename element_t>
+SYCL_BLAS_INLINE void
+GemmStreamKFixup<is_beta_zero, tile_type, output_t,
+                 element_t>::adjust_access_displacement() {
+  c_.adjust_access_displacement();
+  workspace_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_STREAM_K_GEMM_HPP
@@ -192,6 +192,28 @@ struct SquareOperator : public Operators {
   }
 };
 
+struct ReluOperator : public Operators {
+  template <typename rhs_t>
+  static SYCL_BLAS_INLINE rhs_t eval(const rhs_t r) {
+    return ((r > constant<rhs_t, const_val::zero>::value())
+                ? r
+                : constant<rhs_t, const_val::zero>::value());
+  }
+};
+
+/*!
+ * @brief The tanh approximation of GELU:
+ * 0.5 * r * (1 + tanh(sqrt(2 / pi) * (r + 0.044715 * r^3)))
+ */
+struct GeluOperator : public Operators {
+  template <typename rhs_t>
+  static SYCL_BLAS_INLINE rhs_t eval(const rhs_t r) {
+    return (rhs_t(0.5) * r *
+            (rhs_t(1) + cl::sycl::tanh(rhs_t(0.7978845608028654) *
+                                       (r + rhs_t(0.044715) * r * r * r))));
+  }
+};
+
 /*!
  Definitions of binary operators
 */
@@ -222,6 +244,25 @@ struct ProductOperator : public Operators {
   }
 };
 
+/*!
+ * @brief The product of a scalar known only on the device with an operand
+ * which is overwritten, e.g. beta * y. A scalar of zero gives zero whatever
+ * the operand holds, as BLAS does not read it, so NaNs are not propagated.
+ */
+struct ScaleOutputOperator : public Operators {
+  template <typename lhs_t, typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
+                                                              const rhs_t &r) {
+    using value_t = typename StripASP<rhs_t>::type;
+    return (l == lhs_t(0)) ? value_t(0) : value_t(l * r);
+  }
+
+  template <typename rhs_t>
+  constexpr static SYCL_BLAS_INLINE typename rhs_t::value_t init() {
+    return constant<typename rhs_t::value_t, const_val::one>::value();
+  }
+};
+
 struct DivisionOperator : public Operators {
   template <typename lhs_t, typename rhs_t>
   static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
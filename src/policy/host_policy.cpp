@@ -0,0 +1,169 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename host_policy.cpp
+ *
+ **************************************************************************/
+
+
+#include "policy/host_policy.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace blas {
+
+/*!
+ * @brief Threads of a HostQueue. The chunks of a parallel_for are handed out
+ * through an atomic counter, the calling thread taking part in the work.
+ * The first exception thrown by a chunk cancels the chunks not yet taken and
+ * is rethrown to the caller once all the threads are done.
+ */
+class HostQueue::Pool {
+ public:
+  explicit Pool(size_t num_threads)
+      : job_(nullptr),
+        num_chunks_(0),
+        next_chunk_(0),
+        generation_(0),
+        active_workers_(0),
+        stop_(false) {
+    for (size_t i = 1; i < num_threads; i++) {
+      workers_.emplace_back([this]() { worker_loop(); });
+    }
+  }
+
+  ~Pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void run(size_t num_chunks, const std::function<void(size_t)> &chunk_fn) {
+    /* Not worth waking the workers up */
+    if (num_chunks <= 1 || workers_.empty()) {
+      for (size_t c = 0; c < num_chunks; c++) {
+        chunk_fn(c);
+      }
+      return;
+    }
+    std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = &chunk_fn;
+      num_chunks_ = num_chunks;
+      next_chunk_.store(0);
+      active_workers_ = workers_.size();
+      ++generation_;
+    }
+    start_cv_.notify_all();
+    take_chunks();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return active_workers_ == 0; });
+    job_ = nullptr;
+    if (error_) {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  size_t get_num_threads() const { return workers_.size() + 1; }
+
+ private:
+  void take_chunks() {
+    for (;;) {
+      const size_t c = next_chunk_.fetch_add(1);
+      if (c >= num_chunks_) {
+        return;
+      }
+      try {
+        (*job_)(c);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+        /* The remaining chunks are not run */
+        next_chunk_.store(num_chunks_);
+        return;
+      }
+    }
+  }
+
+  void worker_loop() {
+    size_t seen_generation = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      start_cv_.wait(lock, [&]() {
+        return stop_ || generation_ != seen_generation;
+      });
+      if (stop_) {
+        return;
+      }
+      seen_generation = generation_;
+      lock.unlock();
+      take_chunks();
+      lock.lock();
+      if (--active_workers_ == 0) {
+        done_cv_.notify_one();
+      }
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  /* Serializes the parallel_for calls made on the same queue */
+  std::mutex submit_mutex_;
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(size_t)> *job_;
+  size_t num_chunks_;
+  std::atomic<size_t> next_chunk_;
+  size_t generation_;
+  size_t active_workers_;
+  bool stop_;
+  /* First exception thrown by a chunk of the current parallel_for */
+  std::exception_ptr error_;
+};
+
+HostQueue::HostQueue(size_t num_threads)
+    : pool_(std::make_shared<Pool>(
+          (num_threads > 0)
+              ? num_threads
+              : std::max(size_t(1),
+                         size_t(std::thread::hardware_concurrency())))) {}
+
+void HostQueue::parallel_for(size_t num_chunks,
+                             const std::function<void(size_t)> &chunk_fn) {
+  pool_->run(num_chunks, chunk_fn);
+}
+
+size_t HostQueue::get_num_threads() const { return pool_->get_num_threads(); }
+
+}  // namespace blas
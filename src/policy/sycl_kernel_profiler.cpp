@@ -0,0 +1,233 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_kernel_profiler.cpp
+ *
+ **************************************************************************/
+
+
+#include "policy/sycl_kernel_profiler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <ostream>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace blas {
+
+namespace {
+
+/* Name of the outermost RoutineScope of each thread */
+thread_local const char *current_routine = nullptr;
+
+/* Name of the root of a tree type, e.g. "Gemm" for "Gemm <...>" or
+ * "AssignReduction" for "blas::AssignReduction<...>" */
+std::string get_routine_name(const std::string &kernel) {
+  auto name = kernel.substr(0, kernel.find('<'));
+  const auto last_space = name.find_last_not_of(' ');
+  name.erase(last_space == std::string::npos ? 0 : last_space + 1);
+  const auto scope = name.rfind("::");
+  return scope == std::string::npos ? name : name.substr(scope + 2);
+}
+
+/* Quotes a CSV field */
+std::string quote(const std::string &field) {
+  std::string quoted = "\"";
+  for (const auto c : field) {
+    quoted += c;
+    if (c == '"') {
+      quoted += c;
+    }
+  }
+  return quoted + "\"";
+}
+
+}  // namespace
+
+std::string demangle_type_name(const char *name) {
+#if defined(__GNUG__)
+  int status = 0;
+  std::unique_ptr<char, void (*)(void *)> demangled(
+      abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free);
+  if (status == 0 && demangled) {
+    return demangled.get();
+  }
+#endif
+  return name;
+}
+
+RoutineScope::RoutineScope(const char *routine)
+    : previous_(current_routine) {
+  if (current_routine == nullptr) {
+    current_routine = routine;
+  }
+}
+
+RoutineScope::~RoutineScope() { current_routine = previous_; }
+
+const char *RoutineScope::get_current() { return current_routine; }
+
+KernelProfiler::KernelProfiler(bool has_timestamps)
+    : enabled_(false),
+      has_timestamps_(has_timestamps),
+      max_records_(default_max_records),
+      num_dropped_(0) {
+  const char *value = std::getenv(env_var);
+  enabled_ = value != nullptr && std::string(value) == "1";
+}
+
+void KernelProfiler::set_max_records(size_t max_records) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_records_ = max_records;
+  while (records_.size() > max_records_) {
+    records_.pop_front();
+  }
+}
+
+void KernelProfiler::record(const std::string &kernel, size_t global_size,
+                            size_t local_size, size_t local_memory_bytes,
+                            event_t event) {
+  const char *routine = RoutineScope::get_current();
+  KernelRecord record{
+      kernel, routine != nullptr ? routine : get_routine_name(kernel),
+      global_size, local_size, local_memory_bytes, 0, 0, 0};
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Keeps the pending list short under a steady stream of kernels, the
+  // oldest kernels being dropped when none of them has completed
+  if (pending_.size() >= max_records_) {
+    collect_completed();
+  }
+  while (!pending_.empty() && pending_.size() >= max_records_) {
+    pending_.pop_front();
+    ++num_dropped_;
+  }
+  pending_.emplace_back(std::move(record), event);
+}
+
+size_t KernelProfiler::get_num_dropped() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_dropped_;
+}
+
+void KernelProfiler::time(KernelRecord &record, event_t &event) const {
+  if (has_timestamps_) {
+    record.submit_ns = event.get_profiling_info<
+        cl::sycl::info::event_profiling::command_submit>();
+    record.start_ns = event.get_profiling_info<
+        cl::sycl::info::event_profiling::command_start>();
+    record.end_ns = event.get_profiling_info<
+        cl::sycl::info::event_profiling::command_end>();
+  }
+}
+
+void KernelProfiler::add(KernelRecord &&record) {
+  const uint64_t duration = record.end_ns - record.start_ns;
+  auto &stats = stats_[record.routine];
+  stats.min_ns =
+      stats.num_kernels == 0 ? duration : std::min(stats.min_ns, duration);
+  stats.max_ns = std::max(stats.max_ns, duration);
+  stats.total_ns += duration;
+  stats.num_work_items += record.global_size;
+  ++stats.num_kernels;
+  records_.push_back(std::move(record));
+  if (records_.size() > max_records_) {
+    records_.pop_front();
+  }
+}
+
+void KernelProfiler::collect_completed() {
+  auto it = pending_.begin();
+  while (it != pending_.end()) {
+    if (!codeplay_policy::is_complete({it->second})) {
+      ++it;
+      continue;
+    }
+    time(it->first, it->second);
+    add(std::move(it->first));
+    it = pending_.erase(it);
+  }
+}
+
+void KernelProfiler::collect() {
+  // The kernels are waited for without holding the lock, so that they can
+  // still be recorded meanwhile
+  std::deque<std::pair<KernelRecord, event_t>> pending;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending.swap(pending_);
+  }
+  for (auto &kernel : pending) {
+    kernel.second.wait();
+    time(kernel.first, kernel.second);
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &kernel : pending) {
+    add(std::move(kernel.first));
+  }
+}
+
+std::vector<KernelRecord> KernelProfiler::get_records() {
+  collect();
+  std::lock_guard<std::mutex> lock(mutex_);
+  return std::vector<KernelRecord>(records_.begin(), records_.end());
+}
+
+std::map<std::string, RoutineStats> KernelProfiler::get_routine_stats() {
+  collect();
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void KernelProfiler::write_csv(std::ostream &output) {
+  output << "routine,kernel,global_size,local_size,local_memory_bytes,"
+            "submit_ns,start_ns,end_ns,duration_ns\n";
+  for (const auto &record : get_records()) {
+    output << quote(record.routine) << "," << quote(record.kernel) << ","
+           << record.global_size << "," << record.local_size << ","
+           << record.local_memory_bytes << "," << record.submit_ns << ","
+           << record.start_ns << "," << record.end_ns << ","
+           << record.end_ns - record.start_ns << "\n";
+  }
+}
+
+void KernelProfiler::write_routine_stats_csv(std::ostream &output) {
+  output << "routine,num_kernels,num_work_items,total_ns,min_ns,max_ns,"
+            "mean_ns\n";
+  for (const auto &routine : get_routine_stats()) {
+    const auto &stats = routine.second;
+    output << quote(routine.first) << "," << stats.num_kernels << ","
+           << stats.num_work_items << "," << stats.total_ns << ","
+           << stats.min_ns << "," << stats.max_ns << ","
+           << stats.total_ns / std::max<size_t>(stats.num_kernels, 1) << "\n";
+  }
+}
+
+void KernelProfiler::clear() {
+  collect();
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.clear();
+  stats_.clear();
+  num_dropped_ = 0;
+}
+
+}  // namespace blas
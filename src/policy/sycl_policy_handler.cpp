@@ -78,6 +78,14 @@ INSTANTIATE_TEMPLATE_METHODS(float)
 INSTANTIATE_TEMPLATE_METHODS(double)
 #endif  // BLAS_DATA_TYPE_DOUBLE
 
+#ifdef BLAS_DATA_TYPE_HALF
+INSTANTIATE_TEMPLATE_METHODS(cl::sycl::half)
+#endif  // BLAS_DATA_TYPE_HALF
+
+// Operands, results and zero points of the quantized GEMM
+INSTANTIATE_TEMPLATE_METHODS(int8_t)
+INSTANTIATE_TEMPLATE_METHODS(int32_t)
+
 #define INSTANTIATE_TEMPLATE_METHODS_SPECIAL(ind, val)                        \
   template IndexValueTuple<ind, val>                                          \
       *PolicyHandler<codeplay_policy>::allocate<IndexValueTuple<ind, val>>(   \
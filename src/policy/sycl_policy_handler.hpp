@@ -26,6 +26,7 @@
 #define SYCL_BLAS_SYCL_POLICY_HANDLER_HPP
 
 #include "policy/sycl_policy_handler.h"
+#include "policy/sycl_scratch_pool.hpp"
 
 namespace blas {
 
@@ -190,5 +191,37 @@ PolicyHandler<codeplay_policy>::copy_to_host(
   });
   return {event};
 }
+
+/*  @brief Borrowing a temporary buffer from the scratch pool
+    @tparam element_t is the type of the data
+    @param num_elements is the number of elements required
+*/
+template <typename element_t>
+inline ScratchBuffer<element_t> PolicyHandler<codeplay_policy>::acquire_scratch(
+    size_t num_elements) {
+  return scratchPoolPtr_->template acquire<element_t>(num_elements);
+}
+
+/*  @brief Borrowing a zero-filled temporary buffer from the scratch pool
+    @tparam element_t is the type of the data
+    @param num_elements is the number of elements required
+*/
+template <typename element_t>
+inline ScratchBuffer<element_t>
+PolicyHandler<codeplay_policy>::acquire_zeroed_scratch(size_t num_elements) {
+  return scratchPoolPtr_->template acquire_zeroed<element_t>(num_elements);
+}
+
+/*  @brief Giving a temporary buffer back to the scratch pool
+    @tparam element_t is the type of the data
+    @param scratch is the buffer returned by acquire_scratch
+    @param dependencies are the events of the kernels using the buffer
+*/
+template <typename element_t>
+inline void PolicyHandler<codeplay_policy>::release_scratch(
+    ScratchBuffer<element_t> scratch,
+    const typename codeplay_policy::event_t &dependencies) {
+  scratchPoolPtr_->release(scratch.get_block_id(), dependencies);
+}
 }  // namespace blas
 #endif  // QUEUE_SYCL_HPP
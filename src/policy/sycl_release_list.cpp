@@ -0,0 +1,51 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_release_list.cpp
+ *
+ **************************************************************************/
+
+#include "policy/sycl_release_list.h"
+
+namespace blas {
+
+void DeferredReleaseList::collect() {
+  std::vector<Entry> released;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.begin();
+    while (it != entries_.end()) {
+      if (codeplay_policy::is_complete(it->dependencies)) {
+        released.push_back(*it);
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  /* The released objects are destroyed here, outside of the lock */
+}
+
+size_t DeferredReleaseList::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+}  // namespace blas
@@ -0,0 +1,156 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_scratch_pool.cpp
+ *
+ **************************************************************************/
+
+#include "policy/sycl_scratch_pool.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace blas {
+
+constexpr size_t ScratchPool::min_block_bytes;
+
+ScratchPool::ScratchPool()
+    : next_block_id_(0),
+      allocation_count_(0),
+      workspace_(nullptr),
+      workspace_used_(0) {}
+
+size_t ScratchPool::get_bucket_size(size_t num_bytes) {
+  size_t bucket = min_block_bytes;
+  while (bucket < num_bytes) {
+    bucket <<= 1;
+  }
+  return bucket;
+}
+
+size_t ScratchPool::acquire_block(size_t num_bytes, bool zeroed) {
+  const size_t bucket = get_bucket_size(num_bytes);
+
+  /* Reuse an idle block of the same bucket whose users have finished */
+  for (auto &entry : blocks_) {
+    Block &block = entry.second;
+    if (!block.in_use && block.size == bucket && block.zeroed == zeroed &&
+        codeplay_policy::is_complete(block.pending)) {
+      block.in_use = true;
+      block.pending.clear();
+      return entry.first;
+    }
+  }
+
+  const size_t block_id = next_block_id_++;
+  if (zeroed) {
+    /* The buffer copies the zeros when it is constructed */
+    const std::vector<byte_t> zeros(bucket, byte_t(0));
+    blocks_.emplace(block_id, Block(buffer_t(zeros.begin(), zeros.end()), 0,
+                                    bucket, /* from_workspace = */ false,
+                                    /* zeroed = */ true));
+    ++allocation_count_;
+  } else if (workspace_ &&
+             workspace_used_ + bucket <= workspace_->get_count()) {
+    /* Carve the block from the user workspace if there is room left */
+    blocks_.emplace(block_id, Block(*workspace_, workspace_used_, bucket,
+                                    /* from_workspace = */ true,
+                                    /* zeroed = */ false));
+    workspace_used_ += bucket;
+  } else {
+    blocks_.emplace(block_id,
+                    Block(buffer_t(cl::sycl::range<1>(bucket)), 0, bucket,
+                          /* from_workspace = */ false, /* zeroed = */ false));
+    ++allocation_count_;
+  }
+  return block_id;
+}
+
+void ScratchPool::release(size_t block_id, const event_t &dependencies) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = blocks_.find(block_id);
+  if (it == blocks_.end()) {
+    return;
+  }
+  if (it->second.retired) {
+    blocks_.erase(it);
+    return;
+  }
+  it->second.in_use = false;
+  it->second.pending = dependencies;
+}
+
+void ScratchPool::retire_workspace() {
+  for (auto it = blocks_.begin(); it != blocks_.end();) {
+    if (!it->second.from_workspace) {
+      ++it;
+    } else if (it->second.in_use) {
+      it->second.retired = true;
+      ++it;
+    } else {
+      it = blocks_.erase(it);
+    }
+  }
+  workspace_.reset();
+  workspace_used_ = 0;
+}
+
+void ScratchPool::set_workspace(buffer_t workspace) {
+  if (workspace.get_count() % min_block_bytes != 0) {
+    throw std::invalid_argument(
+        "The workspace size must be a multiple of the scratch block size");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  retire_workspace();
+  workspace_.reset(new buffer_t(workspace));
+}
+
+void ScratchPool::clear_workspace() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  retire_workspace();
+}
+
+void ScratchPool::trim() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto it = blocks_.begin(); it != blocks_.end();) {
+    const Block &block = it->second;
+    if (!block.from_workspace && !block.in_use &&
+        codeplay_policy::is_complete(block.pending)) {
+      it = blocks_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+size_t ScratchPool::get_allocation_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return allocation_count_;
+}
+
+size_t ScratchPool::get_reserved_bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t reserved = 0;
+  for (const auto &entry : blocks_) {
+    reserved += entry.second.size;
+  }
+  return reserved;
+}
+
+}  // namespace blas
@@ -0,0 +1,70 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_scratch_pool.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SYCL_SCRATCH_POOL_HPP
+#define SYCL_BLAS_SYCL_SCRATCH_POOL_HPP
+
+#include "policy/sycl_scratch_pool.h"
+
+namespace blas {
+
+/*!
+ * @brief Reinterprets a block as element_t, the offset of the returned
+ * iterator points to the beginning of the block.
+ */
+template <typename element_t>
+inline ScratchBuffer<element_t> ScratchPool::make_scratch_buffer(
+    size_t block_id) const {
+  static_assert((sizeof(element_t) & (sizeof(element_t) - 1)) == 0 &&
+                    sizeof(element_t) <= min_block_bytes,
+                "The scratch pool only stores types whose size is a power of "
+                "two no larger than a block");
+  const Block &block = blocks_.at(block_id);
+  auto typed_buffer = block.buffer.reinterpret<element_t>(
+      cl::sycl::range<1>(block.buffer.get_count() / sizeof(element_t)));
+  return ScratchBuffer<element_t>(
+      BufferIterator<element_t, codeplay_policy>(
+          typed_buffer,
+          static_cast<std::ptrdiff_t>(block.offset / sizeof(element_t))),
+      block_id);
+}
+
+template <typename element_t>
+inline ScratchBuffer<element_t> ScratchPool::acquire(size_t num_elements) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return make_scratch_buffer<element_t>(
+      acquire_block(num_elements * sizeof(element_t), false));
+}
+
+template <typename element_t>
+inline ScratchBuffer<element_t> ScratchPool::acquire_zeroed(
+    size_t num_elements) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return make_scratch_buffer<element_t>(
+      acquire_block(num_elements * sizeof(element_t), true));
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SYCL_SCRATCH_POOL_HPP
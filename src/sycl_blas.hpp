@@ -28,6 +28,8 @@
 
 #include "executors/executor_sycl.hpp"
 
+#include "executors/executor_host.hpp"
+
 #include "executors/kernel_constructor.hpp"
 
 #include "interface/blas1_interface.hpp"
@@ -53,3 +55,5 @@
 #include "policy/sycl_policy_handler.hpp"
 
 #include "views/view_sycl.hpp"
+
+#include "views/view_host.hpp"
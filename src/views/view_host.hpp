@@ -0,0 +1,242 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename view_host.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_VIEW_HOST_HPP
+#define SYCL_BLAS_VIEW_HOST_HPP
+
+#include "blas_meta.h"
+#include "container/host_iterator.h"
+#include "views/view.h"
+#include <algorithm>
+
+namespace blas {
+
+/*!
+ * @brief View of a vector in host memory, used by the host_policy.
+ * @tparam ViewScalarT Value type of the vector.
+ */
+template <typename ViewScalarT, typename view_index_t,
+          typename view_increment_t>
+struct VectorView<ViewScalarT, ViewScalarT *, view_index_t, view_increment_t> {
+  using scalar_t = ViewScalarT;
+  using value_t = scalar_t;
+  using index_t = view_index_t;
+  using increment_t = view_increment_t;
+  using container_t = scalar_t *;
+  using self_t = VectorView<scalar_t, container_t, index_t, increment_t>;
+
+  // Pointer to the first element of the buffer
+  container_t data_;
+
+  // Number of elements in the buffer
+  const index_t size_data_;
+
+  // Number of elements in the vector that will be read.
+  const index_t size_;
+
+  // Number of elements offset into the data to start reading from.
+  const index_t disp_;
+
+  // Stride between data elements in memory, see the SYCL VectorView.
+  const increment_t stride_;
+
+  // Pointer to the first element of the view
+  scalar_t *ptr_;
+
+  static SYCL_BLAS_INLINE index_t calculate_input_data_size(
+      index_t data_size, increment_t stride, index_t size) noexcept {
+    increment_t const positive_stride = stride < 0 ? -stride : stride;
+    index_t const calc_size =
+        (data_size + positive_stride - 1) / positive_stride;
+    return std::min(size, calc_size);
+  }
+
+  SYCL_BLAS_INLINE VectorView(container_t data, index_t data_size,
+                              index_t disp, increment_t strd, index_t size)
+      : data_{data},
+        size_data_(data_size),
+        size_(calculate_input_data_size(data_size, strd, size)),
+        disp_((strd > 0) ? disp : disp + (size_ - 1) * (-strd)),
+        stride_(strd),
+        ptr_(data + disp_) {}
+
+  SYCL_BLAS_INLINE VectorView(BufferIterator<scalar_t, host_policy> data,
+                              increment_t strd, index_t size)
+      : VectorView(data.get_buffer().get(),
+                   static_cast<index_t>(data.get_size() + data.get_offset()),
+                   static_cast<index_t>(data.get_offset()), strd, size) {}
+
+  SYCL_BLAS_INLINE VectorView(self_t &opV, index_t disp, increment_t strd,
+                              index_t size)
+      : VectorView(opV.get_data(), opV.get_data_size(), disp, strd, size) {}
+
+  SYCL_BLAS_INLINE container_t &get_data() { return data_; }
+
+  SYCL_BLAS_INLINE scalar_t *get_pointer() const { return ptr_; }
+
+  SYCL_BLAS_INLINE index_t get_data_size() const { return size_data_; }
+
+  SYCL_BLAS_INLINE index_t get_size() const { return size_; }
+
+  SYCL_BLAS_INLINE index_t get_access_displacement() const { return disp_; }
+
+  SYCL_BLAS_INLINE increment_t get_stride() const { return stride_; }
+
+  /**** EVALUATING ****/
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<!use_as_ptr, scalar_t &>::type eval(
+      index_t i) {
+    return (stride_ == 1) ? *(ptr_ + i) : *(ptr_ + i * stride_);
+  }
+
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<!use_as_ptr, scalar_t>::type eval(
+      index_t i) const {
+    return (stride_ == 1) ? *(ptr_ + i) : *(ptr_ + i * stride_);
+  }
+
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<use_as_ptr, scalar_t &>::type eval(
+      index_t indx) {
+    return *(ptr_ + indx);
+  }
+
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<use_as_ptr, scalar_t>::type eval(
+      index_t indx) const noexcept {
+    return *(ptr_ + indx);
+  }
+
+  /* Nothing to bind, the memory is accessed directly */
+  template <typename handler_t>
+  SYCL_BLAS_INLINE void bind(handler_t &) {}
+
+  SYCL_BLAS_INLINE void adjust_access_displacement() { ptr_ = data_ + disp_; }
+};
+
+/*!
+ * @brief View of a matrix in host memory, used by the host_policy.
+ */
+template <class ViewScalarT, typename view_index_t, typename layout>
+struct MatrixView<ViewScalarT, ViewScalarT *, view_index_t, layout> {
+  using access_layout_t = layout;
+  using scalar_t = ViewScalarT;
+  using index_t = view_index_t;
+  using container_t = scalar_t *;
+  using self_t = MatrixView<scalar_t, container_t, index_t, layout>;
+
+  using value_t = scalar_t;
+  // Information related to the data
+  container_t data_;
+  // Information related to the operation
+  const index_t sizeR_;  // number of rows
+  const index_t sizeC_;  // number of columns
+  const index_t sizeL_;  // size of the leading dimension
+  const index_t disp_;   // displacementt od the first element
+  scalar_t *ptr_;        // pointer to the first element
+
+  /**** CONSTRUCTORS ****/
+  SYCL_BLAS_INLINE MatrixView(container_t data, index_t sizeR, index_t sizeC,
+                              index_t sizeL, index_t disp)
+      : data_{data},
+        sizeR_(sizeR),
+        sizeC_(sizeC),
+        sizeL_(sizeL),
+        disp_(disp),
+        ptr_(data + disp) {}
+
+  SYCL_BLAS_INLINE MatrixView(BufferIterator<scalar_t, host_policy> data,
+                              index_t sizeR, index_t sizeC, index_t sizeL)
+      : MatrixView(data.get_buffer().get(), sizeR, sizeC, sizeL,
+                   static_cast<index_t>(data.get_offset())) {}
+
+  SYCL_BLAS_INLINE MatrixView(self_t opM, index_t sizeR, index_t sizeC,
+                              index_t sizeL, index_t disp)
+      : MatrixView(opM.data_, sizeR, sizeC, sizeL, disp) {}
+
+  /**** RETRIEVING DATA ****/
+  SYCL_BLAS_INLINE container_t &get_data() { return data_; }
+
+  SYCL_BLAS_INLINE const index_t get_size() const { return sizeR_ * sizeC_; }
+
+  SYCL_BLAS_INLINE const index_t getSizeL() const { return sizeL_; }
+
+  SYCL_BLAS_INLINE const index_t get_size_row() const { return sizeR_; }
+
+  SYCL_BLAS_INLINE const index_t get_size_col() const { return sizeC_; }
+
+  SYCL_BLAS_INLINE index_t get_access_displacement() const { return disp_; }
+
+  SYCL_BLAS_INLINE scalar_t *get_pointer() const { return ptr_; }
+
+  /**** EVALUATING ***/
+  SYCL_BLAS_INLINE scalar_t &eval(index_t i, index_t j) {
+    return ((layout::is_col_major()) ? *(ptr_ + i + sizeL_ * j)
+                                     : *(ptr_ + j + sizeL_ * i));
+  }
+
+  SYCL_BLAS_INLINE scalar_t eval(index_t i, index_t j) const noexcept {
+    return ((layout::is_col_major()) ? *(ptr_ + i + sizeL_ * j)
+                                     : *(ptr_ + j + sizeL_ * i));
+  }
+
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<!use_as_ptr, scalar_t &>::type eval(
+      index_t indx) {
+    const index_t j = indx / sizeR_;
+    const index_t i = indx - sizeR_ * j;
+    return eval(i, j);
+  }
+
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<!use_as_ptr, scalar_t>::type eval(
+      index_t indx) const noexcept {
+    const index_t j = indx / sizeR_;
+    const index_t i = indx - sizeR_ * j;
+    return eval(i, j);
+  }
+
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<use_as_ptr, scalar_t &>::type eval(
+      index_t indx) {
+    return *(ptr_ + indx);
+  }
+
+  template <bool use_as_ptr = false>
+  SYCL_BLAS_INLINE typename std::enable_if<use_as_ptr, scalar_t>::type eval(
+      index_t indx) const noexcept {
+    return *(ptr_ + indx);
+  }
+
+  /* Nothing to bind, the memory is accessed directly */
+  template <typename handler_t>
+  SYCL_BLAS_INLINE void bind(handler_t &) {}
+
+  SYCL_BLAS_INLINE void adjust_access_displacement() { ptr_ = data_ + disp_; }
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_VIEW_HOST_HPP
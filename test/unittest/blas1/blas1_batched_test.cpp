@@ -0,0 +1,183 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Nrm2right (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a nrm2 of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a nrm2 of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int>;
+
+// The vectors of a batch are separated by a few unused elements
+inline int get_stride(int size, int inc) {
+  return size * inc + 3;
+}
+
+template <typename scalar_t>
+void run_axpy_test(const combination_t<scalar_t> combi) {
+  int size;
+  int inc;
+  int batch_size;
+  std::tie(size, inc, batch_size) = combi;
+  const scalar_t alpha = 1.5;
+  const int stride = get_stride(size, inc);
+
+  std::vector<scalar_t> x_v(stride * batch_size);
+  std::vector<scalar_t> y_v(stride * batch_size);
+  fill_random(x_v);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v = y_v;
+
+  // Reference implementation
+  for (int b = 0; b < batch_size; ++b) {
+    reference_blas::axpy(size, alpha, x_v.data() + b * stride, inc,
+                         y_cpu_v.data() + b * stride, inc);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_v.size());
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(y_v, y_v.size());
+
+  _axpy_batched(ex, size, alpha, gpu_x_v, inc, stride, gpu_y_v, inc, stride,
+                batch_size);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), y_v.size());
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+template <typename scalar_t>
+void run_dot_test(const combination_t<scalar_t> combi) {
+  int size;
+  int inc;
+  int batch_size;
+  std::tie(size, inc, batch_size) = combi;
+  const int stride = get_stride(size, inc);
+
+  std::vector<scalar_t> x_v(stride * batch_size);
+  std::vector<scalar_t> y_v(stride * batch_size);
+  fill_random(x_v);
+  fill_random(y_v);
+  std::vector<scalar_t> out_v(batch_size, 10.0);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_v.size());
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(y_v, y_v.size());
+  auto gpu_out_v = blas::make_sycl_iterator_buffer<scalar_t>(out_v, batch_size);
+
+  _dot_batched(ex, size, gpu_x_v, inc, stride, gpu_y_v, inc, stride, gpu_out_v,
+               batch_size);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_out_v, out_v.data(),
+                                                    batch_size);
+  ex.get_policy_handler().wait(event);
+
+  for (int b = 0; b < batch_size; ++b) {
+    auto out_cpu_s = reference_blas::dot(size, x_v.data() + b * stride, inc,
+                                         y_v.data() + b * stride, inc);
+    ASSERT_TRUE(utils::almost_equal(out_v[b], out_cpu_s));
+  }
+}
+
+template <typename scalar_t>
+void run_nrm2_test(const combination_t<scalar_t> combi) {
+  int size;
+  int inc;
+  int batch_size;
+  std::tie(size, inc, batch_size) = combi;
+  const int stride = get_stride(size, inc);
+
+  std::vector<scalar_t> x_v(stride * batch_size);
+  fill_random(x_v);
+  std::vector<scalar_t> out_v(batch_size, 10.0);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_v.size());
+  auto gpu_out_v = blas::make_sycl_iterator_buffer<scalar_t>(out_v, batch_size);
+
+  _nrm2_batched(ex, size, gpu_x_v, inc, stride, gpu_out_v, batch_size);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_out_v, out_v.data(),
+                                                    batch_size);
+  ex.get_policy_handler().wait(event);
+
+  for (int b = 0; b < batch_size; ++b) {
+    auto out_cpu_s = reference_blas::nrm2(size, x_v.data() + b * stride, inc);
+    ASSERT_TRUE(utils::almost_equal(out_v[b], out_cpu_s));
+  }
+}
+
+template <typename scalar_t>
+void run_iamax_test(const combination_t<scalar_t> combi) {
+  using tuple_t = IndexValueTuple<int, scalar_t>;
+
+  int size;
+  int inc;
+  int batch_size;
+  std::tie(size, inc, batch_size) = combi;
+  const int stride = get_stride(size, inc);
+
+  std::vector<scalar_t> x_v(stride * batch_size);
+  fill_random(x_v);
+  std::vector<tuple_t> out_v(batch_size, tuple_t(0, 0.0));
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_v.size());
+  auto gpu_out_v = blas::make_sycl_iterator_buffer<tuple_t>(out_v, batch_size);
+
+  _iamax_batched(ex, size, gpu_x_v, inc, stride, gpu_out_v, batch_size);
+  auto event = ex.get_policy_handler().copy_to_host(gpu_out_v, out_v.data(),
+                                                    batch_size);
+  ex.get_policy_handler().wait(event);
+
+  // The indices are relative to the vector they were found in
+  for (int b = 0; b < batch_size; ++b) {
+    const scalar_t *x_b = x_v.data() + b * stride;
+    int out_cpu_s = reference_blas::iamax(size, x_b, inc);
+    ASSERT_EQ(out_cpu_s, out_v[b].ind);
+    ASSERT_EQ(x_b[out_cpu_s * inc], out_v[b].val);
+  }
+}
+
+// The sizes cover vectors shorter than a work group and vectors strided over
+// by the work group
+const auto combi = ::testing::Combine(::testing::Values(1, 11, 1002),  // size
+                                      ::testing::Values(1, 3),         // inc
+                                      ::testing::Values(1, 7, 300)     // batch
+);
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(AxpyBatched, AxpyBatched, run_axpy_test,
+                               combination_t, combi);
+BLAS_REGISTER_TEST_CUSTOM_NAME(DotBatched, DotBatched, run_dot_test,
+                               combination_t, combi);
+BLAS_REGISTER_TEST_CUSTOM_NAME(Nrm2Batched, Nrm2Batched, run_nrm2_test,
+                               combination_t, combi);
+BLAS_REGISTER_TEST_CUSTOM_NAME(IamaxBatched, IamaxBatched, run_iamax_test,
+                               combination_t, combi);
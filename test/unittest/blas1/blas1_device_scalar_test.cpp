@@ -0,0 +1,193 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_device_scalar_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+
+  // Reference implementation: y = dot(x, x) * x + y, then y *= dot(x, x)
+  scalar_t alpha = reference_blas::dot(size, x_v.data(), incX, x_v.data(),
+                                       incX);
+  reference_blas::axpy(size, alpha, x_v.data(), incX, y_cpu_v.data(), incY);
+  reference_blas::scal(size, alpha, y_cpu_v.data(), incY);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+  auto gpu_alpha = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+
+  // The scalar produced by _dot is consumed on the device, without any
+  // synchronization with the host in between
+  _dot(ex, size, gpu_x_v, incX, gpu_x_v, incX, gpu_alpha);
+  _axpy(ex, size, gpu_alpha, gpu_x_v, incX, gpu_y_v, incY);
+  _scal(ex, size, gpu_alpha, gpu_y_v, incY);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), size * incY);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3)                    // incY
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+#endif
+
+BLAS_REGISTER_TEST(DeviceScalar, combination_t, combi);
+
+template <typename scalar_t>
+using rot_combination_t = std::tuple<int, int, int>;
+
+// _rot with the cosine and the sine copied to device memory
+template <typename scalar_t>
+void run_rot_test(const rot_combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+  std::vector<scalar_t> cos_s{0.6};
+  std::vector<scalar_t> sin_s{-0.8};
+
+  reference_blas::rot(size, x_cpu_v.data(), incX, y_cpu_v.data(), incY,
+                      cos_s[0], sin_s[0]);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(y_v, size * incY);
+  auto gpu_cos = blas::make_sycl_iterator_buffer<scalar_t>(cos_s, 1);
+  auto gpu_sin = blas::make_sycl_iterator_buffer<scalar_t>(sin_s, 1);
+
+  _rot(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_cos, gpu_sin);
+  auto event_x =
+      ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(), size * incX);
+  auto event_y =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), size * incY);
+  ex.get_policy_handler().wait(event_x);
+  ex.get_policy_handler().wait(event_y);
+
+  ASSERT_TRUE(utils::compare_vectors(x_v, x_cpu_v));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+const auto rot_combi =
+    ::testing::Combine(::testing::Values(11, 1002),  // size
+                       ::testing::Values(1, 4),      // incX
+                       ::testing::Values(1, 3)       // incY
+    );
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(DeviceScalarRot, DeviceScalarRot, run_rot_test,
+                               rot_combination_t, rot_combi);
+
+template <typename scalar_t>
+using scal_combination_t = std::tuple<int, int, scalar_t>;
+
+// _scal with alpha copied to device memory. A device alpha of zero zeroes x
+// as the host one does, even when x holds NaNs
+template <typename scalar_t>
+void run_scal_test(const scal_combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  scalar_t alpha;
+  std::tie(size, incX, alpha) = combi;
+
+  const bool is_alpha_zero = alpha == scalar_t{0};
+  std::vector<scalar_t> x_v(size * incX,
+                            std::numeric_limits<scalar_t>::quiet_NaN());
+  if (!is_alpha_zero) {
+    fill_random(x_v);
+  }
+  std::vector<scalar_t> x_cpu_v(x_v);
+  std::vector<scalar_t> alpha_s{alpha};
+
+  if (is_alpha_zero) {
+    for (int i = 0; i < size; ++i) {
+      x_cpu_v[i * incX] = scalar_t{0};
+    }
+  } else {
+    reference_blas::scal(size, alpha, x_cpu_v.data(), incX);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, size * incX);
+  auto gpu_alpha = blas::make_sycl_iterator_buffer<scalar_t>(alpha_s, 1);
+
+  _scal(ex, size, gpu_alpha, gpu_x_v, incX);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_x_v, x_v.data(), size * incX);
+  ex.get_policy_handler().wait(event);
+
+  // Only the elements of the vector are compared, the NaNs between them are
+  // left as they are
+  for (int i = 0; i < size; ++i) {
+    ASSERT_TRUE(utils::almost_equal(x_v[i * incX], x_cpu_v[i * incX]));
+  }
+}
+
+const auto scal_combi =
+    ::testing::Combine(::testing::Values(11, 1002),  // size
+                       ::testing::Values(1, 4),      // incX
+                       ::testing::Values(0.0, 2.5)   // alpha
+    );
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(DeviceScalarScal, DeviceScalarScal,
+                               run_scal_test, scal_combination_t, scal_combi);
@@ -0,0 +1,136 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Nrm2right (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a nrm2 of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a nrm2 of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_fused_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  int incX;
+  int incY;
+  std::tie(size, alpha, incX, incY) = combi;
+  const scalar_t beta = 0.5;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size * incY);
+  fill_random(y_v);
+  std::vector<scalar_t> z_v(size);
+  fill_random(z_v);
+
+  // Reference implementation
+  std::vector<scalar_t> y_axpy_cpu_v(y_v);
+  reference_blas::axpy(size, alpha, x_v.data(), incX, y_axpy_cpu_v.data(),
+                       incY);
+  auto dot_cpu_s =
+      reference_blas::dot(size, y_axpy_cpu_v.data(), incY, z_v.data(), 1);
+  auto nrm2_cpu_s = reference_blas::nrm2(size, y_axpy_cpu_v.data(), incY);
+  std::vector<scalar_t> y_xpay_cpu_v(y_v);
+  reference_blas::scal(size, alpha, y_xpay_cpu_v.data(), incY);
+  reference_blas::axpy(size, scalar_t{1}, x_v.data(), incX,
+                       y_xpay_cpu_v.data(), incY);
+  std::vector<scalar_t> w_cpu_v(size);
+  reference_blas::copy(size, y_v.data(), incY, w_cpu_v.data(), 1);
+  reference_blas::scal(size, beta, w_cpu_v.data(), 1);
+  reference_blas::axpy(size, alpha, x_v.data(), incX, w_cpu_v.data(), 1);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_z_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size));
+  ex.get_policy_handler().copy_to_device(z_v.data(), gpu_z_v, size);
+  auto gpu_out_s = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+  std::vector<scalar_t> y_out_v(size * incY);
+  scalar_t out_s;
+
+  // _axpy_dot
+  {
+    auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+    ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+    _axpy_dot(ex, size, alpha, gpu_x_v, incX, gpu_y_v, incY, gpu_z_v, 1,
+              gpu_out_s);
+    auto event = blas::concatenate_vectors(
+        ex.get_policy_handler().copy_to_host(gpu_y_v, y_out_v.data(),
+                                             size * incY),
+        ex.get_policy_handler().copy_to_host(gpu_out_s, &out_s, 1));
+    ex.get_policy_handler().wait(event);
+    ASSERT_TRUE(utils::compare_vectors(y_out_v, y_axpy_cpu_v));
+    ASSERT_TRUE(utils::almost_equal(out_s, dot_cpu_s));
+  }
+
+  // _axpy_nrm2
+  {
+    auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+    ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+    _axpy_nrm2(ex, size, alpha, gpu_x_v, incX, gpu_y_v, incY, gpu_out_s);
+    auto event = blas::concatenate_vectors(
+        ex.get_policy_handler().copy_to_host(gpu_y_v, y_out_v.data(),
+                                             size * incY),
+        ex.get_policy_handler().copy_to_host(gpu_out_s, &out_s, 1));
+    ex.get_policy_handler().wait(event);
+    ASSERT_TRUE(utils::compare_vectors(y_out_v, y_axpy_cpu_v));
+    ASSERT_TRUE(utils::almost_equal(out_s, nrm2_cpu_s));
+  }
+
+  // _xpay
+  {
+    auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+    ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+    _xpay(ex, size, gpu_x_v, incX, alpha, gpu_y_v, incY);
+    auto event = ex.get_policy_handler().copy_to_host(gpu_y_v, y_out_v.data(),
+                                                      size * incY);
+    ex.get_policy_handler().wait(event);
+    ASSERT_TRUE(utils::compare_vectors(y_out_v, y_xpay_cpu_v));
+  }
+
+  // _waxpby
+  {
+    auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incY));
+    ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size * incY);
+    auto gpu_w_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size));
+    std::vector<scalar_t> w_v(size);
+    _waxpby(ex, size, alpha, gpu_x_v, incX, beta, gpu_y_v, incY, gpu_w_v, 1);
+    auto event =
+        ex.get_policy_handler().copy_to_host(gpu_w_v, w_v.data(), size);
+    ex.get_policy_handler().wait(event);
+    ASSERT_TRUE(utils::compare_vectors(w_v, w_cpu_v));
+  }
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(0.0, 1.5),  // alpha
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+
+BLAS_REGISTER_TEST(Fused, combination_t, combi);
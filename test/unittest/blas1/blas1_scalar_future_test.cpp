@@ -0,0 +1,95 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_scalar_future_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  std::tie(size, incX) = combi;
+
+  // Input vectors
+  std::vector<scalar_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size);
+  fill_random(y_v);
+
+  // Reference implementation
+  auto dot_cpu = reference_blas::dot(size, x_v.data(), incX, y_v.data(), 1);
+  auto asum_cpu = reference_blas::asum(size, x_v.data(), incX);
+  auto nrm2_cpu = reference_blas::nrm2(size, x_v.data(), incX);
+  int iamax_cpu = reference_blas::iamax(size, x_v.data(), incX);
+  int iamin_cpu = reference_blas::iamin(size, x_v.data(), incX);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size * incX));
+  ex.get_policy_handler().copy_to_device(x_v.data(), gpu_x_v, size * incX);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(int(size));
+  ex.get_policy_handler().copy_to_device(y_v.data(), gpu_y_v, size);
+
+  // All the results share the same array and are read after the last call
+  blas::ResultArray results;
+  auto dot_res = _dot(ex, size, gpu_x_v, incX, gpu_y_v, 1, results);
+  auto asum_res = _asum(ex, size, gpu_x_v, incX, results);
+  auto nrm2_res = _nrm2(ex, size, gpu_x_v, incX, results);
+  auto iamax_res = _iamax(ex, size, gpu_x_v, incX, results);
+  auto iamin_res = _iamin(ex, size, gpu_x_v, incX, results);
+
+  // Validate the results
+  ASSERT_TRUE(utils::almost_equal(dot_res.get(), dot_cpu));
+  ASSERT_TRUE(utils::almost_equal(asum_res.get(), asum_cpu));
+  ASSERT_TRUE(utils::almost_equal(nrm2_res.get(), nrm2_cpu));
+  ASSERT_EQ(iamax_cpu, iamax_res.get());
+  ASSERT_EQ(iamin_cpu, iamin_res.get());
+  ASSERT_TRUE(dot_res.is_ready());
+
+  // The slots can be reused once the results have been read
+  results.reset();
+  auto asum_again = _asum(ex, size, gpu_x_v, incX, results);
+  ASSERT_TRUE(utils::almost_equal(asum_again.get(), asum_cpu));
+
+  ex.get_policy_handler().get_queue().wait();
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4)                    // incX
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4)       // incX
+);
+#endif
+
+BLAS_REGISTER_TEST(ScalarFuture, combination_t, combi);
@@ -0,0 +1,127 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<int, int, T, T, bool, int, int, gemm_batch_type_t>;
+
+// Interleaves batch_size operands of operand_size elements stored one after
+// the other
+template <typename scalar_t>
+std::vector<scalar_t> interleave(const std::vector<scalar_t> &input,
+                                 int operand_size, int batch_size) {
+  std::vector<scalar_t> output(operand_size * batch_size);
+  for (int b = 0; b < batch_size; ++b) {
+    for (int e = 0; e < operand_size; ++e) {
+      output[e * batch_size + b] = input[b * operand_size + e];
+    }
+  }
+  return output;
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  int inc;
+  int batch_size;
+  gemm_batch_type_t batch_type;
+  std::tie(m, n, alpha, beta, trans, inc, batch_size, batch_type) = combi;
+
+  const char *t_str = trans ? "t" : "n";
+  const bool is_interleaved = batch_type == gemm_batch_type_t::interleaved;
+
+  const int lda = m + 1;
+  const int x_rows = trans ? m : n;
+  const int y_rows = trans ? n : m;
+  const int a_size = lda * n;
+  const int x_size = 1 + (x_rows - 1) * std::abs(inc);
+  const int y_size = 1 + (y_rows - 1) * std::abs(inc);
+
+  // The strided operands are separated by some padding, the interleaved ones
+  // are contiguous
+  const int pad = is_interleaved ? 0 : 3;
+  const int stride_a = a_size + pad;
+  const int stride_x = x_size + pad;
+  const int stride_y = y_size + pad;
+
+  std::vector<scalar_t> a_m(stride_a * batch_size);
+  std::vector<scalar_t> x_v(stride_x * batch_size);
+  std::vector<scalar_t> y_v_cpu(stride_y * batch_size);
+
+  fill_random(a_m);
+  fill_random(x_v);
+  fill_random(y_v_cpu);
+  std::vector<scalar_t> y_v_gpu_result = y_v_cpu;
+
+  // Each product of the batch is checked against the system GEMV
+  for (int b = 0; b < batch_size; ++b) {
+    reference_blas::gemv(t_str, m, n, alpha, a_m.data() + b * stride_a, lda,
+                         x_v.data() + b * stride_x, inc, beta,
+                         y_v_cpu.data() + b * stride_y, inc);
+  }
+
+  if (is_interleaved) {
+    a_m = interleave(a_m, stride_a, batch_size);
+    x_v = interleave(x_v, stride_x, batch_size);
+    y_v_gpu_result = interleave(y_v_gpu_result, stride_y, batch_size);
+    y_v_cpu = interleave(y_v_cpu, stride_y, batch_size);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_v.size());
+  auto v_y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(
+      y_v_gpu_result, y_v_gpu_result.size());
+
+  _gemv_batched(ex, *t_str, m, n, alpha, m_a_gpu, lda, stride_a, v_x_gpu, inc,
+                stride_x, beta, v_y_gpu, inc, stride_y, batch_size,
+                batch_type);
+  auto event = ex.get_policy_handler().copy_to_host(
+      v_y_gpu, y_v_gpu_result.data(), y_v_gpu_result.size());
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v_gpu_result, y_v_cpu));
+}
+
+const auto combi = ::testing::Combine(
+    ::testing::Values(11, 130),                      // m
+    ::testing::Values(14, 67),                       // n
+    ::testing::Values(1.5),                          // alpha
+    ::testing::Values(0.0, 1.5),                     // beta
+    ::testing::Values(false, true),                  // trans
+    ::testing::Values(1, 2, -3),                     // inc
+    ::testing::Values(1, 5),                         // batch_size
+    ::testing::Values(gemm_batch_type_t::strided,
+                      gemm_batch_type_t::interleaved)  // batch_type
+);
+
+BLAS_REGISTER_TEST(GemvBatched, combination_t, combi);
@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_device_scalar_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+#include "sycl_blas.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, bool, bool, scalar_t>;
+
+// _gemv with alpha produced by _dot and beta copied to device memory, through
+// both the local memory and the no local memory kernels. A device beta of
+// zero does not read y, which is filled with NaNs
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  bool trans;
+  bool local;
+  scalar_t beta;
+  std::tie(m, n, trans, local, beta) = combi;
+
+  const int x_size = trans ? m : n;
+  const int y_size = trans ? n : m;
+  const bool is_beta_zero = beta == scalar_t{0};
+  std::vector<scalar_t> a_m(m * n);
+  fill_random(a_m);
+  std::vector<scalar_t> x_v(x_size);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(y_size,
+                            std::numeric_limits<scalar_t>::quiet_NaN());
+  std::vector<scalar_t> y_cpu_v(y_size, scalar_t{0});
+  if (!is_beta_zero) {
+    fill_random(y_v);
+    y_cpu_v = y_v;
+  }
+  std::vector<scalar_t> beta_s{beta};
+
+  const scalar_t alpha =
+      reference_blas::dot(x_size, x_v.data(), 1, x_v.data(), 1);
+  reference_blas::gemv(trans ? "t" : "n", m, n, alpha, a_m.data(), m,
+                       x_v.data(), 1, beta, y_cpu_v.data(), 1);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_a_m = blas::make_sycl_iterator_buffer<scalar_t>(a_m, m * n);
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(y_v, y_size);
+  auto gpu_alpha = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+  auto gpu_beta = blas::make_sycl_iterator_buffer<scalar_t>(beta_s, 1);
+
+  _dot(ex, x_size, gpu_x_v, 1, gpu_x_v, 1, gpu_alpha);
+  if (trans && local) {
+    blas::internal::_gemv_impl<64, 32, blas::gemv_memory_t::local,
+                               blas::transpose_type::Transposed>(
+        ex, m, n, gpu_alpha, gpu_a_m, m, gpu_x_v, 1, gpu_beta, gpu_y_v, 1);
+  } else if (trans) {
+    blas::internal::_gemv_impl<64, 32, blas::gemv_memory_t::no_local,
+                               blas::transpose_type::Transposed>(
+        ex, m, n, gpu_alpha, gpu_a_m, m, gpu_x_v, 1, gpu_beta, gpu_y_v, 1);
+  } else if (local) {
+    blas::internal::_gemv_impl<64, 32, blas::gemv_memory_t::local,
+                               blas::transpose_type::Normal>(
+        ex, m, n, gpu_alpha, gpu_a_m, m, gpu_x_v, 1, gpu_beta, gpu_y_v, 1);
+  } else {
+    blas::internal::_gemv_impl<64, 32, blas::gemv_memory_t::no_local,
+                               blas::transpose_type::Normal>(
+        ex, m, n, gpu_alpha, gpu_a_m, m, gpu_x_v, 1, gpu_beta, gpu_y_v, 1);
+  }
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_y_v, y_v.data(), y_size);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(7, 130),       // m
+                       ::testing::Values(9, 257),       // n
+                       ::testing::Values(false, true),  // trans
+                       ::testing::Values(true, false),  // local
+                       ::testing::Values(0.0, -0.5)     // beta
+    );
+
+BLAS_REGISTER_TEST(GemvDeviceScalar, combination_t, combi);
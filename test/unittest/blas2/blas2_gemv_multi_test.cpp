@@ -0,0 +1,102 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_multi_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, T, T, bool, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int num_vectors;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  int ld_mul;
+  int ld_add;
+  std::tie(m, n, num_vectors, alpha, beta, trans, ld_mul, ld_add) = combi;
+
+  const char *t_str = trans ? "t" : "n";
+
+  const int lda = ld_mul * m;
+  const int x_rows = trans ? m : n;
+  const int y_rows = trans ? n : m;
+  const int ldx = x_rows + ld_add;
+  const int ldy = y_rows + ld_add;
+
+  int a_size = lda * n;
+  int x_size = ldx * num_vectors;
+  int y_size = ldy * num_vectors;
+
+  // Input matrix
+  std::vector<scalar_t> a_m(a_size);
+  // Input vectors, one per column
+  std::vector<scalar_t> x_m(x_size);
+  // Output vectors, one per column
+  std::vector<scalar_t> y_m_gpu_result(y_size, scalar_t(10.0));
+  // Output vectors of the reference
+  std::vector<scalar_t> y_m_cpu(y_size, scalar_t(10.0));
+
+  fill_random(a_m);
+  fill_random(x_m);
+
+  // Each vector is checked against the system GEMV
+  for (int j = 0; j < num_vectors; ++j) {
+    reference_blas::gemv(t_str, m, n, alpha, a_m.data(), lda,
+                         x_m.data() + j * ldx, 1, beta,
+                         y_m_cpu.data() + j * ldy, 1);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_size);
+  auto m_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_m, x_size);
+  auto m_y_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(y_m_gpu_result, y_size);
+
+  _gemv_multi(ex, *t_str, m, n, num_vectors, alpha, m_a_gpu, lda, m_x_gpu, ldx,
+              beta, m_y_gpu, ldy);
+  auto event = ex.get_policy_handler().copy_to_host(
+      m_y_gpu, y_m_gpu_result.data(), y_size);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_m_gpu_result, y_m_cpu));
+}
+
+// The numbers of vectors cover the three register blockings and the split of
+// more than 16 vectors
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1023),         // m
+                       ::testing::Values(14, 1010),         // n
+                       ::testing::Values(1, 3, 8, 13, 20),  // num_vectors
+                       ::testing::Values(1.5),              // alpha
+                       ::testing::Values(0.0, 1.5),         // beta
+                       ::testing::Values(false, true),      // trans
+                       ::testing::Values(2),                // ld_mul
+                       ::testing::Values(0, 3)              // ld_add
+    );
+
+BLAS_REGISTER_TEST(GemvMulti, combination_t, combi);
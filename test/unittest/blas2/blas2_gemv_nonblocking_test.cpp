@@ -0,0 +1,114 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_nonblocking_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+#include <chrono>
+#include <future>
+
+template <typename T>
+using combination_t = std::tuple<int, int, bool>;
+
+/* Holds a host accessor on the matrix so that no kernel reading it can start,
+ * then submits a sequence of gemv calls from another thread. The calls must
+ * all return while the device is still blocked: a routine waiting for its own
+ * kernels (e.g. through the destructor of a temporary buffer) would never
+ * return before the host accessor is released. */
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  bool trans;
+  std::tie(m, n, trans) = combi;
+
+  constexpr int num_calls = 100;
+  const char *t_str = trans ? "t" : "n";
+  const scalar_t alpha = 1.5;
+  const scalar_t beta = 0.0;
+
+  int a_size = m * n;
+  int x_size = trans ? m : n;
+  int y_size = trans ? n : m;
+
+  std::vector<scalar_t> a_m(a_size);
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v_gpu_result(y_size, scalar_t(10.0));
+  std::vector<scalar_t> y_v_cpu(y_size, scalar_t(10.0));
+
+  fill_random(a_m);
+  fill_random(x_v);
+
+  // With beta = 0 every call writes the same result
+  reference_blas::gemv(t_str, m, n, alpha, a_m.data(), m, x_v.data(), 1, beta,
+                       y_v_cpu.data(), 1);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_size);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+  auto v_y_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(y_v_gpu_result, y_size);
+
+  using host_accessor_t =
+      decltype(m_a_gpu.get_buffer()
+                   .template get_access<cl::sycl::access::mode::read_write>());
+  std::unique_ptr<host_accessor_t> host_lock(new host_accessor_t(
+      m_a_gpu.get_buffer()
+          .template get_access<cl::sycl::access::mode::read_write>()));
+
+  auto submission = std::async(std::launch::async, [&]() {
+    typename test_executor_t::policy_t::event_t events;
+    for (int i = 0; i < num_calls; ++i) {
+      append_vector(events, _gemv(ex, *t_str, m, n, alpha, m_a_gpu, m, v_x_gpu,
+                                  1, beta, v_y_gpu, 1));
+    }
+    return events;
+  });
+
+  const bool returned = submission.wait_for(std::chrono::seconds(60)) ==
+                        std::future_status::ready;
+  // Nothing can have run on the device while the matrix is locked
+  const bool device_blocked =
+      returned && !test_executor_t::policy_t::is_complete(submission.get());
+
+  // Unblock the device and let all the queued calls finish
+  host_lock.reset();
+  ex.get_policy_handler().wait();
+
+  ASSERT_TRUE(returned);
+  ASSERT_TRUE(device_blocked);
+
+  auto event = ex.get_policy_handler().copy_to_host(
+      v_y_gpu, y_v_gpu_result.data(), y_size);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v_gpu_result, y_v_cpu));
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1023),     // m
+                                      ::testing::Values(14, 1010),     // n
+                                      ::testing::Values(false, true)  // trans
+);
+
+BLAS_REGISTER_TEST(GemvNonBlocking, combination_t, combi);
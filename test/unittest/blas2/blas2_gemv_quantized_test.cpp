@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_quantized_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<int, int, T, T, bool, blas::gemv_weight_t, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  blas::gemv_weight_t weight_type;
+  int ld_add;
+  std::tie(m, n, alpha, beta, trans, weight_type, ld_add) = combi;
+
+  const char *t_str = trans ? "t" : "n";
+  const bool is_int4 = weight_type == blas::gemv_weight_t::int4;
+  const int max_weight = is_int4 ? 7 : 127;
+
+  // Two rows of int4 weights share a byte, so their leading dimension is even
+  const int lda = m;
+  const int ldq = m + (is_int4 ? m % 2 : 0) + ld_add;
+  const int a_size = lda * n;
+  const int q_size = (is_int4 ? ldq / 2 : ldq) * n;
+  const int x_size = trans ? m : n;
+  const int y_size = trans ? n : m;
+
+  std::vector<scalar_t> a_m(a_size);
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v_gpu_result(y_size, scalar_t(10.0));
+  std::vector<scalar_t> y_v_cpu(y_size, scalar_t(10.0));
+  std::vector<int8_t> q_m(q_size);
+  std::vector<scalar_t> scale(m);
+
+  fill_random(a_m);
+  fill_random(x_v);
+  // A row of zeros gets a zero scale
+  for (int j = 0; j < n; ++j) {
+    a_m[j * lda] = scalar_t(0);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_size);
+  auto m_q_gpu = blas::make_sycl_iterator_buffer<int8_t>(q_m, q_size);
+  auto v_scale_gpu = blas::make_sycl_iterator_buffer<scalar_t>(scale, m);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+  auto v_y_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(y_v_gpu_result, y_size);
+
+  _gemv_quantize_weights(ex, m, n, m_a_gpu, lda, weight_type, m_q_gpu, ldq,
+                         v_scale_gpu);
+  auto event =
+      ex.get_policy_handler().copy_to_host(m_q_gpu, q_m.data(), q_size);
+  ex.get_policy_handler().wait(event);
+  event = ex.get_policy_handler().copy_to_host(v_scale_gpu, scale.data(), m);
+  ex.get_policy_handler().wait(event);
+
+  // Every element is within half a step of its weight, and the reference
+  // product is computed with the dequantized matrix
+  std::vector<scalar_t> a_dequantized(a_size);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      const int index = i + j * ldq;
+      int weight;
+      if (is_int4) {
+        const int packed = q_m[index / 2];
+        weight = ((i % 2) ? packed : int(int8_t(packed << 4))) >> 4;
+      } else {
+        weight = q_m[index];
+      }
+      ASSERT_LE(std::abs(weight), max_weight);
+      const scalar_t value = scale[i] * static_cast<scalar_t>(weight);
+      ASSERT_LE(std::abs(value - a_m[i + j * lda]),
+                scale[i] * scalar_t(0.5001));
+      a_dequantized[i + j * lda] = value;
+    }
+  }
+  ASSERT_EQ(scale[0], scalar_t(0));
+
+  reference_blas::gemv(t_str, m, n, alpha, a_dequantized.data(), lda,
+                       x_v.data(), 1, beta, y_v_cpu.data(), 1);
+
+  _gemv_quantized(ex, *t_str, m, n, alpha, m_q_gpu, ldq, weight_type,
+                  v_scale_gpu, v_x_gpu, 1, beta, v_y_gpu, 1);
+  event = ex.get_policy_handler().copy_to_host(
+      v_y_gpu, y_v_gpu_result.data(), y_size);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(y_v_gpu_result, y_v_cpu));
+}
+
+// The odd numbers of rows leave half of the last byte of each column of int4
+// weights unused
+const auto combi = ::testing::Combine(
+    ::testing::Values(11, 1023),                          // m
+    ::testing::Values(14, 1010),                          // n
+    ::testing::Values(1.5),                               // alpha
+    ::testing::Values(0.0, 1.5),                          // beta
+    ::testing::Values(false, true),                       // trans
+    ::testing::Values(blas::gemv_weight_t::int8,          // weight_type
+                      blas::gemv_weight_t::int4),
+    ::testing::Values(0, 2)                               // ld_add
+);
+
+// The weights are int8_t and the scales and vectors float whatever the data
+// types of the build
+BLAS_REGISTER_TEST_FLOAT(GemvQuantized, GemvQuantized, run_test,
+                         combination_t, combi);
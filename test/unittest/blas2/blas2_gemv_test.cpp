@@ -105,3 +105,72 @@ const auto combi = ::testing::Combine(::testing::Values(11, 1023),     // m
 #endif
 
 BLAS_REGISTER_TEST(Gemv, combination_t, combi);
+
+template <typename T>
+using after_dot_combination_t = std::tuple<int, int, int, bool>;
+
+// A reduction followed by a gemv whose work groups split x on the same
+// executor: the gemv counters come from the scratch pool, which may hand
+// back the block of counters just used by the reduction
+template <typename scalar_t>
+void run_after_dot_test(const after_dot_combination_t<scalar_t> combi) {
+  int short_dim;
+  int long_dim;
+  int dot_size;
+  bool trans;
+  std::tie(short_dim, long_dim, dot_size, trans) = combi;
+
+  // x runs along the long dimension
+  const int m = trans ? long_dim : short_dim;
+  const int n = trans ? short_dim : long_dim;
+  const char *t_str = trans ? "t" : "n";
+  const scalar_t alpha = 1.5;
+  const scalar_t beta = 0.5;
+  const int x_size = trans ? m : n;
+  const int y_size = trans ? n : m;
+
+  std::vector<scalar_t> a_m(m * n);
+  std::vector<scalar_t> x_v(x_size);
+  std::vector<scalar_t> y_v(y_size);
+  std::vector<scalar_t> d_v(dot_size);
+  fill_random(a_m);
+  fill_random(x_v);
+  fill_random(y_v);
+  fill_random(d_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+  std::vector<scalar_t> dot_result(1);
+
+  const scalar_t dot_cpu =
+      reference_blas::dot(dot_size, d_v.data(), 1, d_v.data(), 1);
+  reference_blas::gemv(t_str, m, n, alpha, a_m.data(), m, x_v.data(), 1, beta,
+                       y_cpu_v.data(), 1);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, m * n);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+  auto v_y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_v, y_size);
+  auto v_d_gpu = blas::make_sycl_iterator_buffer<scalar_t>(d_v, dot_size);
+  auto dot_gpu = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+
+  _dot(ex, dot_size, v_d_gpu, 1, v_d_gpu, 1, dot_gpu);
+  _gemv(ex, *t_str, m, n, alpha, m_a_gpu, m, v_x_gpu, 1, beta, v_y_gpu, 1);
+  auto event =
+      ex.get_policy_handler().copy_to_host(v_y_gpu, y_v.data(), y_size);
+  ex.get_policy_handler().wait(event);
+  event = ex.get_policy_handler().copy_to_host(dot_gpu, dot_result.data(), 1);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::almost_equal(dot_result[0], dot_cpu));
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+}
+
+// Few long dot products, so that the work groups of a block of y split x
+const auto after_dot_combi =
+    ::testing::Combine(::testing::Values(16),            // short dimension
+                       ::testing::Values(4096, 16384),   // long dimension
+                       ::testing::Values(100000),        // dot size
+                       ::testing::Values(false, true));  // trans
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(GemvAfterDot, GemvAfterDot, run_after_dot_test,
+                               after_dot_combination_t, after_dot_combi);
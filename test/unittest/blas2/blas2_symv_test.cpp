@@ -85,7 +85,7 @@ const auto combi =
 #else
 // For the purpose of travis and other slower platforms, we need a faster test
 const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
-                                      ::testing::Values(2025),      // n
+                                      ::testing::Values(14, 2025),  // n
                                       ::testing::Values(0.0, 1.5),  // alpha
                                       ::testing::Values(2),         // lda_mul
                                       ::testing::Values(2),         // incX
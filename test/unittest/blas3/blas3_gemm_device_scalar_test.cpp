@@ -0,0 +1,91 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_device_scalar_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, char, char, scalar_t>;
+
+// _gemm with alpha and beta copied to device memory. A device beta of zero
+// does not read C, which is filled with NaNs
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t beta;
+  std::tie(m, n, k, transa, transb, beta) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+  const int lda = std::max((transa != 'n') ? k : m, 1);
+  const int ldb = std::max((transb != 'n') ? n : k, 1);
+  const bool is_beta_zero = beta == scalar_t{0};
+  // At least one element, so that the buffers are not empty when k is 0
+  std::vector<scalar_t> a_m(std::max(lda * ((transa != 'n') ? m : k), 1));
+  fill_random(a_m);
+  std::vector<scalar_t> b_m(std::max(ldb * ((transb != 'n') ? k : n), 1));
+  fill_random(b_m);
+  std::vector<scalar_t> c_m(m * n, std::numeric_limits<scalar_t>::quiet_NaN());
+  std::vector<scalar_t> c_cpu_m(m * n, scalar_t{0});
+  if (!is_beta_zero) {
+    fill_random(c_m);
+    c_cpu_m = c_m;
+  }
+  std::vector<scalar_t> alpha_s{1.5};
+  std::vector<scalar_t> beta_s{beta};
+
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha_s[0], a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_cpu_m.data(), m);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_a_m = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto gpu_b_m = blas::make_sycl_iterator_buffer<scalar_t>(b_m, b_m.size());
+  auto gpu_c_m = blas::make_sycl_iterator_buffer<scalar_t>(c_m, m * n);
+  auto gpu_alpha = blas::make_sycl_iterator_buffer<scalar_t>(alpha_s, 1);
+  auto gpu_beta = blas::make_sycl_iterator_buffer<scalar_t>(beta_s, 1);
+
+  _gemm(ex, transa, transb, m, n, k, gpu_alpha, gpu_a_m, lda, gpu_b_m, ldb,
+        gpu_beta, gpu_c_m, m);
+  auto event =
+      ex.get_policy_handler().copy_to_host(gpu_c_m, c_m.data(), m * n);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_cpu_m));
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(7, 65),      // m
+                       ::testing::Values(9, 33),      // n
+                       ::testing::Values(0, 3, 70),   // k
+                       ::testing::Values('n', 't'),   // transa
+                       ::testing::Values('n', 't'),   // transb
+                       ::testing::Values(0.0, 2.5));  // beta
+
+BLAS_REGISTER_TEST(GemmDeviceScalar, combination_t, combi);
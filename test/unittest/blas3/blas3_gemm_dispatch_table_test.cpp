@@ -0,0 +1,150 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_dispatch_table_test.cpp
+ *
+ **************************************************************************/
+#include "blas3_gemm_common.hpp"
+#include "blas_test.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+template <typename scalar_t>
+using combination_t = std::tuple<std::string, int, char, char>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  std::string config;
+  int size;
+  char transa;
+  char transb;
+  std::tie(config, size, transa, transb) = combi;
+
+  // The rule applies to the GEMM of any device, the configurations which are
+  // not compiled for the backend fall back to its thresholds
+  std::stringstream table;
+  table << "# device trans_a trans_b max_m max_n max_k max_batch_size config\n"
+        << "* " << transa << " " << transb << " * * * 1 " << config << "\n";
+  auto& dispatch_table = blas::GemmDispatchTable::get_default();
+  dispatch_table.clear();
+  dispatch_table.load(table);
+  ASSERT_EQ(dispatch_table.size(), size_t{1});
+  ASSERT_EQ(dispatch_table.find("host", transa == 't', transb == 't', size,
+                                size, size, 1),
+            config);
+  ASSERT_EQ(dispatch_table.find("host", transa == 't', transb == 't', size,
+                                size, size, 2),
+            std::string{});
+
+  verify_gemm<scalar_t>(gemm_arguments_t<scalar_t>{
+      0, 1, size, size, size, transa, transb, scalar_t{1.5}, scalar_t{0.5}, 1,
+      1, 1, gemm_batch_type_t::strided});
+  dispatch_table.clear();
+}
+
+// Configurations compiled for the default CPU and the INTEL_GPU targets
+const std::string cpu_config =
+    "no_local_standard_full_vs2_cl64_db0_nca0_ncb0_t2x2_wg8x8";
+const std::string intel_gpu_config =
+    "local_standard_full_vs4_cl64_db1_nca0_ncb0_t4x4_wg8x8";
+
+const auto combi = ::testing::Combine(
+    ::testing::Values(std::string{"unknown"}, cpu_config, intel_gpu_config),
+    ::testing::Values(11, 64, 257),  // size
+    ::testing::Values('n', 't'),     // transa
+    ::testing::Values('n', 't')      // transb
+);
+
+BLAS_REGISTER_TEST(GemmDispatchTable, combination_t, combi);
+
+template <typename scalar_t>
+using online_combination_t = std::tuple<int, char, char>;
+
+template <typename scalar_t>
+void run_online_test(const online_combination_t<scalar_t> combi) {
+  int size;
+  char transa;
+  char transb;
+  std::tie(size, transa, transb) = combi;
+
+  blas::GemmDispatchTable::get_default().clear();
+  auto& tuner = blas::GemmOnlineTuner::get_default();
+  tuner.set_enabled(true);
+  // Each test times a new shape, which does not need to wait for the last one
+  tuner.set_min_interval(blas::GemmOnlineTuner::interval_t(0));
+  const gemm_arguments_t<scalar_t> arguments{
+      0, 1, size, size, size, transa, transb, scalar_t{1.5}, scalar_t{0.5}, 1,
+      1, 1, gemm_batch_type_t::strided};
+
+  // The first call queues the timing, the second one uses its result
+  verify_gemm<scalar_t>(arguments);
+  tuner.wait();
+  verify_gemm<scalar_t>(arguments);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  const auto key = blas::GemmOnlineTuner::get_key(
+      blas::codeplay_policy::get_device_type_name(
+          ex.get_policy_handler().get_device_type()),
+      transa == 't', transb == 't', size, size, size, 1, sizeof(scalar_t));
+  bool must_tune = true;
+  ASSERT_FALSE(tuner.find(key, must_tune).empty());
+  ASSERT_FALSE(must_tune);
+
+  tuner.set_enabled(false);
+  tuner.set_min_interval(blas::GemmOnlineTuner::default_min_interval);
+  tuner.clear();
+}
+
+const auto online_combi =
+    ::testing::Combine(::testing::Values(11, 257),   // size
+                       ::testing::Values('n', 't'),  // transa
+                       ::testing::Values('n', 't')   // transb
+    );
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(GemmOnlineTuner, GemmOnlineTuner,
+                               run_online_test, online_combination_t,
+                               online_combi);
+
+// A default table which cannot be read leaves the table empty instead of
+// failing the GEMM routines, an explicit load still throws. The test loads
+// its own table, so that it does not depend on when the default table of the
+// library is loaded.
+TEST(GemmDispatchTable, unreadable_file) {
+  const std::string path = "/nonexistent/gemm_dispatch_table.txt";
+  const char* previous_path = getenv(blas::GemmDispatchTable::env_var);
+  const std::string previous =
+      previous_path == nullptr ? std::string{} : previous_path;
+  setenv(blas::GemmDispatchTable::env_var, path.c_str(), 1);
+  blas::GemmDispatchTable dispatch_table;
+  dispatch_table.add_rule({"", "n", "n", -1, -1, -1, -1, "config"});
+  dispatch_table.load_default();
+  if (previous_path == nullptr) {
+    unsetenv(blas::GemmDispatchTable::env_var);
+  } else {
+    setenv(blas::GemmDispatchTable::env_var, previous.c_str(), 1);
+  }
+  ASSERT_TRUE(dispatch_table.empty());
+  ASSERT_THROW(dispatch_table.load_file(path), std::runtime_error);
+  ASSERT_TRUE(dispatch_table.empty());
+}
@@ -0,0 +1,152 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_ex_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<int, int, int, char, char, T, T, blas::gemm_bias_t,
+               blas::gemm_activation_t, int>;
+
+template <typename scalar_t>
+scalar_t apply_activation(scalar_t value, blas::gemm_activation_t activation) {
+  if (activation == blas::gemm_activation_t::relu) {
+    return std::max(value, scalar_t(0));
+  } else if (activation == blas::gemm_activation_t::gelu) {
+    return scalar_t(0.5) * value *
+           (scalar_t(1) +
+            std::tanh(scalar_t(0.7978845608028654) *
+                      (value + scalar_t(0.044715) * value * value * value)));
+  }
+  return value;
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  blas::gemm_bias_t bias_type;
+  blas::gemm_activation_t activation;
+  int ld_mul;
+  std::tie(m, n, k, transa, transb, alpha, beta, bias_type, activation,
+           ld_mul) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const int lda = std::max(1, ((transa != 'n') ? k : m) * ld_mul);
+  const int ldb = std::max(1, ((transb != 'n') ? n : k) * ld_mul);
+  const int ldc = m * ld_mul;
+
+  const int size_a = std::max(1, lda * ((transa != 'n') ? m : k));
+  const int size_b = std::max(1, ldb * ((transb != 'n') ? k : n));
+  const int size_c = ldc * n;
+  const int size_bias = std::max(m, n);
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> bias_v(size_bias);
+  std::vector<scalar_t> c_m_gpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(bias_v);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu = c_m_gpu;
+
+  // Use system blas to create a reference output, then apply the epilogue
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      scalar_t value = c_m_cpu[i + j * ldc];
+      if (bias_type == blas::gemm_bias_t::row) {
+        value += bias_v[i];
+      } else if (bias_type == blas::gemm_bias_t::column) {
+        value += bias_v[j];
+      }
+      c_m_cpu[i + j * ldc] = apply_activation(value, activation);
+    }
+  }
+
+  // SYCL BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, size_c);
+  auto bias_gpu = blas::make_sycl_iterator_buffer<scalar_t>(bias_v, size_bias);
+
+  _gemm_ex(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu, ldb,
+           beta, m_c_gpu, ldc, bias_type, bias_gpu, activation);
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    size_c);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+// Sizes multiple of the work group blocks and sizes which are not, so that
+// both the vectorized and the bounds checked stores apply the epilogue
+const auto combi = ::testing::Combine(
+    ::testing::Values(33, 64),                        // m
+    ::testing::Values(17, 64),                        // n
+    ::testing::Values(65),                            // k
+    ::testing::Values('n', 't'),                      // transa
+    ::testing::Values('n', 't'),                      // transb
+    ::testing::Values(1.5),                           // alpha
+    ::testing::Values(0.0, 1.5),                      // beta
+    ::testing::Values(blas::gemm_bias_t::none,        // bias_type
+                      blas::gemm_bias_t::row,
+                      blas::gemm_bias_t::column),
+    ::testing::Values(blas::gemm_activation_t::none,  // activation
+                      blas::gemm_activation_t::relu,
+                      blas::gemm_activation_t::gelu),
+    ::testing::Values(1, 2)                           // ld_mul
+);
+
+BLAS_REGISTER_TEST(GemmEx, combination_t, combi);
+
+// When alpha or K is zero, only beta and the epilogue are applied to C
+const auto degenerate_combi = ::testing::Combine(
+    ::testing::Values(33),                            // m
+    ::testing::Values(17),                            // n
+    ::testing::Values(0, 65),                         // k
+    ::testing::Values('n'),                           // transa
+    ::testing::Values('n'),                           // transb
+    ::testing::Values(0.0, 1.5),                      // alpha
+    ::testing::Values(0.0, 1.5),                      // beta
+    ::testing::Values(blas::gemm_bias_t::row,         // bias_type
+                      blas::gemm_bias_t::column),
+    ::testing::Values(blas::gemm_activation_t::relu,  // activation
+                      blas::gemm_activation_t::gelu),
+    ::testing::Values(1)                              // ld_mul
+);
+
+BLAS_REGISTER_TEST(GemmExDegenerate, combination_t, degenerate_combi);
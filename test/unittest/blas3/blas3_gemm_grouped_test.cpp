@@ -0,0 +1,122 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_grouped_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, int, char, char, T, T>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int group_count;
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(group_count, m, n, k, transa, transb, alpha, beta) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  // Every problem has its own sizes, and its matrices are packed one after
+  // the other in a, b and c with a gap of a few elements between them
+  std::vector<int> ms(group_count);
+  std::vector<int> ns(group_count);
+  std::vector<int> ks(group_count);
+  std::vector<int> ldas(group_count);
+  std::vector<int> ldbs(group_count);
+  std::vector<int> ldcs(group_count);
+  std::vector<int> offsets_a(group_count);
+  std::vector<int> offsets_b(group_count);
+  std::vector<int> offsets_c(group_count);
+  int size_a = 0;
+  int size_b = 0;
+  int size_c = 0;
+  for (int p = 0; p < group_count; ++p) {
+    ms[p] = m + 13 * p;
+    ns[p] = n + 7 * (group_count - p);
+    ks[p] = k + 5 * (p % 3);
+    ldas[p] = std::max(1, (transa != 'n') ? ks[p] : ms[p]) + p % 2;
+    ldbs[p] = std::max(1, (transb != 'n') ? ns[p] : ks[p]) + 1;
+    ldcs[p] = ms[p] + 2;
+    offsets_a[p] = size_a + 3;
+    offsets_b[p] = size_b + 1;
+    offsets_c[p] = size_c + 5;
+    size_a = offsets_a[p] + ldas[p] * ((transa != 'n') ? ms[p] : ks[p]);
+    size_b = offsets_b[p] + ldbs[p] * ((transb != 'n') ? ks[p] : ns[p]);
+    size_c = offsets_c[p] + ldcs[p] * ns[p];
+  }
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m_gpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu = c_m_gpu;
+
+  // Use system blas to create a reference output
+  for (int p = 0; p < group_count; ++p) {
+    reference_blas::gemm(ta_str, tb_str, ms[p], ns[p], ks[p], alpha,
+                         a_m.data() + offsets_a[p], ldas[p],
+                         b_m.data() + offsets_b[p], ldbs[p], beta,
+                         c_m_cpu.data() + offsets_c[p], ldcs[p]);
+  }
+
+  // SYCL BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, size_c);
+
+  _gemm_grouped(ex, transa, transb, ms, ns, ks, alpha, m_a_gpu, ldas,
+                offsets_a, m_b_gpu, ldbs, offsets_b, beta, m_c_gpu, ldcs,
+                offsets_c);
+  // The host copy of the problem descriptor is kept alive by the policy
+  // handler until the copy to the device has read it
+  ASSERT_GE(ex.get_policy_handler().get_num_kept_alive(), size_t{1});
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    size_c);
+  ex.get_policy_handler().wait(event);
+  ASSERT_EQ(ex.get_policy_handler().get_num_kept_alive(), size_t{0});
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+const auto combi = ::testing::Combine(::testing::Values(1, 5),      // groups
+                                      ::testing::Values(1, 63),     // m
+                                      ::testing::Values(2, 33),     // n
+                                      ::testing::Values(0, 31),     // k
+                                      ::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't'),  // transb
+                                      ::testing::Values(0.0, 1.5),  // alpha
+                                      ::testing::Values(0.0, 2.5)   // beta
+);
+
+BLAS_REGISTER_TEST(GemmGrouped, combination_t, combi);
@@ -0,0 +1,137 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_mixed_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#ifdef BLAS_DATA_TYPE_HALF
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, char, char, T, T, bool, int>;
+
+// Rounds the values to what the half storage can hold, so that the reference
+// multiplies the same operands as the device
+template <typename scalar_t>
+std::vector<cl::sycl::half> to_half(std::vector<scalar_t>& x) {
+  std::vector<cl::sycl::half> x_half(x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    x_half[i] = cl::sycl::half(x[i]);
+    x[i] = static_cast<scalar_t>(x_half[i]);
+  }
+  return x_half;
+}
+
+template <typename scalar_t, typename output_t>
+void run_mixed_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  bool half_output;
+  int ld_mul;
+  std::tie(m, n, k, transa, transb, alpha, beta, half_output, ld_mul) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const int lda = ((transa != 'n') ? k : m) * ld_mul;
+  const int ldb = ((transb != 'n') ? n : k) * ld_mul;
+  const int ldc = m * ld_mul;
+
+  const int size_a = lda * ((transa != 'n') ? m : k);
+  const int size_b = ldb * ((transb != 'n') ? k : n);
+  const int size_c = ldc * n;
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m_cpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_cpu);
+  std::vector<cl::sycl::half> a_half = to_half(a_m);
+  std::vector<cl::sycl::half> b_half = to_half(b_m);
+  std::vector<output_t> c_m_gpu(size_c);
+  for (int i = 0; i < size_c; ++i) {
+    c_m_gpu[i] = output_t(c_m_cpu[i]);
+    c_m_cpu[i] = static_cast<scalar_t>(c_m_gpu[i]);
+  }
+
+  // Use system blas to create a reference output
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  // SYCL BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu =
+      blas::make_sycl_iterator_buffer<cl::sycl::half>(a_half, size_a);
+  auto m_b_gpu =
+      blas::make_sycl_iterator_buffer<cl::sycl::half>(b_half, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<output_t>(c_m_gpu, size_c);
+
+  _gemm_mixed(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu, ldb,
+              beta, m_c_gpu, ldc);
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    size_c);
+  ex.get_policy_handler().wait(event);
+
+  // A half output is compared with the reference rounded the same way
+  std::vector<scalar_t> c_m_result(size_c);
+  for (int i = 0; i < size_c; ++i) {
+    c_m_result[i] = static_cast<scalar_t>(c_m_gpu[i]);
+    c_m_cpu[i] = static_cast<scalar_t>(output_t(c_m_cpu[i]));
+  }
+  ASSERT_TRUE(utils::compare_vectors(c_m_result, c_m_cpu));
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  if (std::get<7>(combi)) {
+    run_mixed_test<scalar_t, cl::sycl::half>(combi);
+  } else {
+    run_mixed_test<scalar_t, scalar_t>(combi);
+  }
+}
+
+const auto combi = ::testing::Combine(
+    ::testing::Values(33, 64),       // m
+    ::testing::Values(17, 64),       // n
+    ::testing::Values(31, 64),       // k
+    ::testing::Values('n', 't'),     // transa
+    ::testing::Values('n', 't'),     // transb
+    ::testing::Values(0.0, 1.5),     // alpha
+    ::testing::Values(0.0, 1.5),     // beta
+    ::testing::Values(false, true),  // half_output
+    ::testing::Values(1, 2)          // ld_mul
+);
+
+// The operands are stored in half and the products accumulated in float, so
+// the test is only registered for float
+BLAS_REGISTER_TEST_FLOAT(GemmMixed, GemmMixed, run_test, combination_t, combi);
+
+#endif  // BLAS_DATA_TYPE_HALF
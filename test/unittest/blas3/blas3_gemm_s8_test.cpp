@@ -0,0 +1,160 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_s8_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, char, char,
+                                 blas::gemm_quantization_t, bool, int>;
+
+template <typename scalar_t, typename output_t>
+void run_s8_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  blas::gemm_quantization_t quantization_type;
+  bool int8_output;
+  int ld_mul;
+  std::tie(m, n, k, transa, transb, quantization_type, int8_output, ld_mul) =
+      combi;
+
+  const int lda = ((transa != 'n') ? k : m) * ld_mul;
+  const int ldb = ((transb != 'n') ? n : k) * ld_mul;
+  const int ldc = m * ld_mul;
+
+  const int size_a = lda * ((transa != 'n') ? m : k);
+  const int size_b = ldb * ((transb != 'n') ? k : n);
+  const int size_c = ldc * n;
+  const int channels = std::max(m, n);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> int8_dis(-128, 127);
+  std::vector<int8_t> a_m(size_a);
+  std::vector<int8_t> b_m(size_b);
+  std::vector<int32_t> zero_point(channels);
+  for (auto& e : a_m) {
+    e = static_cast<int8_t>(int8_dis(gen));
+  }
+  for (auto& e : b_m) {
+    e = static_cast<int8_t>(int8_dis(gen));
+  }
+  for (auto& e : zero_point) {
+    e = int8_dis(gen) / 4;
+  }
+  // The scales of an int8 output bring the int32 accumulators back to about
+  // the range of int8, so that few of them saturate
+  std::vector<scalar_t> scale(channels);
+  fill_random(scale);
+  if (int8_output) {
+    for (auto& e : scale) {
+      e = (e + scalar_t{3}) * scalar_t{1e-4} / k;
+    }
+  }
+  std::vector<output_t> c_m_gpu(size_c, output_t{0});
+
+  // Accumulate in int32 and requantize on the host to create a reference
+  // output
+  std::vector<scalar_t> c_m_cpu(size_c, scalar_t{0});
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      int32_t acc = 0;
+      for (int l = 0; l < k; ++l) {
+        const int idx_a = (transa != 'n') ? l + i * lda : i + l * lda;
+        const int idx_b = (transb != 'n') ? j + l * ldb : l + j * ldb;
+        acc += int32_t(a_m[idx_a]) * int32_t(b_m[idx_b]);
+      }
+      const int channel =
+          (quantization_type == blas::gemm_quantization_t::per_row)
+              ? i
+              : (quantization_type == blas::gemm_quantization_t::per_column)
+                    ? j
+                    : 0;
+      scalar_t value = static_cast<scalar_t>(acc) * scale[channel] +
+                       static_cast<scalar_t>(zero_point[channel]);
+      if (int8_output) {
+        value = std::min(std::max(std::nearbyint(value), scalar_t{-128}),
+                         scalar_t{127});
+      }
+      c_m_cpu[i + j * ldc] = value;
+    }
+  }
+
+  // SYCL BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<int8_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<int8_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<output_t>(c_m_gpu, size_c);
+  auto scale_gpu = blas::make_sycl_iterator_buffer<scalar_t>(scale, channels);
+  auto zero_point_gpu =
+      blas::make_sycl_iterator_buffer<int32_t>(zero_point, channels);
+
+  _gemm_s8(ex, transa, transb, m, n, k, m_a_gpu, lda, m_b_gpu, ldb, m_c_gpu,
+           ldc, quantization_type, scale_gpu, zero_point_gpu);
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    size_c);
+  ex.get_policy_handler().wait(event);
+
+  std::vector<scalar_t> c_m_result(c_m_gpu.begin(), c_m_gpu.end());
+  if (int8_output) {
+    // The device may fuse the multiply-add of the requantization, which can
+    // round a value half way between two integers the other way
+    for (int i = 0; i < size_c; ++i) {
+      ASSERT_LE(std::abs(c_m_result[i] - c_m_cpu[i]), scalar_t{1});
+    }
+  } else {
+    ASSERT_TRUE(utils::compare_vectors(c_m_result, c_m_cpu));
+  }
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  if (std::get<6>(combi)) {
+    run_s8_test<scalar_t, int8_t>(combi);
+  } else {
+    run_s8_test<scalar_t, scalar_t>(combi);
+  }
+}
+
+const auto combi = ::testing::Combine(
+    ::testing::Values(33, 64),                                 // m
+    ::testing::Values(17, 64),                                 // n
+    ::testing::Values(31, 64),                                 // k
+    ::testing::Values('n', 't'),                               // transa
+    ::testing::Values('n', 't'),                               // transb
+    ::testing::Values(blas::gemm_quantization_t::per_tensor,  // quantization
+                      blas::gemm_quantization_t::per_row,
+                      blas::gemm_quantization_t::per_column),
+    ::testing::Values(true, false),                            // int8_output
+    ::testing::Values(1, 2)                                    // ld_mul
+);
+
+// The scales are float, the operands and zero points are integers whatever
+// the data types of the build
+BLAS_REGISTER_TEST_FLOAT(GemmS8, GemmS8, run_test, combination_t, combi);
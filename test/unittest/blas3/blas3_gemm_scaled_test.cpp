@@ -0,0 +1,138 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_scaled_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<int, int, int, char, char, T, T, blas::gemm_scale_t,
+               blas::gemm_scale_t, int>;
+
+// Scales the rows or the columns of op(X), a rows by cols matrix
+template <typename scalar_t>
+void scale_operand(std::vector<scalar_t>& x, char trans, int rows, int cols,
+                   int ld, blas::gemm_scale_t scale_type,
+                   const std::vector<scalar_t>& scale) {
+  if (scale_type == blas::gemm_scale_t::none) {
+    return;
+  }
+  for (int j = 0; j < cols; ++j) {
+    for (int i = 0; i < rows; ++i) {
+      const int idx = (trans != 'n') ? j + i * ld : i + j * ld;
+      x[idx] *= (scale_type == blas::gemm_scale_t::row) ? scale[i] : scale[j];
+    }
+  }
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  blas::gemm_scale_t scale_a_type;
+  blas::gemm_scale_t scale_b_type;
+  int ld_mul;
+  std::tie(m, n, k, transa, transb, alpha, beta, scale_a_type, scale_b_type,
+           ld_mul) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const int lda = ((transa != 'n') ? k : m) * ld_mul;
+  const int ldb = ((transb != 'n') ? n : k) * ld_mul;
+  const int ldc = m * ld_mul;
+
+  const int size_a = lda * ((transa != 'n') ? m : k);
+  const int size_b = ldb * ((transb != 'n') ? k : n);
+  const int size_c = ldc * n;
+  const int size_scale = std::max(std::max(m, n), k);
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> scale_a(size_scale);
+  std::vector<scalar_t> scale_b(size_scale);
+  std::vector<scalar_t> c_m_gpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(scale_a);
+  fill_random(scale_b);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu = c_m_gpu;
+
+  // Use system blas on scaled copies of the operands to create a reference
+  // output
+  std::vector<scalar_t> a_scaled = a_m;
+  std::vector<scalar_t> b_scaled = b_m;
+  scale_operand(a_scaled, transa, m, k, lda, scale_a_type, scale_a);
+  scale_operand(b_scaled, transb, k, n, ldb, scale_b_type, scale_b);
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_scaled.data(), lda,
+                       b_scaled.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  // SYCL BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, size_c);
+  auto scale_a_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(scale_a, size_scale);
+  auto scale_b_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(scale_b, size_scale);
+
+  _gemm_scaled(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda, scale_a_type,
+               scale_a_gpu, m_b_gpu, ldb, scale_b_type, scale_b_gpu, beta,
+               m_c_gpu, ldc);
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    size_c);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+// Sizes which are not multiples of the blocks make the kernels load the edges
+// of A and B element by element, the others load whole packets
+const auto combi = ::testing::Combine(
+    ::testing::Values(33, 64),                   // m
+    ::testing::Values(17, 64),                   // n
+    ::testing::Values(31, 64),                   // k
+    ::testing::Values('n', 't'),                 // transa
+    ::testing::Values('n', 't'),                 // transb
+    ::testing::Values(1.5),                      // alpha
+    ::testing::Values(0.0, 1.5),                 // beta
+    ::testing::Values(blas::gemm_scale_t::none,  // scale_a_type
+                      blas::gemm_scale_t::row,
+                      blas::gemm_scale_t::column),
+    ::testing::Values(blas::gemm_scale_t::none,  // scale_b_type
+                      blas::gemm_scale_t::row,
+                      blas::gemm_scale_t::column),
+    ::testing::Values(1, 2)                      // ld_mul
+);
+
+BLAS_REGISTER_TEST(GemmScaled, combination_t, combi);
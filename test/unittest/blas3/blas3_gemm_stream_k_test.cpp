@@ -0,0 +1,94 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_stream_k_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, int, char, char, T, T, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  int ld_mul;
+  std::tie(m, n, k, transa, transb, alpha, beta, ld_mul) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const int lda = ((transa != 'n') ? k : m) * ld_mul;
+  const int ldb = ((transb != 'n') ? n : k) * ld_mul;
+  const int ldc = m * ld_mul;
+
+  const int size_a = lda * ((transa != 'n') ? m : k);
+  const int size_b = ldb * ((transb != 'n') ? k : n);
+  const int size_c = ldc * n;
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m_gpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu = c_m_gpu;
+
+  // Use system blas to create a reference output
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), lda,
+                       b_m.data(), ldb, beta, c_m_cpu.data(), ldc);
+
+  // SYCL BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, size_c);
+
+  _gemm_stream_k(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu,
+                 ldb, beta, m_c_gpu, ldc);
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    size_c);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+// The larger sizes have more blocks of C than work groups on most devices, so
+// that some blocks are shared between work groups
+const auto combi = ::testing::Combine(::testing::Values(63, 513),     // m
+                                      ::testing::Values(33, 257),     // n
+                                      ::testing::Values(1, 65, 511),  // k
+                                      ::testing::Values('n', 't'),    // transa
+                                      ::testing::Values('n', 't'),    // transb
+                                      ::testing::Values(1.5),         // alpha
+                                      ::testing::Values(0.0, 1.5),    // beta
+                                      ::testing::Values(1, 2)         // ld_mul
+);
+
+BLAS_REGISTER_TEST(GemmStreamK, combination_t, combi);
@@ -0,0 +1,128 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_strided_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+#include "sycl_blas.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<int, int, int, int, char, char, T, T, int, int, int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int batch;
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  int stride_a_mul;
+  int stride_b_mul;
+  int stride_c_mul;
+  bool on_host;
+  std::tie(batch, m, n, k, transa, transb, alpha, beta, stride_a_mul,
+           stride_b_mul, stride_c_mul, on_host) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const int lda = (transa != 'n') ? k : m;
+  const int ldb = (transb != 'n') ? n : k;
+  const int ldc = m;
+
+  // A stride multiplier of 0 shares one matrix between all the batches, a
+  // multiplier of 2 leaves a gap of one matrix between consecutive ones
+  const int stride_a = m * k * stride_a_mul;
+  const int stride_b = k * n * stride_b_mul;
+  const int stride_c = m * n * stride_c_mul;
+
+  const int size_a = stride_a * (batch - 1) + m * k;
+  const int size_b = stride_b * (batch - 1) + k * n;
+  const int size_c = stride_c * (batch - 1) + m * n;
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m_gpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu = c_m_gpu;
+
+  // Use system blas to create a reference output
+  for (int i = 0; i < batch; ++i) {
+    reference_blas::gemm(ta_str, tb_str, m, n, k, alpha,
+                         a_m.data() + i * stride_a, lda,
+                         b_m.data() + i * stride_b, ldb, beta,
+                         c_m_cpu.data() + i * stride_c, ldc);
+  }
+
+  if (on_host) {
+    // The host executor works on the memory of the vectors directly
+    blas::Executor<blas::PolicyHandler<blas::host_policy>> host_ex{
+        blas::HostQueue()};
+    auto m_a_host = blas::make_host_iterator_buffer(a_m.data(), size_a);
+    auto m_b_host = blas::make_host_iterator_buffer(b_m.data(), size_b);
+    auto m_c_host = blas::make_host_iterator_buffer(c_m_gpu.data(), size_c);
+    _gemm_strided_batched(host_ex, transa, transb, m, n, k, alpha, m_a_host,
+                          lda, stride_a, m_b_host, ldb, stride_b, beta,
+                          m_c_host, ldc, stride_c, batch);
+    ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+    return;
+  }
+
+  // SYCL BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, size_c);
+
+  _gemm_strided_batched(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda,
+                        stride_a, m_b_gpu, ldb, stride_b, beta, m_c_gpu, ldc,
+                        stride_c, batch);
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    size_c);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+const auto combi = ::testing::Combine(::testing::Values(5),         // batch
+                                      ::testing::Values(63, 128),   // m
+                                      ::testing::Values(9, 128),    // n
+                                      ::testing::Values(63),        // k
+                                      ::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't'),  // transb
+                                      ::testing::Values(1.5),       // alpha
+                                      ::testing::Values(0.0, 2.5),  // beta
+                                      ::testing::Values(0, 1, 2),   // stride_a
+                                      ::testing::Values(0, 1, 2),   // stride_b
+                                      ::testing::Values(1, 2),      // stride_c
+                                      ::testing::Values(false, true)  // host
+);
+
+BLAS_REGISTER_TEST(GemmStridedBatched, combination_t, combi);
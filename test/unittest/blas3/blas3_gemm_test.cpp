@@ -111,6 +111,43 @@ const auto OffsetNonZero = ::testing::Combine(
 );
 GENERATE_GEMM_TEST(Gemm, OffsetNonZero);
 
+// Few blocks of C and a deep K, which are split along K on most devices
+const auto DeepK = ::testing::Combine(
+    ::testing::Values(0),                          // offset
+    ::testing::Values(1),                          // batch
+    ::testing::Values(33, 64),                     // m
+    ::testing::Values(17, 64),                     // n
+    ::testing::Values(1027, 2048),                 // k
+    ::testing::Values('n', 't'),                   // transa
+    ::testing::Values('n', 't'),                   // transb
+    ::testing::Values(1.5),                        // alpha
+    ::testing::Values(0.0, 1.5),                   // beta
+    ::testing::Values(1, 2),                       // lda_mul
+    ::testing::Values(1),                          // ldb_mul
+    ::testing::Values(1, 2),                       // ldc_mul
+    ::testing::Values(gemm_batch_type_t::strided)  // batch_type
+);
+GENERATE_GEMM_TEST(Gemm, DeepK);
+
+// A few columns of C and a deep K, which are not computed as the product of A
+// with a few vectors but split along K or left to the GEMM kernels
+const auto SmallNDeepK = ::testing::Combine(
+    ::testing::Values(0),                          // offset
+    ::testing::Values(1),                          // batch
+    ::testing::Values(33, 64),                     // m
+    ::testing::Values(1, 8, 16),                   // n
+    ::testing::Values(1027, 4096),                 // k
+    ::testing::Values('n', 't'),                   // transa
+    ::testing::Values('n', 't'),                   // transb
+    ::testing::Values(1.5),                        // alpha
+    ::testing::Values(0.0, 1.5),                   // beta
+    ::testing::Values(1),                          // lda_mul
+    ::testing::Values(1, 2),                       // ldb_mul
+    ::testing::Values(1),                          // ldc_mul
+    ::testing::Values(gemm_batch_type_t::strided)  // batch_type
+);
+GENERATE_GEMM_TEST(Gemm, SmallNDeepK);
+
 const auto LargeBetaNonZeroLDMatch = ::testing::Combine(
     ::testing::Values(0),                          // offset
     ::testing::Values(1),                          // batch
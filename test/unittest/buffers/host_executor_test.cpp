@@ -0,0 +1,143 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename host_executor_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+#include "sycl_blas.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using host_executor_t = blas::Executor<blas::PolicyHandler<blas::host_policy>>;
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int>;
+
+// axpy and dot with strided vectors, the sizes spanning several chunks
+template <typename scalar_t>
+void run_blas1_test(const combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  int num_threads;
+  std::tie(size, incX, num_threads) = combi;
+
+  const scalar_t alpha = 1.5;
+  std::vector<scalar_t> x_v(size * incX);
+  std::vector<scalar_t> y_v(size);
+  fill_random(x_v);
+  fill_random(y_v);
+  std::vector<scalar_t> y_cpu_v(y_v);
+  std::vector<scalar_t> out_s(1, 10.0);
+
+  reference_blas::axpy(size, alpha, x_v.data(), incX, y_cpu_v.data(), 1);
+  const scalar_t out_cpu_s =
+      reference_blas::dot(size, x_v.data(), incX, y_cpu_v.data(), 1);
+
+  host_executor_t ex{blas::HostQueue(num_threads)};
+  auto host_x_v = blas::make_host_iterator_buffer(x_v.data(), size * incX);
+  auto host_y_v = blas::make_host_iterator_buffer(y_v.data(), size);
+  auto host_out_s = blas::make_host_iterator_buffer(out_s.data(), 1);
+
+  _axpy(ex, size, alpha, host_x_v, incX, host_y_v, 1);
+  _dot(ex, size, host_x_v, incX, host_y_v, 1, host_out_s);
+  ex.get_policy_handler().wait();
+
+  ASSERT_TRUE(utils::compare_vectors(y_v, y_cpu_v));
+  ASSERT_TRUE(utils::almost_equal(out_s[0], out_cpu_s));
+}
+
+const auto blas1_combi =
+    ::testing::Combine(::testing::Values(11, 1002, 1002400),  // size
+                       ::testing::Values(1, 3),               // incX
+                       ::testing::Values(1, 4)                // threads
+    );
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(HostBlas1, HostBlas1, run_blas1_test,
+                               combination_t, blas1_combi);
+
+// gemm, the matrices being square and the transpositions given by transa
+template <typename scalar_t>
+void run_gemm_test(const combination_t<scalar_t> combi) {
+  int size;
+  int transa;
+  int num_threads;
+  std::tie(size, transa, num_threads) = combi;
+
+  const char ta_str[2] = {transa ? 't' : 'n', '\0'};
+  const scalar_t alpha = 1.5;
+  const scalar_t beta = 0.5;
+  std::vector<scalar_t> a_m(size * size);
+  std::vector<scalar_t> b_m(size * size);
+  std::vector<scalar_t> c_m(size * size);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+  std::vector<scalar_t> c_cpu_m(c_m);
+
+  reference_blas::gemm(ta_str, "n", size, size, size, alpha, a_m.data(), size,
+                       b_m.data(), size, beta, c_cpu_m.data(), size);
+
+  host_executor_t ex{blas::HostQueue(num_threads)};
+  auto host_a_m = blas::make_host_iterator_buffer(a_m.data(), size * size);
+  auto host_b_m = blas::make_host_iterator_buffer(b_m.data(), size * size);
+  auto host_c_m = blas::make_host_iterator_buffer(c_m.data(), size * size);
+
+  _gemm(ex, ta_str[0], 'n', size, size, size, alpha, host_a_m, size, host_b_m,
+        size, beta, host_c_m, size);
+  ex.get_policy_handler().wait();
+
+  ASSERT_TRUE(utils::compare_vectors(c_m, c_cpu_m));
+}
+
+const auto gemm_combi =
+    ::testing::Combine(::testing::Values(7, 64, 257),  // size
+                       ::testing::Values(0, 1),        // transa
+                       ::testing::Values(1, 4)         // threads
+    );
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(HostGemm, HostGemm, run_gemm_test,
+                               combination_t, gemm_combi);
+
+// An exception thrown by a chunk evaluated on a worker thread reaches the
+// caller, and the queue remains usable
+TEST(HostQueue, exception) {
+  blas::HostQueue q(4);
+  const size_t num_chunks = 64;
+  const auto caller = std::this_thread::get_id();
+  std::vector<int> done(num_chunks, 0);
+  // The last chunk throws too, should the calling thread take all of them
+  auto failing_fn = [&](size_t c) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    if (std::this_thread::get_id() != caller || c == num_chunks - 1) {
+      throw std::runtime_error("chunk failed");
+    }
+    done[c] = 1;
+  };
+  ASSERT_THROW(q.parallel_for(num_chunks, failing_fn), std::runtime_error);
+  q.parallel_for(num_chunks, [&](size_t c) { done[c] = 2; });
+  for (size_t c = 0; c < num_chunks; ++c) {
+    ASSERT_EQ(done[c], 2);
+  }
+}
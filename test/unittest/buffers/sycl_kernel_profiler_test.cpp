@@ -0,0 +1,96 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_kernel_profiler_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+#include <sstream>
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  int num_calls;
+  std::tie(size, num_calls) = combi;
+
+  std::vector<scalar_t> x_v(size);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size);
+  fill_random(y_v);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto &profiler = ex.get_profiler();
+  profiler.clear();
+  profiler.set_enabled(true);
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(y_v, size);
+
+  for (int i = 0; i < num_calls; ++i) {
+    auto event = _axpy(ex, size, scalar_t{2}, gpu_x_v, 1, gpu_y_v, 1);
+    ex.get_policy_handler().wait(event);
+  }
+  // Both routines run an Assign tree, their kernels are told apart by the
+  // name of the routine
+  {
+    auto event = _scal(ex, size, scalar_t{2}, gpu_x_v, 1);
+    ex.get_policy_handler().wait(event);
+  }
+  profiler.set_enabled(false);
+
+  // Kernels submitted while profiling is disabled are not recorded
+  auto event = _axpy(ex, size, scalar_t{2}, gpu_x_v, 1, gpu_y_v, 1);
+  ex.get_policy_handler().wait(event);
+
+  auto records = profiler.get_records();
+  ASSERT_EQ(records.size(), size_t(num_calls + 1));
+  for (const auto &record : records) {
+    ASSERT_GE(record.global_size, size_t(size));
+    ASSERT_LE(record.start_ns, record.end_ns);
+  }
+  ASSERT_EQ(records.front().routine, "axpy");
+  ASSERT_EQ(records.back().routine, "scal");
+
+  auto stats = profiler.get_routine_stats();
+  ASSERT_EQ(stats.size(), size_t{2});
+  ASSERT_EQ(stats["axpy"].num_kernels, size_t(num_calls));
+  ASSERT_EQ(stats["scal"].num_kernels, size_t{1});
+
+  std::ostringstream csv;
+  profiler.write_csv(csv);
+  std::string header;
+  std::istringstream lines(csv.str());
+  std::getline(lines, header);
+  ASSERT_EQ(header.find("routine,kernel,"), size_t{0});
+
+  profiler.clear();
+  ASSERT_TRUE(profiler.get_records().empty());
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 65537),
+                                      ::testing::Values(1, 4));
+
+BLAS_REGISTER_TEST(KernelProfiler, combination_t, combi);
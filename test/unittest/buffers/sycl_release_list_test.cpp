@@ -0,0 +1,70 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_release_list_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <memory>
+
+template <typename scalar_t>
+using combination_t = std::tuple<int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  std::tie(size) = combi;
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+
+  // The host data is only referenced by the policy handler once handed over
+  auto x_ptr = std::make_shared<std::vector<scalar_t>>(size);
+  fill_random(*x_ptr);
+  const std::vector<scalar_t> x_v(*x_ptr);
+  std::weak_ptr<std::vector<scalar_t>> x_weak = x_ptr;
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(size);
+  auto copy_event =
+      policy_handler.copy_to_device(x_ptr->data(), gpu_x_v, size);
+  policy_handler.keep_alive(x_ptr, copy_event);
+  x_ptr.reset();
+
+  // Alive until the copy is known to have completed
+  ASSERT_EQ(policy_handler.get_num_kept_alive(), size_t{1});
+  ASSERT_FALSE(x_weak.expired());
+
+  policy_handler.wait(copy_event);
+  ASSERT_EQ(policy_handler.get_num_kept_alive(), size_t{0});
+  ASSERT_TRUE(x_weak.expired());
+
+  std::vector<scalar_t> y_v(size);
+  auto event = policy_handler.copy_to_host(gpu_x_v, y_v.data(), size);
+  policy_handler.wait(event);
+  ASSERT_TRUE(utils::compare_vectors(y_v, x_v));
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1002, 102400));
+
+BLAS_REGISTER_TEST(ReleaseList, combination_t, combi);
@@ -0,0 +1,86 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_scratch_pool_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  bool use_workspace;
+  std::tie(size, use_workspace) = combi;
+
+  std::vector<scalar_t> x_v(size);
+  fill_random(x_v);
+  std::vector<scalar_t> y_v(size);
+  fill_random(y_v);
+  std::vector<scalar_t> out_s(1, 10.0);
+
+  auto out_cpu_s = reference_blas::dot(size, x_v.data(), 1, y_v.data(), 1);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto policy_handler = ex.get_policy_handler();
+
+  cl::sycl::buffer<uint8_t, 1> workspace{cl::sycl::range<1>(1 << 20)};
+  if (use_workspace) {
+    policy_handler.set_workspace(workspace);
+  }
+
+  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, size);
+  auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(y_v, size);
+  auto gpu_out_s = blas::make_sycl_iterator_buffer<scalar_t>(int(1));
+
+  size_t allocation_count = 0;
+  for (int i = 0; i < 3; ++i) {
+    auto dot_event = _dot(ex, size, gpu_x_v, 1, gpu_y_v, 1, gpu_out_s);
+    policy_handler.wait(dot_event);
+    auto event = policy_handler.copy_to_host(gpu_out_s, out_s.data(), 1);
+    policy_handler.wait(event);
+
+    ASSERT_TRUE(utils::almost_equal(out_s[0], out_cpu_s));
+
+    // The temporaries of the first call are reused by the following ones
+    if (i == 0) {
+      allocation_count = policy_handler.get_scratch_allocation_count();
+    } else {
+      ASSERT_EQ(allocation_count,
+                policy_handler.get_scratch_allocation_count());
+    }
+  }
+
+  // The workspace is large enough to hold all the temporaries
+  if (use_workspace) {
+    ASSERT_EQ(allocation_count, size_t{0});
+    policy_handler.clear_workspace();
+  }
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1002, 102400),
+                                      ::testing::Values(false, true));
+
+BLAS_REGISTER_TEST(ScratchPool, combination_t, combi);
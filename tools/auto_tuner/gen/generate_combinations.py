@@ -96,6 +96,10 @@ class GemmParams(
     def to_xmacro(self):
         return "BENCH_PARAMS({})".format(self)
 
+    def is_s8(self):
+        """ Whether the configuration is tuned for the int8 GEMM. """
+        return False
+
 
 class LocalGemm(GemmParams):
     """ A parameter set for the non-local memory GEMM kernel.  """
@@ -173,6 +177,40 @@ class NonLocalGemmnInterleaved(GemmParams):
 
 
 
+class LocalGemmS8(LocalGemm):
+    """
+    A parameter set for the local memory GEMM kernel on int8 operands
+    accumulated in int32, whose results are requantized by the epilogue.
+    """
+    __slots__ = ()
+
+    def to_xmacro(self):
+        return "BENCH_PARAMS_S8({})".format(self)
+
+    def is_s8(self):
+        return True
+
+
+class NonLocalGemmS8(NonLocalGemmStrided):
+    """
+    A parameter set for the non-local memory GEMM kernel on int8 operands.
+
+    Only the full vectorization of this kernel supports other operand and
+    accumulator types, and the epilogue.
+    """
+    __slots__ = ()
+
+    def __new__(self, tile, vec_size):
+        return super(NonLocalGemmS8, self).__new__(self, tile, 'full',
+                                                   vec_size)
+
+    def to_xmacro(self):
+        return "BENCH_PARAMS_S8({})".format(self)
+
+    def is_s8(self):
+        return True
+
+
 class NaiveGemm(GemmParams):
     """
     A parameter set for the naive GEMM kernel.
@@ -266,6 +304,45 @@ def generate_no_local_gemm_interleaved_configs(item_sizes, group_sizes, batch_si
     return configs
 
 
+def generate_local_gemm_s8_configs(cache_sizes, item_sizes, group_sizes,
+                                   tile_sizes, double_buffers,
+                                   bank_conflicts_a, bank_conflicts_b,
+                                   vec_sizes):
+    """
+    Generate a list of possible configurations of the int8 GEMM using local
+    memory, see `generate_local_gemm_configs`.
+    """
+    configs = []
+    for cls, item, wg, tl, db, ncba, ncbb, vs in product(cache_sizes, item_sizes,
+                                                     group_sizes, tile_sizes,
+                                                     double_buffers,
+                                                     bank_conflicts_a,
+                                                     bank_conflicts_b,
+                                                     vec_sizes):
+        new_config = LocalGemmS8(cache_size=cls,
+                                 tile=_construct_tile(item, wg, tl),
+                                 double_buffer=db,
+                                 bank_conf_a=ncba,
+                                 bank_conf_b=ncbb,
+                                 vec_size=vs)
+        if new_config.is_valid():
+            configs.append(new_config)
+    return configs
+
+
+def generate_no_local_gemm_s8_configs(item_sizes, group_sizes, vec_sizes):
+    """
+    Generate a list of possible configurations of the int8 GEMM without local
+    memory, see `generate_no_local_gemm_strided_configs`.
+    """
+    configs = []
+    for item, wg, vs in product(item_sizes, group_sizes, vec_sizes):
+        new_config = NonLocalGemmS8(tile=_construct_tile(item, wg), vec_size=vs)
+        if new_config.is_valid():
+            configs.append(new_config)
+    return configs
+
+
 def get_gemm_configs_from_json(json_file):
     gemm_configs = []
     config_json = json.load(json_file)
@@ -291,6 +368,18 @@ def get_gemm_configs_from_json(json_file):
         gemm_configs += [
             NaiveGemm(cache_size=cls) for cls in r["cache_line_size"]
         ]
+
+    for r in config_json.get("local_s8", []):
+        gemm_configs += generate_local_gemm_s8_configs(
+            r["cache_line_size"], r["work_item_sizes"], r["work_group_sizes"],
+            r["block_level_tiles"], r["double_buffer"],
+            r["no_bank_conflict_a"], r["no_bank_conflict_b"],
+            r["vectorization_size"])
+
+    for r in config_json.get("non_local_s8", []):
+        gemm_configs += generate_no_local_gemm_s8_configs(
+            r["work_item_sizes"], r["work_group_sizes"],
+            r["vectorization_size"])
     return gemm_configs
 
 
@@ -311,6 +400,9 @@ def write_output_definition_file(config_list, config_source, output_file):
         "#ifndef BENCH_PARAMS",
         "#error XMacro file expects BENCH_PARAMS macro to be defined",
         "#endif",
+        "#ifndef BENCH_PARAMS_S8",
+        "#error XMacro file expects BENCH_PARAMS_S8 macro to be defined",
+        "#endif",
     ]
     output_strings += [conf.to_xmacro() for conf in config_list]
     output = "\n".join(output_strings)
@@ -344,7 +436,8 @@ def _get_filename(params):
         params.cache_size,
         params.vec_size,
     ] + params.tile.to_list()
-    return "tune_gemm_" + "_".join(map(str, int_list)) + ".cpp"
+    prefix = "tune_gemm_s8_" if params.is_s8() else "tune_gemm_"
+    return prefix + "_".join(map(str, int_list)) + ".cpp"
 
 
 def write_source_files(config_list, config_source, output_dir):
@@ -374,6 +467,17 @@ def write_source_files(config_list, config_source, output_dir):
   INSTANTIATE_TUNE(float, true, false, MEM, ALGO, BATCH, VEC ,__VA_ARGS__)  \
   INSTANTIATE_TUNE(float, false, true, MEM, ALGO, BATCH, VEC, __VA_ARGS__)  \
   INSTANTIATE_TUNE(float, true, true, MEM, ALGO, BATCH, VEC ,__VA_ARGS__)
+
+#define INSTANTIATE_TUNE_S8(TRA, TRB, MEM, ALGO, BATCH, VEC, ...)        \
+  template TestResultEntry                                               \
+  tune_s8<__VA_ARGS__, GemmConfig<TRA, TRB, MEM, ALGO, BATCH, VEC>>(      \
+  int r, GemmS8Args a);
+
+#define BENCH_PARAMS_S8(MEM, ALGO, BATCH, VEC, ...)                       \
+  INSTANTIATE_TUNE_S8(false, false, MEM, ALGO, BATCH, VEC, __VA_ARGS__)   \
+  INSTANTIATE_TUNE_S8(true, false, MEM, ALGO, BATCH, VEC, __VA_ARGS__)    \
+  INSTANTIATE_TUNE_S8(false, true, MEM, ALGO, BATCH, VEC, __VA_ARGS__)    \
+  INSTANTIATE_TUNE_S8(true, true, MEM, ALGO, BATCH, VEC, __VA_ARGS__)
 ''',
     ]
     for config in config_list:
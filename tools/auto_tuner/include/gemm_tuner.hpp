@@ -24,12 +24,16 @@
  **************************************************************************/
 
 #include "tune.hpp"
+#include "tuner_database.hpp"
 #include "tuner_types.hpp"
 #include "utils.hpp"
 
 #include "reference_gemm.hpp"
 #include "sycl_blas.hpp"
 
+#include <fstream>
+#include <string>
+
 using namespace cl::sycl;
 using namespace blas;
 // Convert batch_type=strided to interleaved on the host
@@ -97,9 +101,39 @@ static TestResultEntry tune_syclblas(int r, char transA, char transB,
   return result;
 }
 
+// Appends the rule selecting the fastest valid configuration to a GEMM
+// dispatch table, see GemmDispatchTable
+template <bool TransA, bool TransB>
+void append_dispatch_rule(const TestResult &results, int m, int k, int n,
+                          int batch_size, const std::string &table_file) {
+  // results are sorted from the slowest to the fastest
+  auto best = std::find_if(results.rbegin(), results.rend(),
+                           [](const TestResultEntry &r) {
+                             return r.error < 0.1 && !r.config.empty();
+                           });
+  if (best == results.rend()) {
+    std::cerr << "No valid configuration to add to " << table_file << "\n";
+    return;
+  }
+  std::ofstream table(table_file, std::ios::app);
+  if (!table) {
+    std::cerr << "Could not open " << table_file << "\n";
+    return;
+  }
+  const auto device_type =
+      get_sycl_executor().get_policy_handler().get_device_type();
+  table << codeplay_policy::get_device_type_name(device_type) << " "
+        << (TransA ? "t" : "n") << " " << (TransB ? "t" : "n") << " " << m
+        << " " << n << " " << k << " " << batch_size << " " << best->config
+        << "\n";
+  std::cout << "Added " << best->config << " to " << table_file << "\n";
+}
+
 template <bool TransA, bool TransB, typename DataType>
 void run_tune_gemm(int seed, int m, int k, int n, int batch_size, int rep,
-                   ::blas::gemm_batch_type_t batch_type) {
+                   ::blas::gemm_batch_type_t batch_type,
+                   const std::string &table_file = "",
+                   const std::string &database_file = "") {
   std::cout << std::scientific;
 
   std::mt19937 rnd(seed);
@@ -161,16 +195,166 @@ void run_tune_gemm(int seed, int m, int k, int n, int batch_size, int rep,
     results.push_back(result);
   }
 
-#define BENCH_PARAMS(MEM, ALG, BATCH, VEC, ...)                             \
-  do {                                                                      \
-    auto result =                                                           \
-        tune<__VA_ARGS__, GemmConfig<TransA, TransB, MEM, ALG, BATCH, VEC>, \
-             DataType>(rep, args);                                          \
-    results.push_back(result);                                              \
+  // The configurations measured by a previous run are not measured again
+  TunerDatabase database(database_file);
+  const auto database_key = TunerDatabase::get_key(
+      get_sycl_executor()
+          .get_policy_handler()
+          .get_queue()
+          .get_device()
+          .template get_info<cl::sycl::info::device::name>(),
+      ::blas::type_string<DataType>::get_value(), TransA, TransB, batch_type,
+      m, n, k, batch_size);
+
+#define BENCH_PARAMS(MEM, ALG, BATCH, VEC, ...)                           \
+  do {                                                                    \
+    using config_t = GemmConfig<TransA, TransB, MEM, ALG, BATCH, VEC>;    \
+    TestResultEntry result("");                                           \
+    if (!database.find(database_key,                                      \
+                       get_tune_config_name<__VA_ARGS__, config_t>(),     \
+                       result)) {                                         \
+      result = tune<__VA_ARGS__, config_t, DataType>(rep, args);          \
+      database.add(database_key, result);                                 \
+    }                                                                     \
+    results.push_back(result);                                            \
+  } while (0);
+#define BENCH_PARAMS_S8(...)
+
+#include "generated_combinations.def"
+
+#undef BENCH_PARAMS_S8
+#undef BENCH_PARAMS
+  std::cout << "SIZE : " << results.size() << std::endl;
+  get_sycl_executor().get_policy_handler().wait();
+  std::sort(results.begin(), results.end());
+  results.print_all();
+  // Only the strided configurations can be selected by a dispatch table
+  if (!table_file.empty() && batch_type == gemm_batch_type_t::strided) {
+    append_dispatch_rule<TransA, TransB>(results, m, k, n, batch_size,
+                                         table_file);
+  }
+}
+
+static TestResultEntry tune_syclblas_s8(int r, char transA, char transB,
+                                        GemmS8Args a) {
+  TestResultEntry result("SYCL-BLAS gemm_s8");
+  auto ex = get_sycl_executor();
+  {
+    const double flop_count = 2.0 * a.m * a.n * a.k;
+    run_tune(r, flop_count, result, [&] {
+      auto event_list =
+          _gemm_s8(ex, transA, transB, a.m, a.n, a.k, a.a, a.lda, a.b, a.ldb,
+                   a.c, a.ldc, gemm_quantization_t::per_row, a.scale,
+                   a.zero_point);
+      for (auto &event : event_list) {
+        event.wait_and_throw();
+      }
+    });
+  }
+  {
+    auto event_list = ex.get_policy_handler().copy_to_host(
+        a.c, a.output_c.data(), a.output_c.size());
+    event_list.back().wait_and_throw();
+  }
+
+  result.error = quantized_diff(a.expected_c, a.output_c);
+  return result;
+}
+
+// Tunes the int8 GEMM requantized to int8 with a scale per row of C, as for
+// the output channels of a layer. The dispatch tables only select float
+// configurations, so the results are only printed and kept in the database.
+template <bool TransA, bool TransB>
+void run_tune_gemm_s8(int seed, int m, int k, int n, int rep,
+                      const std::string &database_file = "") {
+  std::cout << std::scientific;
+
+  std::mt19937 rnd(seed);
+  std::uniform_int_distribution<int> int8_dst(-128, 127);
+  HostContainer<int8_t> host_a(k * m);
+  HostContainer<int8_t> host_b(n * k);
+  for (auto &e : host_a) {
+    e = static_cast<int8_t>(int8_dst(rnd));
+  }
+  for (auto &e : host_b) {
+    e = static_cast<int8_t>(int8_dst(rnd));
+  }
+  // The scales bring the int32 accumulators back to about the int8 range
+  auto host_scale = get_random_vector<float>(m, 1e-4f / k, 5e-4f / k, rnd);
+  HostContainer<int32_t> host_zero_point(m);
+  for (auto &e : host_zero_point) {
+    e = int8_dst(rnd) / 4;
+  }
+  HostContainer<int8_t> expected_c(m * n);
+  HostContainer<int8_t> result_c(m * n);
+
+  const int lda = TransA ? k : m;
+  const int ldb = TransB ? n : k;
+  const int ldc = m;
+  const double flop_count = 2.0 * m * n * k;
+
+  TestResultEntry ref_result("Host int8 GEMM");
+  run_tune(rep, flop_count, ref_result, [&] {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < m; ++i) {
+        int32_t acc = 0;
+        for (int l = 0; l < k; ++l) {
+          acc += int32_t(host_a[TransA ? l + i * lda : i + l * lda]) *
+                 int32_t(host_b[TransB ? j + l * ldb : l + j * ldb]);
+        }
+        const float value =
+            std::nearbyint(float(acc) * host_scale[i] + host_zero_point[i]);
+        expected_c[i + j * ldc] = static_cast<int8_t>(
+            std::min(std::max(value, -128.f), 127.f));
+      }
+    }
+  });
+  ref_result.error = 0.0;
+
+  TestResult results{};
+  results.push_back(ref_result);
+  const auto device_a = blas::make_sycl_iterator_buffer(host_a, host_a.size());
+  const auto device_b = blas::make_sycl_iterator_buffer(host_b, host_b.size());
+  const auto device_scale = blas::make_sycl_iterator_buffer(host_scale, m);
+  const auto device_zero_point =
+      blas::make_sycl_iterator_buffer(host_zero_point, m);
+  auto device_c = blas::make_sycl_iterator_buffer(result_c, result_c.size());
+  GemmS8Args args{m, n, k, device_a, lda, device_b, ldb, device_scale,
+                  device_zero_point, device_c, result_c, ldc, expected_c};
+
+  {
+    auto result =
+        tune_syclblas_s8(rep, TransA ? 't' : 'n', TransB ? 't' : 'n', args);
+    results.push_back(result);
+  }
+
+  TunerDatabase database(database_file);
+  const auto database_key = TunerDatabase::get_key(
+      get_sycl_executor()
+          .get_policy_handler()
+          .get_queue()
+          .get_device()
+          .template get_info<cl::sycl::info::device::name>(),
+      ::blas::type_string<int8_t>::get_value(), TransA, TransB,
+      gemm_batch_type_t::strided, m, n, k, 1);
+
+#define BENCH_PARAMS(...)
+#define BENCH_PARAMS_S8(MEM, ALG, BATCH, VEC, ...)                        \
+  do {                                                                    \
+    using config_t = GemmConfig<TransA, TransB, MEM, ALG, BATCH, VEC>;    \
+    TestResultEntry result("");                                           \
+    if (!database.find(database_key,                                      \
+                       get_tune_config_name<__VA_ARGS__, config_t>(),     \
+                       result)) {                                         \
+      result = tune_s8<__VA_ARGS__, config_t>(rep, args);                 \
+      database.add(database_key, result);                                 \
+    }                                                                     \
+    results.push_back(result);                                            \
   } while (0);
 
 #include "generated_combinations.def"
 
+#undef BENCH_PARAMS_S8
 #undef BENCH_PARAMS
   std::cout << "SIZE : " << results.size() << std::endl;
   get_sycl_executor().get_policy_handler().wait();
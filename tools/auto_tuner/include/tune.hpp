@@ -28,8 +28,24 @@
 
 #include "tuner_types.hpp"
 
+#include <string>
+
 template <int VecSize, int Cls, typename Tile, bool DoubleBuffer, bool Nbca,
           bool Nbcb, typename Config, typename T>
 TestResultEntry tune(int r, GemmArgs<T> a);
 
+template <int VecSize, int Cls, typename Tile, bool DoubleBuffer, bool Nbca,
+          bool Nbcb, typename Config>
+TestResultEntry tune_s8(int r, GemmS8Args a);
+
+// Name of the configuration in the GEMM dispatch tables and the database
+template <int VecSize, int Cls, typename Tile, bool DoubleBuffer, bool Nbca,
+          bool Nbcb, typename Config>
+inline std::string get_tune_config_name() {
+  return ::blas::get_gemm_config_name(
+      Config::MemoryMode, Config::ShapeMode, Config::VecType, VecSize, Cls,
+      DoubleBuffer, Nbca, Nbcb, Tile::item_rows, Tile::item_cols,
+      Tile::wg_rows, Tile::wg_cols);
+}
+
 #endif  // SYCLBLAS_TOOLS_AUTO_TUNER_TUNE_HPP_
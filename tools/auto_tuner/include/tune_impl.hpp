@@ -26,6 +26,7 @@
 #ifndef SYCLBLAS_TOOLS_AUTO_TUNER_TUNE_IMPL_HPP_
 #define SYCLBLAS_TOOLS_AUTO_TUNER_TUNE_IMPL_HPP_
 
+#include "tune.hpp"
 #include "tuner_types.hpp"
 #include "utils.hpp"
 
@@ -42,6 +43,8 @@ TestResultEntry tune(int r, GemmArgs<T> a) {
                    static_cast<int>(Config::VecType), VecSize,
                    static_cast<int>(Config::BatchType)>;
   TestResultEntry result(Gemm::get_type_string());
+  result.config = get_tune_config_name<VecSize, Cls, Tile, DoubleBuffer, Nbca,
+                                       Nbcb, Config>();
   auto ex = get_sycl_executor();
   {
     {
@@ -56,7 +59,13 @@ TestResultEntry tune(int r, GemmArgs<T> a) {
         ::blas::make_matrix_view<::blas::col_major>(ex, a.b, a.k, a.n, a.ldb);
     auto accC =
         ::blas::make_matrix_view<::blas::col_major>(ex, a.c, a.m, a.n, a.ldc);
-    auto gemm = Gemm(accA, accB, accC, a.alpha, a.beta, a.batch_size);
+    auto gemm = Gemm(
+        accA, accB, accC, a.alpha, a.beta, a.batch_size,
+        ::blas::internal::get_implicit_stride_a(Config::TransA ? 't' : 'n',
+                                                a.m, a.k, a.lda),
+        ::blas::internal::get_implicit_stride_b(Config::TransB ? 't' : 'n',
+                                                a.k, a.n, a.ldb),
+        a.ldc * a.n);
     const double flop_count = 2.0 * a.m * a.n * a.k * a.batch_size;
     run_tune(r, flop_count, result, [&] {
       auto event_list = ex.execute(gemm);
@@ -74,4 +83,60 @@ TestResultEntry tune(int r, GemmArgs<T> a) {
   return result;
 }
 
+template <int VecSize, int Cls, typename Tile, bool DoubleBuffer, bool Nbca,
+          bool Nbcb, typename Config>
+TestResultEntry tune_s8(int r, GemmS8Args a) {
+  using ScaleContainer =
+      typename ::blas::VectorViewTypeFactory<::blas::codeplay_policy, float,
+                                             int, int>::output_t;
+  using ZeroPointContainer =
+      typename ::blas::VectorViewTypeFactory<::blas::codeplay_policy, int32_t,
+                                             int, int>::output_t;
+  using Epilogue =
+      ::blas::GemmRequantize<int8_t, ScaleContainer, ZeroPointContainer>;
+  using Gemm = ::blas::Gemm<
+      MatrixContainer<int8_t>, MatrixContainer<int8_t>, DoubleBuffer, Nbca,
+      Nbcb, Cls, Tile, Config::TransA, Config::TransB, int32_t, true,
+      static_cast<int>(Config::MemoryMode),
+      static_cast<int>(Config::ShapeMode), static_cast<int>(Config::VecType),
+      VecSize, static_cast<int>(Config::BatchType), Epilogue>;
+  TestResultEntry result(Gemm::get_type_string());
+  result.config = get_tune_config_name<VecSize, Cls, Tile, DoubleBuffer, Nbca,
+                                       Nbcb, Config>();
+  auto ex = get_sycl_executor();
+  {
+    auto accA =
+        ::blas::make_matrix_view<::blas::col_major>(ex, a.a, a.m, a.k, a.lda);
+    auto accB =
+        ::blas::make_matrix_view<::blas::col_major>(ex, a.b, a.k, a.n, a.ldb);
+    auto accC =
+        ::blas::make_matrix_view<::blas::col_major>(ex, a.c, a.m, a.n, a.ldc);
+    auto scale = ::blas::make_vector_view(ex, a.scale, 1, a.m);
+    auto zero_point = ::blas::make_vector_view(ex, a.zero_point, 1, a.m);
+    auto gemm = Gemm(
+        accA, accB, accC, 1, 0, 1,
+        ::blas::internal::get_implicit_stride_a(Config::TransA ? 't' : 'n',
+                                                a.m, a.k, a.lda),
+        ::blas::internal::get_implicit_stride_b(Config::TransB ? 't' : 'n',
+                                                a.k, a.n, a.ldb),
+        a.ldc * a.n,
+        ::blas::make_gemm_requantize<int8_t>(
+            scale, zero_point, ::blas::gemm_quantization_t::per_row));
+    const double flop_count = 2.0 * a.m * a.n * a.k;
+    run_tune(r, flop_count, result, [&] {
+      auto event_list = ex.execute(gemm);
+      for (auto &event : event_list) {
+        event.wait_and_throw();
+      }
+    });
+    {
+      auto event_list = ex.get_policy_handler().copy_to_host(
+          a.c, a.output_c.data(), a.output_c.size());
+      event_list.back().wait_and_throw();
+    }
+  }
+  result.error = quantized_diff(a.expected_c, a.output_c);
+  return result;
+}
+
 #endif  // SYCLBLAS_TOOLS_AUTO_TUNER_TUNE_IMPL_HPP_
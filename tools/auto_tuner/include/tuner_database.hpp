@@ -0,0 +1,138 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename tuner_database.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCLBLAS_TOOLS_AUTO_TUNER_TUNER_DATABASE_HPP_
+#define SYCLBLAS_TOOLS_AUTO_TUNER_TUNER_DATABASE_HPP_
+
+#include "tuner_types.hpp"
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+
+// Results of the tuner kept from one run to the next, so that the
+// configurations already measured for a shape are not measured again.
+//
+// The database is a text file with one line per measured configuration:
+//
+//   device data_type trans_a trans_b batch_type m n k batch_size config
+//   gflops ms error
+//
+// where device is the name of the SYCL device with the spaces replaced by
+// underscores, so that a file can hold the results of several devices.
+// New results are appended to the file as soon as they are measured.
+class TunerDatabase {
+ public:
+  // An empty path keeps the results in memory only
+  explicit TunerDatabase(const std::string &path) : path_(path) {
+    if (path_.empty()) {
+      return;
+    }
+    std::ifstream file(path_);
+    std::string line;
+    while (std::getline(file, line)) {
+      std::istringstream fields(line);
+      std::string key_fields[9];
+      std::string config;
+      double gflops, ms, error;
+      bool valid = true;
+      for (auto &field : key_fields) {
+        valid = valid && static_cast<bool>(fields >> field);
+      }
+      if (valid && fields >> config >> gflops >> ms >> error) {
+        std::string key = key_fields[0];
+        for (int i = 1; i < 9; ++i) {
+          key += " " + key_fields[i];
+        }
+        TestResultEntry entry(config + " (cached)");
+        entry.config = config;
+        entry.gflops = gflops;
+        entry.ms = ms;
+        entry.error = error;
+        entries_.emplace(std::make_pair(key, config), entry);
+      }
+    }
+  }
+
+  // Key of the results of a shape
+  static std::string get_key(const std::string &device,
+                             const std::string &data_type, bool trans_a,
+                             bool trans_b, ::blas::gemm_batch_type_t batch_type,
+                             int m, int n, int k, int batch_size) {
+    std::string device_name = device;
+    for (auto &c : device_name) {
+      if (std::isspace(static_cast<unsigned char>(c))) {
+        c = '_';
+      }
+    }
+    std::ostringstream key{};
+    key << device_name << " " << data_type << " " << (trans_a ? "t" : "n")
+        << " " << (trans_b ? "t" : "n") << " "
+        << (batch_type == ::blas::gemm_batch_type_t::interleaved
+                ? "interleaved"
+                : "strided")
+        << " " << m << " " << n << " " << k << " " << batch_size;
+    return key.str();
+  }
+
+  // Looks up the result of a configuration for a shape
+  bool find(const std::string &key, const std::string &config,
+            TestResultEntry &entry) const {
+    auto it = entries_.find(std::make_pair(key, config));
+    if (it == entries_.end()) {
+      return false;
+    }
+    entry = it->second;
+    return true;
+  }
+
+  // Records the result of a configuration for a shape
+  void add(const std::string &key, const TestResultEntry &entry) {
+    if (entry.config.empty()) {
+      return;
+    }
+    entries_.emplace(std::make_pair(key, entry.config), entry);
+    if (path_.empty()) {
+      return;
+    }
+    std::ofstream file(path_, std::ios::app);
+    if (!file) {
+      std::cerr << "Could not write to the database " << path_ << "\n";
+      return;
+    }
+    file << key << " " << entry.config << " " << entry.gflops << " "
+         << entry.ms << " " << entry.error << "\n";
+  }
+
+ private:
+  std::string path_;
+  std::map<std::pair<std::string, std::string>, TestResultEntry> entries_;
+};
+
+#endif  // SYCLBLAS_TOOLS_AUTO_TUNER_TUNER_DATABASE_HPP_
@@ -27,6 +27,7 @@
 #define SYCLBLAS_TOOLS_AUTO_TUNER_TUNER_TYPES_HPP_
 
 #include <iostream>
+#include <string>
 #include <vector>
 
 #include "sycl_blas.hpp"
@@ -48,14 +49,16 @@ using MatrixContainer =
 
 struct TestResultEntry {
   std::string name;
-  double sec;
-  double gflops;
-  double error;
+  // Name of the configuration in a GEMM dispatch table, if it has one
+  std::string config;
+  double ms = 0;
+  double gflops = 0;
+  double error = 0;
 
   TestResultEntry(std::string name) : name(name) {}
 
   void print() const {
-    std::cout << gflops << " gflops: " << name << " - Time: " << sec
+    std::cout << gflops << " gflops: " << name << " - Time: " << ms
               << " ms, Error: " << error << "\n";
   }
 
@@ -111,4 +114,22 @@ struct GemmArgs {
   const HostContainer<element_t> &expected_c;
 };
 
+// Arguments of the int8 GEMM, requantized to int8 with a scale and a zero
+// point per row of C
+struct GemmS8Args {
+  int m;
+  int n;
+  int k;
+  const DeviceContainer<int8_t> &a;
+  int lda;
+  const DeviceContainer<int8_t> &b;
+  int ldb;
+  const DeviceContainer<float> &scale;
+  const DeviceContainer<int32_t> &zero_point;
+  DeviceContainer<int8_t> &c;
+  HostContainer<int8_t> &output_c;
+  int ldc;
+  const HostContainer<int8_t> &expected_c;
+};
+
 #endif  // SYCLBLAS_TOOLS_AUTO_TUNER_TUNER_TYPES_HPP_
@@ -29,6 +29,7 @@
 #include "tuner_types.hpp"
 
 #include <chrono>
+#include <cstdlib>
 #include <functional>
 #include <iostream>
 #include <numeric>
@@ -81,6 +82,19 @@ T relative_diff(const HostContainer<T> &ref, const HostContainer<T> &obt) {
   return std::sqrt(diff / mag);
 }
 
+// Fraction of the requantized results more than one step away from the
+// reference, a fused multiply-add may round a value to either neighbour
+inline double quantized_diff(const HostContainer<int8_t> &ref,
+                             const HostContainer<int8_t> &obt) {
+  size_t mismatches = 0;
+  for (size_t i = 0; i < ref.size(); ++i) {
+    if (std::abs(int(ref[i]) - int(obt[i])) > 1) {
+      ++mismatches;
+    }
+  }
+  return ref.empty() ? 0.0 : double(mismatches) / ref.size();
+}
+
 template <typename TestOperator>
 static void run_tune(int rep, double flop_cnt, TestResultEntry &result,
                      TestOperator op = TestOperator()) {
@@ -106,7 +120,7 @@ static void run_tune(int rep, double flop_cnt, TestResultEntry &result,
   auto seconds_per_iter = runtime_secs / rep;
   auto milliseconds =
       std::chrono::duration_cast<MilliSeconds>(seconds_per_iter);
-  result.sec = milliseconds.count();
+  result.ms = milliseconds.count();
   auto gigaflop_count = flop_cnt / 1e9;
   result.gflops = gigaflop_count / seconds_per_iter.count();
 }
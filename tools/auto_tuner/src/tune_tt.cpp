@@ -29,7 +29,9 @@
 
 int main(int argc, char *argv[]) {
   if (argc < 6) {
-    std::cerr << "Usage: " << argv[0] << " M K N bs rep" << std::endl;
+    std::cerr << "Usage: " << argv[0]
+              << " M K N bs rep [batch_type [dispatch_table [database]]]"
+              << std::endl;
     return -1;
   }
 
@@ -43,7 +45,7 @@ int main(int argc, char *argv[]) {
   const int batch_size = std::atoi(argv[4]);
   const int rep = std::atoi(argv[5]);
   ::blas::gemm_batch_type_t batch_type = gemm_batch_type_t::strided;
-  if (argc == 7) {
+  if (argc >= 7) {
     auto b_t = std::string(argv[6]);
     std::transform(b_t.begin(), b_t.end(), b_t.begin(),
                    [](unsigned char c) { return std::tolower(c); });
@@ -56,8 +58,11 @@ int main(int argc, char *argv[]) {
       return -1;
     }
   }
+  const std::string table_file = argc >= 8 ? argv[7] : "";
+  const std::string database_file = argc >= 9 ? argv[8] : "";
   run_tune_gemm<transA, transB, float>(seed, m, k, n, batch_size, rep,
-                                       batch_type);
+                                       batch_type, table_file,
+                                       database_file);
 
   return 0;
 }